@@ -14,19 +14,137 @@
 #include <utility>//for std::forward<>
 #include <tuple>//for ranges settings
 #include <type_traits>//for std::enable_if
+#include <vector>//for "Split()" results
 
 namespace UnrealRanges {
 
 	// ===============================| Basic ranges |=======================================
 
+	// Logic protocol used by "TBasicRange<>":
+	//
+	//  - "static {Value} Get(const ParentIteratorType& Current, const SettingType& Setting)"
+	//     Returns Range element for the "Current" Parent Range position. Logics that don't
+	//     create new values should return "decltype(auto)" to pass Parent Range element
+	//     reference through without copying
+	//
+	//  - "static void Ignore(ParentIteratorType& Current, const ParentIteratorType& End, const SettingType& Setting)"
+	//     Moves "Current" forward until element that should be passed to the Range
+	//
+	//  - Optional "static constexpr bool bSizePreserving"
+	//     Logic should declare it as "true" if it never skips Parent Range elements. Range
+	//     with such Logic has same size as Parent Range (see "UnrealRanges::Utils::RangeSize()")
+	//
+	//  - Optional "StateType" type alias
+	//     If Logic declares it, each "TBasicRange<>::Iterator" stores value of this type
+	//     and passes it as the last argument for "Get()" (by const reference) and "Ignore()"
+	//     (by reference). It allows Logic to cache data computed during ignoring (for
+	//     example, transforming result) and reuse it for getting element value
+	//
+	//  - Optional "static bool Push(ElementType&& Element, const SettingType& Setting, const SinkType& Sink)"
+	//     Processes Parent Range element and passes result(s) to "Sink" (if any). Returns
+	//     "false" if "Sink" returned "false" (iterating should be stopped). If Logic declares
+	//     it, Range pushes elements without iterators (see "TBasicRange<>::ForEachWhile()")
+	//
+	namespace TemplateDetails
+	{
+		namespace TBasicRange
+		{
+			struct FNoLogicState { };
+
+			template<typename LogicType> auto LogicState(int)->typename LogicType::StateType;
+			template<typename LogicType> auto LogicState(...)->FNoLogicState;
+
+			template<typename LogicType>
+			using LogicStateType = decltype(LogicState<LogicType>(0));
+
+			template<typename LogicType>
+			constexpr auto IsSizePreserving(int)->decltype(static_cast<bool>(LogicType::bSizePreserving))
+			{
+				return LogicType::bSizePreserving;
+			}
+
+			template<typename LogicType>
+			constexpr bool IsSizePreserving(...)
+			{
+				return false;
+			}
+
+			//NB: Logic that skips elements cannot move through elements in constant time
+			template<typename LogicType, typename IteratorType>
+			constexpr bool IsRandomAccess()
+			{
+				return IsSizePreserving<LogicType>(0) && UnrealRanges::Private::Utils::IsRandomAccessIterator<IteratorType>();
+			}
+
+			template<typename LogicType, typename IteratorType>
+			constexpr auto IsBidirectional(int)->decltype(--std::declval<IteratorType&>(), true)
+			{
+				return IsSizePreserving<LogicType>(0);
+			}
+
+			template<typename LogicType, typename IteratorType>
+			constexpr bool IsBidirectional(...)
+			{
+				return false;
+			}
+
+			template<typename LogicType, typename RangeType>
+			auto Size(const RangeType& ParentRange)->std::enable_if_t<
+				IsSizePreserving<LogicType>(0),
+				decltype(UnrealRanges::Utils::RangeSize(ParentRange))
+			>
+			{
+				return UnrealRanges::Utils::RangeSize(ParentRange);
+			}
+
+			//NB: Stateful Logic call variant is prefered
+
+			template<typename LogicType, typename IteratorType, typename SettingType, typename StateType>
+			auto Get(const IteratorType& Current, const SettingType& Setting, const StateType& State, int)->
+				decltype(LogicType::Get(Current, Setting, State))
+			{
+				return LogicType::Get(Current, Setting, State);
+			}
+
+			template<typename LogicType, typename IteratorType, typename SettingType, typename StateType>
+			auto Get(const IteratorType& Current, const SettingType& Setting, const StateType&, ...)->
+				decltype(LogicType::Get(Current, Setting))
+			{
+				return LogicType::Get(Current, Setting);
+			}
+
+			template<typename LogicType, typename IteratorType, typename SettingType, typename StateType>
+			auto Ignore(IteratorType& Current, const IteratorType& End, const SettingType& Setting, StateType& State, int)->
+				decltype(LogicType::Ignore(Current, End, Setting, State))
+			{
+				LogicType::Ignore(Current, End, Setting, State);
+			}
+
+			template<typename LogicType, typename IteratorType, typename SettingType, typename StateType>
+			auto Ignore(IteratorType& Current, const IteratorType& End, const SettingType& Setting, StateType&, ...)->
+				decltype(LogicType::Ignore(Current, End, Setting))
+			{
+				LogicType::Ignore(Current, End, Setting);
+			}
+
+			template<typename LogicType, typename ElementType, typename SettingType, typename SinkType>
+			auto Push(ElementType&& Element, const SettingType& Setting, const SinkType& Sink)->
+				decltype(static_cast<bool>(LogicType::Push(std::forward<ElementType>(Element), Setting, Sink)))
+			{
+				return LogicType::Push(std::forward<ElementType>(Element), Setting, Sink);
+			}
+		}
+	}
+
 	template<class ParentRangeCaptureType, template<class, class> class Logic, class SettingsType>
 	class TBasicRange
 	{
 	public:
-		using ParentRangeType = UnrealRanges::Private::Utils::CapturedValueType<ParentRangeCaptureType>;
+		using ParentRangeType = UnrealRanges::Private::Utils::CapturedAccessType<ParentRangeCaptureType>;
 		using ParentRangeIteratorType = UnrealRanges::Private::Utils::RangeIteratorType<ParentRangeType>;
 		using ValueType = UnrealRanges::Private::Utils::IteratorValueType<ParentRangeIteratorType>;
 		using LogicInstanceType = Logic<ParentRangeIteratorType, SettingsType>;
+		using LogicStateType = TemplateDetails::TBasicRange::LogicStateType<LogicInstanceType>;
 
 		class Iterator
 		{
@@ -37,22 +155,22 @@ namespace UnrealRanges {
 				const SettingsType& InSettings)
 				:
 				Current(std::move(InCurrent)), End(std::move(InEnd)),
-				Settings(InSettings)
+				Settings(InSettings), State()
 			{
-				LogicInstanceType::Ignore(Current, End, Settings);
+				TemplateDetails::TBasicRange::Ignore<LogicInstanceType>(Current, End, Settings.Get(), State, 0);
 			}
 
-			auto operator*() const
+			decltype(auto) operator*() const
 			{
 				UnrealRanges::Utils::Check(Current != End);
-				return LogicInstanceType::Get(Current, Settings);
+				return TemplateDetails::TBasicRange::Get<LogicInstanceType>(Current, Settings.Get(), State, 0);
 			}
 
 			void operator++()
 			{
 				UnrealRanges::Utils::Check(Current != End);
 				++Current;
-				LogicInstanceType::Ignore(Current, End, Settings);
+				TemplateDetails::TBasicRange::Ignore<LogicInstanceType>(Current, End, Settings.Get(), State, 0);
 			}
 
 			bool operator!=(const Iterator& Other) const
@@ -60,10 +178,78 @@ namespace UnrealRanges {
 				return (Current != Other.Current);
 			}
 
+			//NB: Operations below are available only if Logic doesn't skip elements and
+			// Parent Range iterator supports them
+
+			template<typename IteratorTypeHelper = ParentRangeIteratorType>
+			auto operator--()->std::enable_if_t<
+				TemplateDetails::TBasicRange::IsBidirectional<LogicInstanceType, IteratorTypeHelper>(0)>
+			{
+				--Current;
+			}
+
+			template<typename IteratorTypeHelper = ParentRangeIteratorType>
+			auto operator+=(const int Num)->std::enable_if_t<
+				TemplateDetails::TBasicRange::IsRandomAccess<LogicInstanceType, IteratorTypeHelper>(), Iterator&>
+			{
+				UnrealRanges::Utils::Check(Num <= static_cast<int>(End - Current));
+				Current += Num;
+				return *this;
+			}
+
+			template<typename IteratorTypeHelper = ParentRangeIteratorType>
+			auto operator-=(const int Num)->std::enable_if_t<
+				TemplateDetails::TBasicRange::IsRandomAccess<LogicInstanceType, IteratorTypeHelper>(), Iterator&>
+			{
+				Current -= Num;
+				return *this;
+			}
+
+			template<typename IteratorTypeHelper = ParentRangeIteratorType>
+			auto operator+(const int Num) const->std::enable_if_t<
+				TemplateDetails::TBasicRange::IsRandomAccess<LogicInstanceType, IteratorTypeHelper>(), Iterator>
+			{
+				Iterator Result{ *this };
+				Result += Num;
+				return Result;
+			}
+
+			template<typename IteratorTypeHelper = ParentRangeIteratorType>
+			auto operator-(const int Num) const->std::enable_if_t<
+				TemplateDetails::TBasicRange::IsRandomAccess<LogicInstanceType, IteratorTypeHelper>(), Iterator>
+			{
+				Iterator Result{ *this };
+				Result -= Num;
+				return Result;
+			}
+
+			template<typename IteratorTypeHelper = ParentRangeIteratorType>
+			auto operator-(const Iterator& Other) const->std::enable_if_t<
+				TemplateDetails::TBasicRange::IsRandomAccess<LogicInstanceType, IteratorTypeHelper>(), int>
+			{
+				return static_cast<int>(Current - Other.Current);
+			}
+
+			template<typename IteratorTypeHelper = ParentRangeIteratorType>
+			auto operator[](const int Index) const->std::enable_if_t<
+				TemplateDetails::TBasicRange::IsRandomAccess<LogicInstanceType, IteratorTypeHelper>(),
+				decltype(TemplateDetails::TBasicRange::Get<LogicInstanceType>(
+					std::declval<const IteratorTypeHelper&>(), std::declval<const SettingsType&>(), std::declval<const LogicStateType&>(), 0))>
+			{
+				UnrealRanges::Utils::Check(Index < static_cast<int>(End - Current));
+
+				ParentRangeIteratorType Indexed{ Current };
+				Indexed += Index;
+				return TemplateDetails::TBasicRange::Get<LogicInstanceType>(Indexed, Settings.Get(), State, 0);
+			}
+
 		private:
 			ParentRangeIteratorType Current;
 			ParentRangeIteratorType End;
-			SettingsType Settings;
+			//NB: Settings are stored in assignable holder - Logic settings are usually
+			// lambdas, and iterator should be assignable (for example, for "ReverseRange()")
+			UnrealRanges::Private::Utils::TAssignableValue<SettingsType> Settings;
+			LogicStateType State;
 		};
 
 		//NB: "SettingsTypeFF" - to cause deducation and make possible to use Fast Forward
@@ -98,6 +284,60 @@ namespace UnrealRanges {
 			};
 		}
 
+		//NB: Available only if Parent Range is sized and Logic doesn't skip elements
+		template<typename ParentRangeTypeHelper = ParentRangeType>
+		auto Size() const->decltype(
+			TemplateDetails::TBasicRange::Size<LogicInstanceType>(std::declval<const ParentRangeTypeHelper&>()))
+		{
+			return TemplateDetails::TBasicRange::Size<LogicInstanceType>(GetParentRange());
+		}
+
+		//NB: Logic never adds elements, so upper bound of Parent Range size is valid for any Logic
+		template<typename ParentRangeTypeHelper = ParentRangeType>
+		auto MaxSize() const->decltype(
+			UnrealRanges::Utils::RangeMaxSize(std::declval<const ParentRangeTypeHelper&>()))
+		{
+			return UnrealRanges::Utils::RangeMaxSize(GetParentRange());
+		}
+
+		//NB: Available only if Parent Range is splittable. Logic processes each element
+		// independently, so Logic applied to parts of Parent Range gives parts of this Range
+		template<typename ParentRangeTypeHelper = ParentRangeType>
+		auto Split(const int PartsNum) const->std::vector<TBasicRange<
+			UnrealRanges::Private::Utils::RangePartCaptureType<ParentRangeTypeHelper>, Logic, SettingsType>>
+		{
+			std::vector<TBasicRange<
+				UnrealRanges::Private::Utils::RangePartCaptureType<ParentRangeTypeHelper>, Logic, SettingsType>> Parts;
+
+			auto ParentParts = UnrealRanges::Utils::RangeSplit(GetParentRange(), PartsNum);
+			Parts.reserve(ParentParts.size());
+
+			for (auto& ParentPart : ParentParts)
+			{
+				Parts.push_back({ UnrealRanges::Private::Utils::Capture(std::move(ParentPart)), Settings });
+			}
+
+			return Parts;
+		}
+
+		//NB: Available only if Logic can push elements. Elements of Parent Range are got by
+		// "UnrealRanges::Utils::RangeForEachWhile()" too, so chain of such Ranges is iterated
+		// by single loop over the root Range
+		template<typename SinkType, typename ParentRangeIteratorTypeHelper = ParentRangeIteratorType>
+		auto ForEachWhile(const SinkType& Sink) const->decltype(
+			TemplateDetails::TBasicRange::Push<LogicInstanceType>(
+				*std::declval<const ParentRangeIteratorTypeHelper&>(), std::declval<const SettingsType&>(), Sink))
+		{
+			const SettingsType& RangeSettings = Settings;
+
+			return UnrealRanges::Utils::RangeForEachWhile(GetParentRange(),
+				[&RangeSettings, &Sink](auto&& ParentElement)
+				{
+					return TemplateDetails::TBasicRange::Push<LogicInstanceType>(
+						std::forward<decltype(ParentElement)>(ParentElement), RangeSettings, Sink);
+				});
+		}
+
 		template<typename PassedDownParentRangeType>
 		auto Next(PassedDownParentRangeType&& ParentRangeCapture) const
 		{
@@ -110,13 +350,20 @@ namespace UnrealRanges {
 			return TBasicRange<decltype(NextCapture), Logic, SettingsType> { std::move(NextCapture), Settings };
 		}
 
-	private:
-		
-		const ParentRangeType& GetParentRange() const
+		//NB: Parent Range and Settings are available for algorithms that process
+		// elements of specific Logic in bulk (like compaction of filtered elements)
+		ParentRangeType& GetParentRange() const
 		{
 			return ParentRangeCapture.Get();
 		}
 
+		const SettingsType& GetSettings() const
+		{
+			return Settings;
+		}
+
+	private:
+
 		ParentRangeCaptureType ParentRangeCapture;
 		SettingsType Settings;
 	};
@@ -162,7 +409,9 @@ namespace UnrealRanges {
 		using SettingType = PassOnTrueFilterPredicateType;
 		using ValueType = UnrealRanges::Private::Utils::IteratorValueType<ParentIteratorType>;
 
-		static ValueType Get(const ParentIteratorType& Current, const SettingType& Setting)
+		static constexpr bool bSizePreserving = false;
+
+		static decltype(auto) Get(const ParentIteratorType& Current, const SettingType& Setting)
 		{
 			return *Current;
 		}
@@ -172,6 +421,13 @@ namespace UnrealRanges {
 			const PassOnTrueFilterPredicateType& IsPassFunc = Setting;
 			for (; Current != End && !IsPassFunc(*Current); ++Current);
 		}
+
+		template<typename ElementType, typename SinkType>
+		static bool Push(ElementType&& Element, const SettingType& Setting, const SinkType& Sink)
+		{
+			const PassOnTrueFilterPredicateType& IsPassFunc = Setting;
+			return !IsPassFunc(Element) || Sink(std::forward<ElementType>(Element));
+		}
 	};
 
 	// ---------------- FilteredRange<LogicInversion, ...>(PassOnTrueFilter) ------------------
@@ -202,7 +458,20 @@ namespace UnrealRanges {
 	{
 		using SettingType = TransformFuncType;
 
-		static auto Get(const ParentIteratorType& Current, const SettingType& Setting)
+		static constexpr bool bSizePreserving = true;
+
+		//NB: Reference returned by transform function is passed through only if Parent Range
+		// element is accessed by reference too - otherwise it may refer to a temporary
+		using TransformResultType = decltype(
+			std::declval<const TransformFuncType&>()(*std::declval<const ParentIteratorType&>())
+		);
+		using GetResultType = std::conditional_t<
+			std::is_reference<UnrealRanges::Private::Utils::IteratorReferenceType<ParentIteratorType>>::value,
+			TransformResultType,
+			std::decay_t<TransformResultType>
+		>;
+
+		static GetResultType Get(const ParentIteratorType& Current, const SettingType& Setting)
 		{
 			const TransformFuncType& TransformFunc = Setting;
 			return TransformFunc(*Current);
@@ -211,6 +480,15 @@ namespace UnrealRanges {
 		static void Ignore(ParentIteratorType& Current, const ParentIteratorType& End, const SettingType& Setting)
 		{
 		}
+
+		//NB: Transform result is passed to "Sink" while Parent Range element is alive, so
+		// it is passed without copying even if it refers to a temporary
+		template<typename ElementType, typename SinkType>
+		static bool Push(ElementType&& Element, const SettingType& Setting, const SinkType& Sink)
+		{
+			const TransformFuncType& TransformFunc = Setting;
+			return Sink(TransformFunc(std::forward<ElementType>(Element)));
+		}
 	};
 
 	// -------------------- TransformedRange<...>(TransformFuncType) --------------------------
@@ -235,24 +513,43 @@ namespace UnrealRanges {
 		using SettingType = PassOnTrueFilterAndTransformPredicateType;
 		using IteratorValueType = UnrealRanges::Private::Utils::IteratorValueType<ParentIteratorType>;
 
-		static auto Get(const ParentIteratorType& Current, const SettingType& Setting)
+		static constexpr bool bSizePreserving = false;
+
+		//NB: Optional returned by the functor during ignoring is stored in the iterator,
+		// so the functor is called only once for each Parent Range element
+		using StateType = std::decay_t<
+			decltype(std::declval<const SettingType&>()(*std::declval<const ParentIteratorType&>()))
+		>;
+
+		static auto Get(const ParentIteratorType& Current, const SettingType& Setting, const StateType& State)
 		{
-			UnrealRanges::Utils::Check(IsPass(Current, Setting));
+			UnrealRanges::Utils::Check(UnrealRanges::Utils::IsOptionalSet(State));
 
-			const PassOnTrueFilterAndTransformPredicateType& PassOnTrueFilterAndTransformPredicateFunc = Setting;
-			return UnrealRanges::Utils::GetOptionalValue(PassOnTrueFilterAndTransformPredicateFunc(*Current));
+			return UnrealRanges::Utils::GetOptionalValue(State);
 		}
 
-		static void Ignore(ParentIteratorType& Current, const ParentIteratorType& End, const SettingType& Setting)
+		static void Ignore(ParentIteratorType& Current, const ParentIteratorType& End, const SettingType& Setting, StateType& State)
 		{
-			for (; Current != End && !IsPass(Current, Setting); ++Current);
+			const PassOnTrueFilterAndTransformPredicateType& PassOnTrueFilterAndTransformPredicateFunc = Setting;
+
+			for (; Current != End; ++Current)
+			{
+				State = PassOnTrueFilterAndTransformPredicateFunc(*Current);
+
+				if (UnrealRanges::Utils::IsOptionalSet(State))
+				{
+					return;
+				}
+			}
 		}
 
-	private:
-		static bool IsPass(const ParentIteratorType& Current, const SettingType& Setting)
+		template<typename ElementType, typename SinkType>
+		static bool Push(ElementType&& Element, const SettingType& Setting, const SinkType& Sink)
 		{
 			const PassOnTrueFilterAndTransformPredicateType& PassOnTrueFilterAndTransformPredicateFunc = Setting;
-			return UnrealRanges::Utils::IsOptionalSet(PassOnTrueFilterAndTransformPredicateFunc(*Current));
+
+			const StateType State = PassOnTrueFilterAndTransformPredicateFunc(std::forward<ElementType>(Element));
+			return !UnrealRanges::Utils::IsOptionalSet(State) || Sink(UnrealRanges::Utils::GetOptionalValue(State));
 		}
 	};
 
@@ -274,7 +571,7 @@ namespace UnrealRanges {
 	class TReverseRange
 	{
 	public:
-		using ParentRangeType = UnrealRanges::Private::Utils::CapturedValueType<ParentRangeCaptureType>;
+		using ParentRangeType = UnrealRanges::Private::Utils::CapturedAccessType<ParentRangeCaptureType>;
 		using ParentRangeIteratorType = Private::Utils::RangeIteratorType<ParentRangeType>;
 		using ValueType = Private::Utils::RangeElementType<ParentRangeType>;
 
@@ -288,7 +585,7 @@ namespace UnrealRanges {
 				--Prev;
 			}
 
-			auto operator*() const
+			decltype(auto) operator*() const
 			{
 				return *Prev;
 			}
@@ -305,6 +602,67 @@ namespace UnrealRanges {
 				return (Current != Other.Current);
 			}
 
+			void operator--()
+			{
+				++Current;
+				++Prev;
+			}
+
+			//NB: Operations below are available only if Parent Range iterator is random access
+
+			template<typename IteratorTypeHelper = ParentRangeIteratorType>
+			auto operator+=(const int Num)->std::enable_if_t<
+				Private::Utils::IsRandomAccessIterator<IteratorTypeHelper>(), Iterator&>
+			{
+				Current -= Num;
+				Prev -= Num;
+				return *this;
+			}
+
+			template<typename IteratorTypeHelper = ParentRangeIteratorType>
+			auto operator-=(const int Num)->std::enable_if_t<
+				Private::Utils::IsRandomAccessIterator<IteratorTypeHelper>(), Iterator&>
+			{
+				Current += Num;
+				Prev += Num;
+				return *this;
+			}
+
+			template<typename IteratorTypeHelper = ParentRangeIteratorType>
+			auto operator+(const int Num) const->std::enable_if_t<
+				Private::Utils::IsRandomAccessIterator<IteratorTypeHelper>(), Iterator>
+			{
+				Iterator Result{ *this };
+				Result += Num;
+				return Result;
+			}
+
+			template<typename IteratorTypeHelper = ParentRangeIteratorType>
+			auto operator-(const int Num) const->std::enable_if_t<
+				Private::Utils::IsRandomAccessIterator<IteratorTypeHelper>(), Iterator>
+			{
+				Iterator Result{ *this };
+				Result -= Num;
+				return Result;
+			}
+
+			template<typename IteratorTypeHelper = ParentRangeIteratorType>
+			auto operator-(const Iterator& Other) const->std::enable_if_t<
+				Private::Utils::IsRandomAccessIterator<IteratorTypeHelper>(), int>
+			{
+				return static_cast<int>(Other.Current - Current);
+			}
+
+			template<typename IteratorTypeHelper = ParentRangeIteratorType>
+			auto operator[](const int Index) const->std::enable_if_t<
+				Private::Utils::IsRandomAccessIterator<IteratorTypeHelper>(),
+				Private::Utils::IteratorReferenceType<IteratorTypeHelper>>
+			{
+				ParentRangeIteratorType Indexed{ Prev };
+				Indexed -= Index;
+				return *Indexed;
+			}
+
 		private:
 
 			ParentRangeIteratorType Current;
@@ -316,12 +674,24 @@ namespace UnrealRanges {
 
 		Iterator begin() const
 		{
-			return { RangeEnd(GetRange()) };
+			return { UnrealRanges::Utils::RangeEnd(GetRange()) };
 		}
 
 		Iterator end() const
 		{
-			return { RangeBegin(GetRange()) };
+			return { UnrealRanges::Utils::RangeBegin(GetRange()) };
+		}
+
+		template<typename ParentRangeTypeHelper = ParentRangeType>
+		auto Size() const->decltype(UnrealRanges::Utils::RangeSize(std::declval<const ParentRangeTypeHelper&>()))
+		{
+			return UnrealRanges::Utils::RangeSize(GetRange());
+		}
+
+		template<typename ParentRangeTypeHelper = ParentRangeType>
+		auto MaxSize() const->decltype(UnrealRanges::Utils::RangeMaxSize(std::declval<const ParentRangeTypeHelper&>()))
+		{
+			return UnrealRanges::Utils::RangeMaxSize(GetRange());
 		}
 
 		template<typename PassedDownParentRangeType>
@@ -337,7 +707,7 @@ namespace UnrealRanges {
 		}
 
 	private:
-		const ParentRangeType& GetRange() const
+		ParentRangeType& GetRange() const
 		{
 			return ParentRangeCapture.Get();
 		}
@@ -375,699 +745,1733 @@ namespace UnrealRanges {
 		return TReverseRange<Private::Utils::DummyType>{ };
 	}
 
-	// ================================| Step into range |=======================================
+	// ================================| Sliced range |=======================================
 
-	template<class ParentRangeCaptureType, class StepIntoFuncType>
-	class TStepIntoRange
+	template<typename ParentRangeCaptureType>
+	class TSlicedRange
 	{
 	public:
-		using ParentRangeType = UnrealRanges::Private::Utils::CapturedValueType<ParentRangeCaptureType>;
-		using ParentRangeIteratorType = UnrealRanges::Private::Utils::RangeIteratorType<ParentRangeType>;
-		using ParentRangeValueType = UnrealRanges::Private::Utils::IteratorValueType<ParentRangeIteratorType>;
-
-		using InnerRangeDirectAccessType = decltype(std::declval<StepIntoFuncType>()(std::declval<ParentRangeValueType>()));
-		using InnerRangeCaptureType = decltype(Private::Utils::Capture(std::declval<InnerRangeDirectAccessType>()));
-		using InnerRangeType = UnrealRanges::Private::Utils::CapturedValueType<InnerRangeCaptureType>;
-		using InnerRangeIteratorType = UnrealRanges::Private::Utils::RangeIteratorType<InnerRangeType>;
-		using InnerRangeValueType = UnrealRanges::Private::Utils::IteratorValueType<InnerRangeIteratorType>;
+		using ParentRangeType = UnrealRanges::Private::Utils::CapturedAccessType<ParentRangeCaptureType>;
+		using ParentRangeIteratorType = Private::Utils::RangeIteratorType<ParentRangeType>;
+		using ValueType = Private::Utils::RangeElementType<ParentRangeType>;
 
+		//NB: Number of elements left is tracked by iterator, so slice end is found without
+		// getting Parent Range iterator for it. This makes possible to slice any ranges
+		// (including Conditional Iterator ranges)
 		class Iterator
 		{
 		public:
 
-			Iterator(
-				ParentRangeIteratorType&& InCurrent, ParentRangeIteratorType&& InEnd,
-				const StepIntoFuncType& InStepIntoFunc)
-				:
-				Current(std::move(InCurrent)), End(std::move(InEnd)),
-				StepIntoFunc(InStepIntoFunc)
-			{
-				if (!IsEnd())
-				{
-					StepIntoUntilSuccess();
-				}
-			}
+			Iterator(const ParentRangeIteratorType& InCurrent, const int InLeftNum)
+				: Current(InCurrent), LeftNum(InLeftNum) { }
 
-			InnerRangeValueType operator*() const
+			decltype(auto) operator*() const
 			{
-				UnrealRanges::Utils::Check(!IsEnd() && !IsInnerEnd());
-
-				return *(InnerState->Current);
+				UnrealRanges::Utils::Check(LeftNum > 0);
+				return *Current;
 			}
 
 			void operator++()
 			{
-				UnrealRanges::Utils::Check(!IsEnd() && !IsInnerEnd());
-				
-				NextInner();
-				
-				if (IsInnerEnd())
-				{
-					Next();
-
-					if (!IsEnd())
-					{
-						StepIntoUntilSuccess();
-					}
-				}
+				UnrealRanges::Utils::Check(LeftNum > 0);
+				++Current;
+				--LeftNum;
 			}
 
 			bool operator!=(const Iterator& Other) const
 			{
-				//NB: No sense to
-				// Logic may be used only for whole range iterations!
-				return (Current != Other.Current);
+				return (LeftNum != Other.LeftNum) && (Current != Other.Current);
 			}
 
-		private:
+			//NB: Operations below are available only if Parent Range iterator is random access.
+			// In this case "LeftNum" is always exact, so it is used for iterators difference
 
-			bool IsEnd() const
+			template<typename IteratorTypeHelper = ParentRangeIteratorType>
+			auto operator+=(const int Num)->std::enable_if_t<
+				Private::Utils::IsRandomAccessIterator<IteratorTypeHelper>(), Iterator&>
 			{
-				return !(Current != End);
+				UnrealRanges::Utils::Check(Num <= LeftNum);
+				Current += Num;
+				LeftNum -= Num;
+				return *this;
 			}
 
-			bool IsInnerEnd() const
+			template<typename IteratorTypeHelper = ParentRangeIteratorType>
+			auto operator-=(const int Num)->std::enable_if_t<
+				Private::Utils::IsRandomAccessIterator<IteratorTypeHelper>(), Iterator&>
 			{
-				return !(InnerState->Current != InnerState->End);
+				Current -= Num;
+				LeftNum += Num;
+				return *this;
 			}
 
-			void StepIntoUntilSuccess()
+			template<typename IteratorTypeHelper = ParentRangeIteratorType>
+			auto operator+(const int Num) const->std::enable_if_t<
+				Private::Utils::IsRandomAccessIterator<IteratorTypeHelper>(), Iterator>
 			{
-				UnrealRanges::Utils::Check(!IsEnd());
-
-				for (StepInto(); !IsEnd() && IsInnerEnd(); Next(), StepInto());
+				Iterator Result{ *this };
+				Result += Num;
+				return Result;
 			}
 
-			void StepInto()
+			template<typename IteratorTypeHelper = ParentRangeIteratorType>
+			auto operator-(const int Num) const->std::enable_if_t<
+				Private::Utils::IsRandomAccessIterator<IteratorTypeHelper>(), Iterator>
 			{
-				UnrealRanges::Utils::Check(!IsEnd());
-
-				InnerState.Reset(StepIntoFunc(*Current));
+				Iterator Result{ *this };
+				Result -= Num;
+				return Result;
 			}
 
-			void Next()
+			template<typename IteratorTypeHelper = ParentRangeIteratorType>
+			auto operator-(const Iterator& Other) const->std::enable_if_t<
+				Private::Utils::IsRandomAccessIterator<IteratorTypeHelper>(), int>
 			{
-				UnrealRanges::Utils::Check(!IsEnd());
-
-				++Current;
+				return Other.LeftNum - LeftNum;
 			}
 
-			void NextInner()
+			template<typename IteratorTypeHelper = ParentRangeIteratorType>
+			auto operator[](const int Index) const->std::enable_if_t<
+				Private::Utils::IsRandomAccessIterator<IteratorTypeHelper>(),
+				Private::Utils::IteratorReferenceType<IteratorTypeHelper>>
 			{
-				UnrealRanges::Utils::Check(!IsEnd() && !IsInnerEnd());
+				UnrealRanges::Utils::Check(Index < LeftNum);
 
-				++(InnerState->Current);
+				ParentRangeIteratorType Indexed{ Current };
+				Indexed += Index;
+				return *Indexed;
 			}
 
+		private:
+
 			ParentRangeIteratorType Current;
-			ParentRangeIteratorType End;
-			StepIntoFuncType StepIntoFunc;
+			int LeftNum;
+		};
 
-			struct FInnerState
+		TSlicedRange(ParentRangeCaptureType&& InRangeCapture, const int InStartIndex, const int InNum)
+			: ParentRangeCapture(std::move(InRangeCapture)), StartIndex(InStartIndex), Num(InNum) { }
+
+		Iterator begin() const
+		{
+			auto Current = UnrealRanges::Utils::RangeBegin(GetRange());
+			const auto End = UnrealRanges::Utils::RangeEnd(GetRange());
+
+			const int SkippedNum = Private::Utils::AdvanceIterator(Current, End, StartIndex);
+			if (SkippedNum < StartIndex)
 			{
-				//NB: Deducted template constructor is used for perfect forwarding here
-				template<typename InnerRangeTypeFF>
-				FInnerState(InnerRangeTypeFF&& InnerRange)
-					:
-					RangeCapture(std::forward<InnerRangeTypeFF>(InnerRange)),
-					Current(RangeCapture.Get().begin()),
-					End(RangeCapture.Get().end())
-				{
-					UnrealRanges::Private::Utils::CheckForwardWorkaround<InnerRangeTypeFF, InnerRangeType>();
-				}
+				return { Current, 0 };
+			}
 
-				InnerRangeCaptureType RangeCapture;
-				InnerRangeIteratorType Current;
-				InnerRangeIteratorType End;
-			};
+			//NB: Exact number of elements is got in constant time for random access iterators, it
+			// makes iterators difference valid. For other iterators "Num" is just upper bound
+			auto LastChecker = Current;
+			const int LeftNum = Private::Utils::IsRandomAccessIterator<ParentRangeIteratorType>() ?
+				Private::Utils::AdvanceIterator(LastChecker, End, Num) : Num;
 
-			UnrealRanges::Private::Utils::TOpaqueOptional<FInnerState> InnerState;
-		};
+			return { Current, LeftNum };
+		}
 
-		//NB: "StepIntoFuncTypeFF" - to cause deducation and make possible to use Fast Forward
-		template<typename StepIntoFuncTypeFF>
-		TStepIntoRange(
-			ParentRangeCaptureType&& InRangeCapture,
-			StepIntoFuncTypeFF&& InStepIntoFunc)
-			:
-			ParentRangeCapture(std::move(InRangeCapture)),
-			StepIntoFunc(std::forward<StepIntoFuncTypeFF>(InStepIntoFunc))
+		Iterator end() const
 		{
-			UnrealRanges::Private::Utils::CheckForwardWorkaround<StepIntoFuncTypeFF, StepIntoFuncType>();
+			return { UnrealRanges::Utils::RangeEnd(GetRange()), 0 };
 		}
 
-		Iterator begin() const
+		template<typename ParentRangeTypeHelper = ParentRangeType>
+		auto Size() const->decltype(UnrealRanges::Utils::RangeSize(std::declval<const ParentRangeTypeHelper&>()))
 		{
-			return
-			{
-				UnrealRanges::Utils::RangeBegin(GetParentRange()),
-				UnrealRanges::Utils::RangeEnd(GetParentRange()),
-				StepIntoFunc
-			};
+			const int ParentSize = UnrealRanges::Utils::RangeSize(GetRange());
+			return std::max(0, std::min(Num, ParentSize - StartIndex));
 		}
 
-		Iterator end() const
+		int MaxSize() const
 		{
-			return
-			{
-				UnrealRanges::Utils::RangeEnd(GetParentRange()),
-				UnrealRanges::Utils::RangeEnd(GetParentRange()),
-				StepIntoFunc
-			};
+			return Num;
 		}
 
-		template<typename NewParentRangeCaptureType>
-		auto Next(NewParentRangeCaptureType&& NewParentRangeCapture)
+		template<typename PassedDownParentRangeType>
+		auto Next(PassedDownParentRangeType&& ParentRangeCapture) const
 		{
-			UnrealRanges::Private::Utils::CheckPassedAsArgCaptureType<decltype(NewParentRangeCapture)>();
+			UnrealRanges::Private::Utils::CheckPassedAsArgCaptureType<decltype(ParentRangeCapture)>();
 
 			auto NextCapture = Capture(
-				GetParentRange().Next(std::forward<NewParentRangeCaptureType>(NewParentRangeCapture))
+				GetRange().Next(std::forward<PassedDownParentRangeType>(ParentRangeCapture))
 			);
 
-			return TStepIntoRange<decltype(NextCapture), StepIntoFuncType>
-			{
-				std::move(NextCapture),
-				StepIntoFunc
-			};
+			return TSlicedRange<decltype(NextCapture)>{ std::move(NextCapture), StartIndex, Num };
 		}
 
 	private:
-		
-		const ParentRangeType& GetParentRange() const
+		ParentRangeType& GetRange() const
 		{
 			return ParentRangeCapture.Get();
 		}
 
 		ParentRangeCaptureType ParentRangeCapture;
-		StepIntoFuncType StepIntoFunc;
+		int StartIndex;
+		int Num;
 	};
 
 	// - - - - - Dummy
 
-	template<class StepIntoFuncType>
-	class TStepIntoRange<UnrealRanges::Private::Utils::DummyType, StepIntoFuncType>
+	template<>
+	class TSlicedRange<Private::Utils::DummyType>
 	{
 	public:
-		TStepIntoRange(const StepIntoFuncType& InStepIntoFunc)
-			:
-			StepIntoFunc(InStepIntoFunc) { }
+		TSlicedRange(const int InStartIndex, const int InNum)
+			: StartIndex(InStartIndex), Num(InNum) { }
 
-		template<typename ParentRangeCaptureType>
-		auto Next(ParentRangeCaptureType&& ParentRangeCapture) const
+		//See details about this begin-end in implementation of
+		// "TFilteredRange<DummyType, PassOnTrueFilterPredicateType>"
+		int* begin() const { return nullptr; }
+		int* end() const { return nullptr; }
+
+		template<typename PassedDownParentRangeType>
+		auto Next(PassedDownParentRangeType&& ParentRangeCapture) const
 		{
 			UnrealRanges::Private::Utils::CheckPassedAsArgCaptureType<decltype(ParentRangeCapture)>();
 
-			return TStepIntoRange<ParentRangeCaptureType, StepIntoFuncType>
+			return TSlicedRange<PassedDownParentRangeType>
 			{
-				std::forward<ParentRangeCaptureType>(ParentRangeCapture),
-				StepIntoFunc
+				std::forward<PassedDownParentRangeType>(ParentRangeCapture), StartIndex, Num
 			};
 		}
 
-		//Next functions - to make depended code happy when compiling intermediate Dummy types.
-		// "for loop" should be never called for Dummies
-		int* begin() const { return nullptr; }
-		int* end() const { return nullptr; }
-
 	private:
-		StepIntoFuncType StepIntoFunc;
+		int StartIndex;
+		int Num;
 	};
 
-	template<typename StepIntoFuncType>
-	auto StepIntoRange(StepIntoFuncType&& StepIntoFunc)
+	// ------------------------------- SlicedRange(StartIndex, Num) ---------------------------------------
+
+	inline auto SlicedRange(const int StartIndex, const int Num)
 	{
-		return TStepIntoRange<Private::Utils::DummyType, std::decay_t<StepIntoFuncType>>
-		{
-			std::forward<StepIntoFuncType>(StepIntoFunc)
-		};
+		UnrealRanges::Utils::Check(StartIndex >= 0 && Num >= 0);
+
+		return TSlicedRange<Private::Utils::DummyType>{ StartIndex, Num };
 	}
 
-	// ================================| Recursive range |=======================================
+	// ================================| Shuffled range |=======================================
 
-	template<typename ValueType, typename StepTransformType>
-	class TRecursiveRange
+	template<typename ParentRangeCaptureType>
+	class TShuffledRange
 	{
 	public:
-		class PseudoIterator
+		using ParentRangeType = UnrealRanges::Private::Utils::CapturedAccessType<ParentRangeCaptureType>;
+		using ParentRangeIteratorType = Private::Utils::RangeIteratorType<ParentRangeType>;
+		using ValueType = Private::Utils::RangeElementType<ParentRangeType>;
+
+		static_assert(Private::Utils::IsRandomAccessIterator<ParentRangeIteratorType>(),
+			"Parent Range of \"ShuffledRange()\" should have random access iterators");
+
+		//NB: Iterator keeps position in shuffled order and maps it to index of Parent Range
+		// element on moving, so dereferencing is constant time
+		class Iterator
 		{
 		public:
 
-			PseudoIterator(const UnrealRanges::Utils::TUnrealRanges_Optional<ValueType>& InCurrent, const StepTransformType& InStepTransform)
-				: Current(InCurrent), StepTransform(InStepTransform)
+			Iterator(const ParentRangeIteratorType& InFirst, const Private::Utils::FIndexPermutation& InPermutation, const int InPosition)
+				: First(InFirst), Permutation(InPermutation), Position(InPosition)
 			{
+				UpdateCurrent();
 			}
 
-			auto operator*() const
+			decltype(auto) operator*() const
 			{
-				UnrealRanges::Utils::Check(UnrealRanges::Utils::IsOptionalSet(Current));
-
-				return UnrealRanges::Utils::GetOptionalValue(Current);
+				return *Current.Get();
 			}
 
 			void operator++()
 			{
-				UnrealRanges::Utils::Check(UnrealRanges::Utils::IsOptionalSet(Current));
-
-				Current = StepTransform(this->operator*());
+				++Position;
+				UpdateCurrent();
 			}
 
-			bool operator!=(const PseudoIterator&) const
+			bool operator!=(const Iterator& Other) const
 			{
-				//NB: End-condition usage only
-				return UnrealRanges::Utils::IsOptionalSet(Current);
+				return (Position != Other.Position);
 			}
 
-		private:
-			UnrealRanges::Utils::TUnrealRanges_Optional<ValueType> Current;
-			StepTransformType StepTransform;
-		};
-
-		//NB: "StepTransformTypeFF" - to cause deducation and make possible to use Fast Forward
-		template<typename StepTransformTypeFF>
-		TRecursiveRange(ValueType InRootValue, StepTransformTypeFF&& InStepTransform)
-			: RootValue(InRootValue), StepTransform(std::forward<StepTransformTypeFF>(InStepTransform))
-		{
-			UnrealRanges::Private::Utils::CheckForwardWorkaround<StepTransformTypeFF, StepTransformType>();
-		}
-
-		PseudoIterator begin() const
-		{
-			return { UnrealRanges::Utils::MakeOptional(RootValue), StepTransform };
-		}
-
-		PseudoIterator end() const
-		{
-			return { UnrealRanges::Utils::MakeOptional<ValueType>(), StepTransform };
-		}
-
-	private:
-		ValueType RootValue;
-		StepTransformType StepTransform;
-	};
-
-	// -------------------------------- RecursiveRange() ----------------------------------------
-
-	template<typename ValueType, typename StepTransformType>
-	auto RecursiveRange(ValueType RootValue, StepTransformType&& StepTransform)
-	{
-		return TRecursiveRange<ValueType, std::decay_t<StepTransformType>>{ RootValue, std::forward<StepTransformType>(StepTransform) };
-	}
-
-	// ========================| Conditional iterator range |==================================
-
-	// --------------------- TConditionalIteratorRange<> class --------------------------------
-
-	template<typename ConditionalIteratorType>
-	class TConditionalIteratorRange
-	{
-	public:
-		using ValueType = UnrealRanges::Private::Utils::DereferencedType<ConditionalIteratorType>;
-
-		//NB: This is NOT actualy iterator, it cannot be used as iterator.
-		// Comparation operator is implemented to correspond range based cycles idiom.
-		//
-		// This is how Begin-End Based usage ranges looks:
-		//
-		//   for (Iter current = range.begin(); current != range.end(); ++current) { ... }
-		//
-		// And this is how Conditional Based iterators usage looks:
-		//
-		//   for (ConditionalIterator current = begin(); (bool)current; ++current) { ... } 
-		//
-		// Unfortunaly, we MAY HAVE NO WAY to get "end()" iterator for ConditionalIterator.
-		// So, we should make some kind of workaround to make Conditional Based iterators
-		// "behave like" Begin-End based.
-		//
-		// Iterators of Begin-End Based ranges uses "operator!=()" to check when cycle
-		// should be finished, by checking "current != range.end()". It should return "false"
-		// (saying "loop stop") when "current" is pointing to range end. For Conditional Based
-		// iterators "loop stop" should be performed for condition "!current".
-		// 
-		// So, we may assume that "operator!=()" should just return "false" when
-		// Conditional Based iterator wrapped by our Begin-End Based range adopter return "false"
-		// on casting to boolean to stop the loop. Value passed as argument (for loop end checking)
-		// will be just ignored in such usage.
-		//
-		class PseudoIterator
-		{
-		public:
-
-			PseudoIterator(const ConditionalIteratorType& InCurrent)
-				: Current(InCurrent) { }
-
-			PseudoIterator()
-				: Current() { }
+			Iterator& operator+=(const int Num)
+			{
+				Position += Num;
+				UpdateCurrent();
+				return *this;
+			}
 
-			auto operator*() const
+			Iterator& operator-=(const int Num)
 			{
-				UnrealRanges::Utils::Check(!IsEnd());
-				return *Current;
+				Position -= Num;
+				UpdateCurrent();
+				return *this;
 			}
 
-			void operator++()
+			Iterator operator+(const int Num) const
 			{
-				++Current;
+				Iterator Result{ *this };
+				Result += Num;
+				return Result;
 			}
 
-			//NB: DON'T use as actual iterator comparator!
-			// Just check if "Current" is not end. See description above for details
-			bool operator!=(const PseudoIterator&) const
+			Iterator operator-(const int Num) const
 			{
-				return !IsEnd();
+				Iterator Result{ *this };
+				Result -= Num;
+				return Result;
 			}
 
-		private:
-			void Next()
+			int operator-(const Iterator& Other) const
 			{
-				UnrealRanges::Utils::Check(!IsEnd());
-				++Current;
+				return Position - Other.Position;
 			}
 
-			bool IsEnd() const
+		private:
+			void UpdateCurrent()
 			{
-				return !Current;
+				if (Position < Permutation.GetNum())
+				{
+					//NB: Iterator is constructed in place of the previous one - Parent Range
+					// iterators may be not assignable (for example, third party ones)
+					Current = Private::Utils::TAssignableValue<ParentRangeIteratorType>{
+						First + Permutation(Position) };
+				}
 			}
 
-			ConditionalIteratorType Current;
+			ParentRangeIteratorType First;
+			Private::Utils::TAssignableValue<ParentRangeIteratorType> Current{ First };
+			Private::Utils::FIndexPermutation Permutation;
+			int Position;
 		};
 
-		//NB: "ConditionalIteratorTypeFF" - to cause deducation and make possible to use Fast Forward
-		template<typename ConditionalIteratorTypeFF>
-		TConditionalIteratorRange(ConditionalIteratorTypeFF&& InBeginConditionalIterator)
-			: BeginConditionalIterator(std::forward<ConditionalIteratorTypeFF>(InBeginConditionalIterator))
-		{
-			UnrealRanges::Private::Utils::CheckForwardWorkaround<ConditionalIteratorTypeFF, ConditionalIteratorType>();
-		}
+		TShuffledRange(ParentRangeCaptureType&& InRangeCapture, const unsigned int InSeed)
+			: ParentRangeCapture(std::move(InRangeCapture)), Seed(InSeed) { }
 
-		PseudoIterator begin() const
+		Iterator begin() const
 		{
-			return { BeginConditionalIterator };
+			return { UnrealRanges::Utils::RangeBegin(GetRange()), GetPermutation(), 0 };
 		}
 
-		//NB: Should be not used directly because comparation with "end()" is not used
-		// at all in this range type. See description above for details
-		PseudoIterator end() const
+		Iterator end() const
 		{
-			return { BeginConditionalIterator };
+			const Private::Utils::FIndexPermutation Permutation = GetPermutation();
+			return { UnrealRanges::Utils::RangeBegin(GetRange()), Permutation, Permutation.GetNum() };
 		}
 
-	private:
-		ConditionalIteratorType BeginConditionalIterator;
-	};
-
-	// --------------- ConditionalIteratorRange<...>(ConditionalIterator) ---------------------
-
-	template<typename ConditionalIteratorType>
-	auto ConditionalIteratorRange(ConditionalIteratorType&& ConditionalIterator)
-	{
-		return TConditionalIteratorRange<std::decay_t<ConditionalIteratorType>>
+		template<typename ParentRangeTypeHelper = ParentRangeType>
+		auto Size() const->decltype(UnrealRanges::Utils::RangeSize(std::declval<const ParentRangeTypeHelper&>()))
 		{
-			std::forward<ConditionalIteratorType>(ConditionalIterator)
-		};
-	}
-
-	// ========================| Conditional iterator range |==================================
-
-	// ------------------- EnumValuesRange ------------------
-
-	template<typename EnumType>
-	class TEnumConditionalIterator
-	{
-	public:
-		TEnumConditionalIterator(const EnumType InStartValue, const EnumType InEndValue)
-			: CurrentValue(InStartValue), EndValue(InEndValue) { }
+			return UnrealRanges::Utils::RangeSize(GetRange());
+		}
 
-		EnumType operator*() const
+		template<typename ParentRangeTypeHelper = ParentRangeType>
+		auto MaxSize() const->decltype(UnrealRanges::Utils::RangeMaxSize(std::declval<const ParentRangeTypeHelper&>()))
 		{
-			UnrealRanges::Utils::Check(!IsEnd());
-			return CurrentValue;
+			return UnrealRanges::Utils::RangeMaxSize(GetRange());
 		}
 
-		void operator++()
+		template<typename PassedDownParentRangeType>
+		auto Next(PassedDownParentRangeType&& ParentRangeCapture) const
 		{
-			UnrealRanges::Utils::Check(!IsEnd());
-			CurrentValue = NextEnum(CurrentValue);
+			UnrealRanges::Private::Utils::CheckPassedAsArgCaptureType<decltype(ParentRangeCapture)>();
+
+			auto NextCapture = Capture(
+				GetRange().Next(std::forward<PassedDownParentRangeType>(ParentRangeCapture))
+			);
+
+			return TShuffledRange<decltype(NextCapture)>{ std::move(NextCapture), Seed };
 		}
 
-		operator bool() const
+	private:
+		ParentRangeType& GetRange() const
 		{
-			return IsEnd();
+			return ParentRangeCapture.Get();
 		}
 
-	private:
-		bool IsEnd() const
+		//NB: Number of elements is got by iterators difference - it's constant time for random access iterators
+		Private::Utils::FIndexPermutation GetPermutation() const
 		{
-			return (CurrentValue != EndValue);
+			const int Num = static_cast<int>(UnrealRanges::Utils::RangeEnd(GetRange()) - UnrealRanges::Utils::RangeBegin(GetRange()));
+			return { Num, Seed };
 		}
 
-		EnumType CurrentValue;
-		const EnumType EndValue;
+		ParentRangeCaptureType ParentRangeCapture;
+		unsigned int Seed;
 	};
 
-	template<typename EnumType>
-	auto EnumValuesRange(const EnumType StartValue, const EnumType EndValue)
-	{
-		using FEnumIteratorType = TEnumConditionalIterator<EnumType>;
-		return ConditionalIteratorRange(FEnumIteratorType{ StartValue, EndValue });
-	}
-
-	// ===============================| Conditional range |========================================
+	// - - - - - Dummy
 
-	namespace TemplateDetails
+	template<>
+	class TShuffledRange<Private::Utils::DummyType>
 	{
-		namespace TConditionalRange
-		{
-			template<typename ParentRangeCaptureType, typename TargetRangeCaptureType>
+	public:
+		TShuffledRange(const unsigned int InSeed)
+			: Seed(InSeed) { }
+
+		//See details about this begin-end in implementation of
+		// "TFilteredRange<DummyType, PassOnTrueFilterPredicateType>"
+		int* begin() const { return nullptr; }
+		int* end() const { return nullptr; }
+
+		template<typename PassedDownParentRangeType>
+		auto Next(PassedDownParentRangeType&& ParentRangeCapture) const
+		{
+			UnrealRanges::Private::Utils::CheckPassedAsArgCaptureType<decltype(ParentRangeCapture)>();
+
+			return TShuffledRange<PassedDownParentRangeType>
+			{
+				std::forward<PassedDownParentRangeType>(ParentRangeCapture), Seed
+			};
+		}
+
+	private:
+		unsigned int Seed;
+	};
+
+	// ------------------------------- ShuffledRange([Seed]) ---------------------------------------
+
+	inline auto ShuffledRange(const unsigned int Seed)
+	{
+		return TShuffledRange<Private::Utils::DummyType>{ Seed };
+	}
+
+	inline auto ShuffledRange()
+	{
+		//NB: Seed is combined from two halves - "Rand()" range should not overflow "int"
+		const unsigned int Seed =
+			(static_cast<unsigned int>(UnrealRanges::Utils::Rand(0, 0xFFFF)) << 16) |
+			static_cast<unsigned int>(UnrealRanges::Utils::Rand(0, 0xFFFF));
+
+		return ShuffledRange(Seed);
+	}
+
+	// ================================| Step into range |=======================================
+
+	template<class ParentRangeCaptureType, class StepIntoFuncType>
+	class TStepIntoRange
+	{
+	public:
+		using ParentRangeType = UnrealRanges::Private::Utils::CapturedAccessType<ParentRangeCaptureType>;
+		using ParentRangeIteratorType = UnrealRanges::Private::Utils::RangeIteratorType<ParentRangeType>;
+		using ParentRangeValueType = UnrealRanges::Private::Utils::IteratorValueType<ParentRangeIteratorType>;
+		using ParentRangeReferenceType = UnrealRanges::Private::Utils::IteratorReferenceType<ParentRangeIteratorType>;
+
+		using InnerRangeDirectAccessType = decltype(std::declval<StepIntoFuncType>()(std::declval<ParentRangeReferenceType>()));
+		using InnerRangeCaptureType = decltype(Private::Utils::Capture(std::declval<InnerRangeDirectAccessType>()));
+		using InnerRangeType = UnrealRanges::Private::Utils::CapturedAccessType<InnerRangeCaptureType>;
+		using InnerRangeIteratorType = UnrealRanges::Private::Utils::RangeIteratorType<InnerRangeType>;
+		using InnerRangeValueType = UnrealRanges::Private::Utils::IteratorValueType<InnerRangeIteratorType>;
+
+		class Iterator
+		{
+		public:
+
+			Iterator(
+				ParentRangeIteratorType&& InCurrent, ParentRangeIteratorType&& InEnd,
+				const StepIntoFuncType& InStepIntoFunc)
+				:
+				Current(std::move(InCurrent)), End(std::move(InEnd)),
+				StepIntoFunc(InStepIntoFunc)
+			{
+				if (!IsEnd())
+				{
+					StepIntoUntilSuccess();
+				}
+			}
+
+			decltype(auto) operator*() const
+			{
+				UnrealRanges::Utils::Check(!IsEnd() && !IsInnerEnd());
+
+				return *(InnerState->Current);
+			}
+
+			void operator++()
+			{
+				UnrealRanges::Utils::Check(!IsEnd() && !IsInnerEnd());
+				
+				NextInner();
+				
+				if (IsInnerEnd())
+				{
+					Next();
+
+					if (!IsEnd())
+					{
+						StepIntoUntilSuccess();
+					}
+				}
+			}
+
+			bool operator!=(const Iterator& Other) const
+			{
+				//NB: No sense to
+				// Logic may be used only for whole range iterations!
+				return (Current != Other.Current);
+			}
+
+		private:
+
+			bool IsEnd() const
+			{
+				return !(Current != End);
+			}
+
+			bool IsInnerEnd() const
+			{
+				return !(InnerState->Current != InnerState->End);
+			}
+
+			void StepIntoUntilSuccess()
+			{
+				UnrealRanges::Utils::Check(!IsEnd());
+
+				for (StepInto(); !IsEnd() && IsInnerEnd(); Next(), StepInto());
+			}
+
+			void StepInto()
+			{
+				UnrealRanges::Utils::Check(!IsEnd());
+
+				InnerState.Reset(StepIntoFunc(*Current));
+			}
+
+			void Next()
+			{
+				UnrealRanges::Utils::Check(!IsEnd());
+
+				++Current;
+			}
+
+			void NextInner()
+			{
+				UnrealRanges::Utils::Check(!IsEnd() && !IsInnerEnd());
+
+				++(InnerState->Current);
+			}
+
+			ParentRangeIteratorType Current;
+			ParentRangeIteratorType End;
+			StepIntoFuncType StepIntoFunc;
+
+			struct FInnerState
+			{
+				//NB: Deducted template constructor is used for perfect forwarding here
+				template<typename InnerRangeTypeFF>
+				FInnerState(InnerRangeTypeFF&& InnerRange)
+					:
+					RangeCapture(std::forward<InnerRangeTypeFF>(InnerRange)),
+					Current(UnrealRanges::Utils::RangeBegin(RangeCapture.Get())),
+					End(UnrealRanges::Utils::RangeEnd(RangeCapture.Get()))
+				{
+					UnrealRanges::Private::Utils::CheckForwardWorkaround<InnerRangeTypeFF, InnerRangeType>();
+				}
+
+				InnerRangeCaptureType RangeCapture;
+				InnerRangeIteratorType Current;
+				InnerRangeIteratorType End;
+			};
+
+			UnrealRanges::Private::Utils::TOpaqueOptional<FInnerState> InnerState;
+		};
+
+		//NB: "StepIntoFuncTypeFF" - to cause deducation and make possible to use Fast Forward
+		template<typename StepIntoFuncTypeFF>
+		TStepIntoRange(
+			ParentRangeCaptureType&& InRangeCapture,
+			StepIntoFuncTypeFF&& InStepIntoFunc)
+			:
+			ParentRangeCapture(std::move(InRangeCapture)),
+			StepIntoFunc(std::forward<StepIntoFuncTypeFF>(InStepIntoFunc))
+		{
+			UnrealRanges::Private::Utils::CheckForwardWorkaround<StepIntoFuncTypeFF, StepIntoFuncType>();
+		}
+
+		Iterator begin() const
+		{
+			return
+			{
+				UnrealRanges::Utils::RangeBegin(GetParentRange()),
+				UnrealRanges::Utils::RangeEnd(GetParentRange()),
+				StepIntoFunc
+			};
+		}
+
+		Iterator end() const
+		{
+			return
+			{
+				UnrealRanges::Utils::RangeEnd(GetParentRange()),
+				UnrealRanges::Utils::RangeEnd(GetParentRange()),
+				StepIntoFunc
+			};
+		}
+
+		//NB: Inner Range is iterated in place for each Parent Range element, without
+		// storing it inside the iterator
+		template<typename SinkType>
+		bool ForEachWhile(const SinkType& Sink) const
+		{
+			StepIntoFuncType StepIntoFuncCopy = StepIntoFunc;
+
+			return UnrealRanges::Utils::RangeForEachWhile(GetParentRange(),
+				[&StepIntoFuncCopy, &Sink](auto&& ParentElement)
+				{
+					const auto InnerRangeCapture = Private::Utils::Capture(
+						StepIntoFuncCopy(std::forward<decltype(ParentElement)>(ParentElement)));
+
+					return UnrealRanges::Utils::RangeForEachWhile(InnerRangeCapture.Get(), Sink);
+				});
+		}
+
+		//NB: Available only if Parent Range is splittable. Inner ranges of parts of
+		// Parent Range are parts of this Range
+		template<typename ParentRangeTypeHelper = ParentRangeType>
+		auto Split(const int PartsNum) const->std::vector<TStepIntoRange<
+			UnrealRanges::Private::Utils::RangePartCaptureType<ParentRangeTypeHelper>, StepIntoFuncType>>
+		{
+			std::vector<TStepIntoRange<
+				UnrealRanges::Private::Utils::RangePartCaptureType<ParentRangeTypeHelper>, StepIntoFuncType>> Parts;
+
+			auto ParentParts = UnrealRanges::Utils::RangeSplit(GetParentRange(), PartsNum);
+			Parts.reserve(ParentParts.size());
+
+			for (auto& ParentPart : ParentParts)
+			{
+				Parts.push_back({ UnrealRanges::Private::Utils::Capture(std::move(ParentPart)), StepIntoFunc });
+			}
+
+			return Parts;
+		}
+
+		template<typename NewParentRangeCaptureType>
+		auto Next(NewParentRangeCaptureType&& NewParentRangeCapture) const
+		{
+			UnrealRanges::Private::Utils::CheckPassedAsArgCaptureType<decltype(NewParentRangeCapture)>();
+
+			auto NextCapture = Capture(
+				GetParentRange().Next(std::forward<NewParentRangeCaptureType>(NewParentRangeCapture))
+			);
+
+			return TStepIntoRange<decltype(NextCapture), StepIntoFuncType>
+			{
+				std::move(NextCapture),
+				StepIntoFunc
+			};
+		}
+
+		//NB: Parent Range is available for algorithms that estimate number of elements
+		// (like parallel algorithms choosing number of chunks)
+		ParentRangeType& GetParentRange() const
+		{
+			return ParentRangeCapture.Get();
+		}
+
+	private:
+
+		ParentRangeCaptureType ParentRangeCapture;
+		StepIntoFuncType StepIntoFunc;
+	};
+
+	// - - - - - Dummy
+
+	template<class StepIntoFuncType>
+	class TStepIntoRange<UnrealRanges::Private::Utils::DummyType, StepIntoFuncType>
+	{
+	public:
+		TStepIntoRange(const StepIntoFuncType& InStepIntoFunc)
+			:
+			StepIntoFunc(InStepIntoFunc) { }
+
+		template<typename ParentRangeCaptureType>
+		auto Next(ParentRangeCaptureType&& ParentRangeCapture) const
+		{
+			UnrealRanges::Private::Utils::CheckPassedAsArgCaptureType<decltype(ParentRangeCapture)>();
+
+			return TStepIntoRange<ParentRangeCaptureType, StepIntoFuncType>
+			{
+				std::forward<ParentRangeCaptureType>(ParentRangeCapture),
+				StepIntoFunc
+			};
+		}
+
+		//Next functions - to make depended code happy when compiling intermediate Dummy types.
+		// "for loop" should be never called for Dummies
+		int* begin() const { return nullptr; }
+		int* end() const { return nullptr; }
+
+	private:
+		StepIntoFuncType StepIntoFunc;
+	};
+
+	template<typename StepIntoFuncType>
+	auto StepIntoRange(StepIntoFuncType&& StepIntoFunc)
+	{
+		return TStepIntoRange<Private::Utils::DummyType, std::decay_t<StepIntoFuncType>>
+		{
+			std::forward<StepIntoFuncType>(StepIntoFunc)
+		};
+	}
+
+	// ================================| Recursive range |=======================================
+
+	template<typename ValueType, typename StepTransformType>
+	class TRecursiveRange
+	{
+	public:
+		class PseudoIterator
+		{
+		public:
+
+			PseudoIterator(const UnrealRanges::Utils::TUnrealRanges_Optional<ValueType>& InCurrent, const StepTransformType& InStepTransform)
+				: Current(InCurrent), StepTransform(InStepTransform)
+			{
+			}
+
+			auto operator*() const
+			{
+				UnrealRanges::Utils::Check(UnrealRanges::Utils::IsOptionalSet(Current));
+
+				return UnrealRanges::Utils::GetOptionalValue(Current);
+			}
+
+			void operator++()
+			{
+				UnrealRanges::Utils::Check(UnrealRanges::Utils::IsOptionalSet(Current));
+
+				Current = StepTransform(this->operator*());
+			}
+
+			bool operator!=(const PseudoIterator&) const
+			{
+				//NB: End-condition usage only
+				return UnrealRanges::Utils::IsOptionalSet(Current);
+			}
+
+		private:
+			UnrealRanges::Utils::TUnrealRanges_Optional<ValueType> Current;
+			StepTransformType StepTransform;
+		};
+
+		//NB: "StepTransformTypeFF" - to cause deducation and make possible to use Fast Forward
+		template<typename StepTransformTypeFF>
+		TRecursiveRange(ValueType InRootValue, StepTransformTypeFF&& InStepTransform)
+			: RootValue(InRootValue), StepTransform(std::forward<StepTransformTypeFF>(InStepTransform))
+		{
+			UnrealRanges::Private::Utils::CheckForwardWorkaround<StepTransformTypeFF, StepTransformType>();
+		}
+
+		PseudoIterator begin() const
+		{
+			return { UnrealRanges::Utils::MakeOptional(RootValue), StepTransform };
+		}
+
+		PseudoIterator end() const
+		{
+			return { UnrealRanges::Utils::MakeOptional<ValueType>(), StepTransform };
+		}
+
+	private:
+		ValueType RootValue;
+		StepTransformType StepTransform;
+	};
+
+	// -------------------------------- RecursiveRange() ----------------------------------------
+
+	template<typename ValueType, typename StepTransformType>
+	auto RecursiveRange(ValueType RootValue, StepTransformType&& StepTransform)
+	{
+		return TRecursiveRange<ValueType, std::decay_t<StepTransformType>>{ RootValue, std::forward<StepTransformType>(StepTransform) };
+	}
+
+	// ========================| Conditional iterator range |==================================
+
+	// --------------------- TConditionalIteratorRange<> class --------------------------------
+
+	template<typename ConditionalIteratorType>
+	class TConditionalIteratorRange
+	{
+	public:
+		using ValueType = UnrealRanges::Private::Utils::DereferencedType<ConditionalIteratorType>;
+
+		//NB: This is NOT actualy iterator, it cannot be used as iterator.
+		// Comparation operator is implemented to correspond range based cycles idiom.
+		//
+		// This is how Begin-End Based usage ranges looks:
+		//
+		//   for (Iter current = range.begin(); current != range.end(); ++current) { ... }
+		//
+		// And this is how Conditional Based iterators usage looks:
+		//
+		//   for (ConditionalIterator current = begin(); (bool)current; ++current) { ... } 
+		//
+		// Unfortunaly, we MAY HAVE NO WAY to get "end()" iterator for ConditionalIterator.
+		// So, we should make some kind of workaround to make Conditional Based iterators
+		// "behave like" Begin-End based.
+		//
+		// Iterators of Begin-End Based ranges uses "operator!=()" to check when cycle
+		// should be finished, by checking "current != range.end()". It should return "false"
+		// (saying "loop stop") when "current" is pointing to range end. For Conditional Based
+		// iterators "loop stop" should be performed for condition "!current".
+		// 
+		// So, we may assume that "operator!=()" should just return "false" when
+		// Conditional Based iterator wrapped by our Begin-End Based range adopter return "false"
+		// on casting to boolean to stop the loop. Value passed as argument (for loop end checking)
+		// will be just ignored in such usage.
+		//
+		class PseudoIterator
+		{
+		public:
+
+			PseudoIterator(const ConditionalIteratorType& InCurrent)
+				: Current(InCurrent) { }
+
+			PseudoIterator()
+				: Current() { }
+
+			decltype(auto) operator*() const
+			{
+				UnrealRanges::Utils::Check(!IsEnd());
+				return *Current;
+			}
+
+			void operator++()
+			{
+				++Current;
+			}
+
+			//NB: DON'T use as actual iterator comparator!
+			// Just check if "Current" is not end. See description above for details
+			bool operator!=(const PseudoIterator&) const
+			{
+				return !IsEnd();
+			}
+
+		private:
+			void Next()
+			{
+				UnrealRanges::Utils::Check(!IsEnd());
+				++Current;
+			}
+
+			bool IsEnd() const
+			{
+				return !Current;
+			}
+
+			ConditionalIteratorType Current;
+		};
+
+		//NB: "ConditionalIteratorTypeFF" - to cause deducation and make possible to use Fast Forward
+		template<typename ConditionalIteratorTypeFF>
+		TConditionalIteratorRange(ConditionalIteratorTypeFF&& InBeginConditionalIterator)
+			: BeginConditionalIterator(std::forward<ConditionalIteratorTypeFF>(InBeginConditionalIterator))
+		{
+			UnrealRanges::Private::Utils::CheckForwardWorkaround<ConditionalIteratorTypeFF, ConditionalIteratorType>();
+		}
+
+		PseudoIterator begin() const
+		{
+			return { BeginConditionalIterator };
+		}
+
+		//NB: Should be not used directly because comparation with "end()" is not used
+		// at all in this range type. See description above for details
+		PseudoIterator end() const
+		{
+			return { BeginConditionalIterator };
+		}
+
+		//NB: Available only if Conditional Iterator may tell number of elements left
+		template<typename ConditionalIteratorTypeHelper = ConditionalIteratorType>
+		auto Size() const->decltype(static_cast<int>(std::declval<const ConditionalIteratorTypeHelper&>().RemainingNum()))
+		{
+			return static_cast<int>(BeginConditionalIterator.RemainingNum());
+		}
+
+	private:
+		ConditionalIteratorType BeginConditionalIterator;
+	};
+
+	// --------------- ConditionalIteratorRange<...>(ConditionalIterator) ---------------------
+
+	template<typename ConditionalIteratorType>
+	auto ConditionalIteratorRange(ConditionalIteratorType&& ConditionalIterator)
+	{
+		return TConditionalIteratorRange<std::decay_t<ConditionalIteratorType>>
+		{
+			std::forward<ConditionalIteratorType>(ConditionalIterator)
+		};
+	}
+
+	// ========================| Conditional iterator range |==================================
+
+	// ------------------- EnumValuesRange ------------------
+
+	template<typename EnumType>
+	class TEnumConditionalIterator
+	{
+	public:
+		TEnumConditionalIterator(const EnumType InStartValue, const EnumType InEndValue)
+			: CurrentValue(InStartValue), EndValue(InEndValue) { }
+
+		EnumType operator*() const
+		{
+			UnrealRanges::Utils::Check(!IsEnd());
+			return CurrentValue;
+		}
+
+		void operator++()
+		{
+			UnrealRanges::Utils::Check(!IsEnd());
+			CurrentValue = UnrealRanges::Utils::NextEnum(CurrentValue);
+		}
+
+		operator bool() const
+		{
+			return !IsEnd();
+		}
+
+		int RemainingNum() const
+		{
+			return UnrealRanges::Utils::EnumValuesNum(CurrentValue, EndValue);
+		}
+
+	private:
+		bool IsEnd() const
+		{
+			return (CurrentValue == EndValue);
+		}
+
+		EnumType CurrentValue;
+		const EnumType EndValue;
+	};
+
+	template<typename EnumType>
+	auto EnumValuesRange(const EnumType StartValue, const EnumType EndValue)
+	{
+		using FEnumIteratorType = TEnumConditionalIterator<EnumType>;
+		return ConditionalIteratorRange(FEnumIteratorType{ StartValue, EndValue });
+	}
+
+	// ===============================| Conditional range |========================================
+
+	namespace TemplateDetails
+	{
+		namespace TConditionalRange
+		{
+			template<typename ParentRangeType, typename TargetRangeType>
 			void CheckIsTypeConsistent()
 			{
-				using namespace Private::Utils;
+				using namespace Private::Utils;
+
+				using ParentRangeElementType = RangeElementType<ParentRangeType>;
+				using TargetRangeElementType = RangeElementType<TargetRangeType>;
+
+				static_assert(IsSame<ParentRangeElementType, TargetRangeElementType>(), "Unconsistant types passed");
+			}
+
+			//NB: Target Range-Part captured by reference is shared by copies, owned
+			// Target Range-Part is copied (only for applying of not temporary Conditional Range)
+			template<typename TargetStageType>
+			Private::Utils::TValueCapture_Ref<TargetStageType> CopyStage(const Private::Utils::TValueCapture_Ref<TargetStageType>& TargetStageCapture)
+			{
+				return TargetStageCapture;
+			}
+
+			template<typename TargetStageType>
+			Private::Utils::TValueCapture_Copy<TargetStageType> CopyStage(const Private::Utils::TValueCapture_Copy<TargetStageType>& TargetStageCapture)
+			{
+				return TargetStageType(TargetStageCapture.Get());
+			}
+		}
+	};
+
+	//NB: Parent Range is owned by Conditional Range (or referenced, if it is referenced
+	// by capture), Target Range is applied to reference to this Parent Range. So, instead
+	// of sharing of Parent Range, Target Range is applied again when Conditional Range is
+	// moved or copied
+	template<typename ParentRangeCaptureType, typename TargetStageCaptureType>
+	class TConditionalRange
+	{
+	public:
+		using ParentRangeType = Private::Utils::CapturedAccessType<ParentRangeCaptureType>;
+		using TargetStageType = Private::Utils::CapturedAccessType<TargetStageCaptureType>;
+		using TargetRangeType = decltype(std::declval<TargetStageType&>().Next(
+			std::declval<Private::Utils::TValueCapture_Ref<ParentRangeType>>()));
+		using ParentRangeIteratorType = Private::Utils::RangeIteratorType<ParentRangeType>;
+		using TargetRangeIteratorType = Private::Utils::RangeIteratorType<const TargetRangeType>;
+		using ValueType = Private::Utils::RangeElementType<ParentRangeType>;
+
+		//NB: Flag is checked on each step of iterating. Algorithms of this library use
+		// "Visit()" (see "UnrealRanges::Utils::RangeVisit()") - flag is checked once,
+		// and loop is performed over the used Range directly
+		class Iterator
+		{
+		public:
+
+			Iterator(ParentRangeIteratorType InParentCurrent, TargetRangeIteratorType InTargetCurrent, bool bInUseTarget)
+				: bUseTarget(bInUseTarget), ParentCurrent(InParentCurrent), TargetCurrent(InTargetCurrent)
+			{
+			}
+
+			//NB: Element is accessed by reference only if both ranges give access to
+			// elements by compatible references
+			decltype(auto) operator*() const
+			{
+				return bUseTarget ? *TargetCurrent : *ParentCurrent;
+			}
+
+			void operator++()
+			{
+				if (bUseTarget)
+				{
+					++TargetCurrent;
+				}
+				else
+				{
+					++ParentCurrent;
+				}
+			}
+
+			bool operator!=(const Iterator& Other) const
+			{
+				return bUseTarget ?
+					(TargetCurrent != Other.TargetCurrent) :
+					(ParentCurrent != Other.ParentCurrent);
+			}
+
+		private:
+
+			bool bUseTarget;
+			ParentRangeIteratorType ParentCurrent;
+			TargetRangeIteratorType TargetCurrent;
+		};
+
+		TConditionalRange(ParentRangeCaptureType&& InParentRangeCapture, TargetStageCaptureType&& InTargetStageCapture, bool bInUseTarget) :
+			bUseTarget(bInUseTarget),
+			ParentRangeCapture(std::move(InParentRangeCapture)),
+			TargetStageCapture(std::move(InTargetStageCapture)),
+			TargetRange(ApplyTargetStage())
+		{
+			TemplateDetails::TConditionalRange::CheckIsTypeConsistent<ParentRangeType, TargetRangeType>();
+		}
+
+		TConditionalRange(TConditionalRange&& Other) :
+			bUseTarget(Other.bUseTarget),
+			ParentRangeCapture(std::move(Other.ParentRangeCapture)),
+			TargetStageCapture(std::move(Other.TargetStageCapture)),
+			TargetRange(ApplyTargetStage()) { }
+
+		TConditionalRange(const TConditionalRange&) = delete; //Ranges are only moved (as value captures), so copy should be never used
+
+		Iterator begin() const
+		{
+			return {
+				UnrealRanges::Utils::RangeBegin(GetParentRange()),
+				UnrealRanges::Utils::RangeBegin(TargetRange),
+				bUseTarget
+			};
+		}
+
+		Iterator end() const
+		{
+			return {
+				UnrealRanges::Utils::RangeEnd(GetParentRange()),
+				UnrealRanges::Utils::RangeEnd(TargetRange),
+				bUseTarget
+			};
+		}
+
+		// Calls "Func({UsedRange})" for Target Range if it is used, for Parent Range otherwise
+		template<typename FuncType>
+		decltype(auto) Visit(FuncType&& Func) const
+		{
+			if (bUseTarget)
+			{
+				return Func(TargetRange);
+			}
+
+			return Func(GetParentRange());
+		}
+
+		//NB: Used Range is chosen once, elements are pushed by the used Range itself
+		template<typename SinkType>
+		bool ForEachWhile(const SinkType& Sink) const
+		{
+			return Visit([&Sink](const auto& UsedRange)
+			{
+				return UnrealRanges::Utils::RangeForEachWhile(UsedRange, Sink);
+			});
+		}
+
+		//NB: Available only if both Parent and Target Ranges are sized
+		template<typename ParentRangeTypeHelper = ParentRangeType, typename TargetRangeTypeHelper = TargetRangeType>
+		auto Size() const->decltype(
+			UnrealRanges::Utils::RangeSize(std::declval<const ParentRangeTypeHelper&>()),
+			UnrealRanges::Utils::RangeSize(std::declval<const TargetRangeTypeHelper&>()))
+		{
+			return bUseTarget ?
+				UnrealRanges::Utils::RangeSize(TargetRange) :
+				UnrealRanges::Utils::RangeSize(GetParentRange());
+		}
+
+		template<typename ParentRangeTypeHelper = ParentRangeType, typename TargetRangeTypeHelper = TargetRangeType>
+		auto MaxSize() const->decltype(
+			UnrealRanges::Utils::RangeMaxSize(std::declval<const ParentRangeTypeHelper&>()),
+			UnrealRanges::Utils::RangeMaxSize(std::declval<const TargetRangeTypeHelper&>()))
+		{
+			return bUseTarget ?
+				UnrealRanges::Utils::RangeMaxSize(TargetRange) :
+				UnrealRanges::Utils::RangeMaxSize(GetParentRange());
+		}
+
+		template<typename PassedDownParentRangeType>
+		auto Next(PassedDownParentRangeType&& ParentRangeCapture) const&
+		{
+			return NextWithTargetStage(std::forward<PassedDownParentRangeType>(ParentRangeCapture),
+				TemplateDetails::TConditionalRange::CopyStage(TargetStageCapture));
+		}
+
+		template<typename PassedDownParentRangeType>
+		auto Next(PassedDownParentRangeType&& ParentRangeCapture) &&
+		{
+			return NextWithTargetStage(std::forward<PassedDownParentRangeType>(ParentRangeCapture),
+				std::move(TargetStageCapture));
+		}
+
+	private:
+		template<typename PassedDownParentRangeType>
+		auto NextWithTargetStage(PassedDownParentRangeType&& ParentRangeCapture, TargetStageCaptureType&& NextTargetStageCapture) const
+		{
+			UnrealRanges::Private::Utils::CheckPassedAsArgCaptureType<decltype(ParentRangeCapture)>();
+
+			auto NextParentRangeCapture = Capture(
+				GetParentRange().Next(std::forward<PassedDownParentRangeType>(ParentRangeCapture))
+			);
+
+			return TConditionalRange<decltype(NextParentRangeCapture), TargetStageCaptureType>
+			{
+				std::move(NextParentRangeCapture),
+				std::move(NextTargetStageCapture),
+				bUseTarget
+			};
+		}
+
+		TargetRangeType ApplyTargetStage() const
+		{
+			return TargetStageCapture.Get().Next(Private::Utils::Capture(GetParentRange()));
+		}
+
+		ParentRangeType& GetParentRange() const
+		{
+			return ParentRangeCapture.Get();
+		}
+
+		bool bUseTarget;
+		ParentRangeCaptureType ParentRangeCapture;
+		TargetStageCaptureType TargetStageCapture;
+
+		//NB: Should be declared after Parent Range and Target Range-Part - it is applied in
+		// constructors using them
+		TargetRangeType TargetRange;
+	};
+
+	// - - - - - Dummy
+
+	template<typename TargetStageCaptureType>
+	class TConditionalRange<Private::Utils::DummyType, TargetStageCaptureType>
+	{
+	public:
+		int* begin() const { return nullptr; }
+		int* end() const { return nullptr; }
+
+		TConditionalRange(TargetStageCaptureType&& InTargetStageCapture, bool bInUseTarget) :
+			bUseTarget(bInUseTarget),
+			TargetStageCapture(std::move(InTargetStageCapture)) { }
+
+		template<typename PassedDownParentRangeType>
+		auto Next(PassedDownParentRangeType&& ParentRangeCapture) const&
+		{
+			return NextWithTargetStage(std::forward<PassedDownParentRangeType>(ParentRangeCapture),
+				TemplateDetails::TConditionalRange::CopyStage(TargetStageCapture));
+		}
+
+		template<typename PassedDownParentRangeType>
+		auto Next(PassedDownParentRangeType&& ParentRangeCapture) &&
+		{
+			return NextWithTargetStage(std::forward<PassedDownParentRangeType>(ParentRangeCapture),
+				std::move(TargetStageCapture));
+		}
+
+	private:
+		template<typename PassedDownParentRangeType>
+		auto NextWithTargetStage(PassedDownParentRangeType&& ParentRangeCapture, TargetStageCaptureType&& NextTargetStageCapture) const
+		{
+			UnrealRanges::Private::Utils::CheckPassedAsArgCaptureType<decltype(ParentRangeCapture)>();
+
+			return TConditionalRange<std::decay_t<PassedDownParentRangeType>, TargetStageCaptureType>
+			{
+				std::move(ParentRangeCapture),
+				std::move(NextTargetStageCapture),
+				bUseTarget
+			};
+		}
+
+		bool bUseTarget;
+		TargetStageCaptureType TargetStageCapture;
+	};
+
+	// -------------------------------- ConditionalRange() ----------------------------------------
+
+	template<typename TargetRangeType>
+	auto ConditionalRange(TargetRangeType&& TargetRange, bool bUseTarget)
+	{
+		auto TargetStageCapture = Private::Utils::Capture(std::forward<TargetRangeType>(TargetRange));
+		return TConditionalRange<UnrealRanges::Private::Utils::DummyType, decltype(TargetStageCapture)>
+		{
+			std::move(TargetStageCapture), bUseTarget
+		};
+	}
+
+	// ===============================| Set operation range |========================================
+
+	namespace TemplateDetails
+	{
+		namespace SetOperationRange
+		{
+			//NB: Elements are accessed by reference if both ranges give access to elements by
+			// reference. Const reference is used if constness of the references is different
+			template<typename RangeAIteratorType, typename RangeBIteratorType>
+			using ReferenceType = std::conditional_t<
+				UnrealRanges::Private::Utils::IsSame<
+					UnrealRanges::Private::Utils::IteratorReferenceType<RangeAIteratorType>,
+					UnrealRanges::Private::Utils::IteratorReferenceType<RangeBIteratorType>>(),
+				UnrealRanges::Private::Utils::IteratorReferenceType<RangeAIteratorType>,
+				std::conditional_t<
+					std::is_lvalue_reference<UnrealRanges::Private::Utils::IteratorReferenceType<RangeAIteratorType>>::value &&
+						std::is_lvalue_reference<UnrealRanges::Private::Utils::IteratorReferenceType<RangeBIteratorType>>::value,
+					const std::decay_t<UnrealRanges::Private::Utils::IteratorReferenceType<RangeAIteratorType>>&,
+					std::decay_t<UnrealRanges::Private::Utils::IteratorReferenceType<RangeAIteratorType>>
+				>
+			>;
+
+			struct FIdentityKey
+			{
+				template<typename ValueType>
+				const ValueType& operator()(const ValueType& Value) const
+				{
+					return Value;
+				}
+			};
+
+			struct FLessKey
+			{
+				template<typename KeyType>
+				bool operator()(const KeyType& KeyA, const KeyType& KeyB) const
+				{
+					return KeyA < KeyB;
+				}
+			};
+
+			//NB: For pure intersection any Range may be indexed. Index of the smaller one
+			// is cheaper to build, other Range is iterated for probing
+			template<typename RangeAType, typename RangeBType>
+			auto IsIntersectionIteratesA(const RangeAType& RangeA, const RangeBType& RangeB, int)->
+				decltype(UnrealRanges::Utils::RangeSize(RangeA) >= UnrealRanges::Utils::RangeSize(RangeB))
+			{
+				return UnrealRanges::Utils::RangeSize(RangeA) >= UnrealRanges::Utils::RangeSize(RangeB);
+			}
 
-				using ParentRangeElementType = RangeElementType<CapturedValueType<ParentRangeCaptureType>>;
-				using TargetRangeElementType = RangeElementType<CapturedValueType<TargetRangeCaptureType>>;
+			template<typename RangeAType, typename RangeBType>
+			bool IsIntersectionIteratesA(const RangeAType& RangeA, const RangeBType& RangeB, ...)
+			{
+				return true;
+			}
 
-				static_assert(IsSame<ParentRangeElementType, TargetRangeElementType>(), "Unconsistant types passed");
+			template<typename IndexType, typename RangeType>
+			auto ReserveIndex(IndexType& Index, const RangeType& Range, int)->
+				decltype(UnrealRanges::Utils::RangeMaxSize(Range), void())
+			{
+				UnrealRanges::Utils::HashSetReserve(Index, UnrealRanges::Utils::RangeMaxSize(Range));
+			}
+
+			template<typename IndexType, typename RangeType>
+			void ReserveIndex(IndexType& Index, const RangeType& Range, ...)
+			{
+			}
+
+			//NB: Customization point for Range types that implement set operations
+			// natively (for example, bit sets). Specializations should declare
+			// "bSupported" as "true" and provide
+			// "template<int Operation> static {Range} Make(const RangeAType&, const RangeBType&)"
+			template<typename RangeAType, typename RangeBType>
+			struct TNativeOperation
+			{
+				static constexpr bool bSupported = false;
+			};
+
+			template<typename RangeAType, typename RangeBType>
+			constexpr bool IsNativeOperation()
+			{
+				return TNativeOperation<std::decay_t<RangeAType>, std::decay_t<RangeBType>>::bSupported;
+			}
+		}
+	}
+
+	//TODO: Support specializations for passed Operations
+	//
+	//NB: "SetOperation::Scan" algorithm implementation
+	//
+	template<int Operation, typename RangeACaptureType, typename RangeBCaptureType>
+	class TSetOperationRange
+	{
+	public:
+		using RangeAType = Private::Utils::CapturedAccessType<RangeACaptureType>;
+		using RangeBType = Private::Utils::CapturedAccessType<RangeBCaptureType>;
+
+		using ValueAType = Private::Utils::RangeElementType<RangeAType>;
+		using ValueBType = Private::Utils::RangeElementType<RangeBType>;
+		static_assert(std::is_same<ValueAType, ValueBType>::value, "Passed Ranges should contains some type Elements");
+
+		using ValueType = ValueAType;
+		static_assert(Private::Utils::IsComparable<ValueType, ValueType>(), "Ranges elements should support \"{ElementType} == {ElementType}\"");
+
+		using RangeAIteratorType = Private::Utils::RangeIteratorType<RangeAType>;
+		using RangeBIteratorType = Private::Utils::RangeIteratorType<RangeBType>;
+
+		using ReferenceType = TemplateDetails::SetOperationRange::ReferenceType<RangeAIteratorType, RangeBIteratorType>;
+		
+		class PseudoIterator
+		{
+		public:
+
+			PseudoIterator(
+				RangeAIteratorType&& InABegin, RangeAIteratorType&& InAEnd,
+				RangeBIteratorType&& InBBegin, RangeBIteratorType&& InBEnd)
+				:
+				ABegin(InABegin), ACurrent(IsA_B() || IsAnB() ? InABegin : InAEnd), AEnd(InAEnd),
+				BBegin(InBBegin), BCurrent(IsB_A() ? InBBegin : InBEnd), BEnd(InBEnd)
+			{
+				Ignore();
+			}
+
+			PseudoIterator() { }
+
+			ReferenceType operator*() const
+			{
+				UnrealRanges::Utils::Check(!IsEnd());
+
+				if (ACurrent != AEnd)
+				{
+					return *ACurrent;
+				}
+				else
+				{
+					return *BCurrent;
+				}
+			}
+
+			void operator++()
+			{
+				UnrealRanges::Utils::Check(!IsEnd());
+
+				if (ACurrent != AEnd)
+				{
+					++ACurrent;
+					Ignore();
+				}
+				else
+				{
+					++BCurrent;
+					Ignore();
+				}
+			}
+
+			//NB: DON'T use as actual iterator comparator!
+			// Just check if "Current" is not end. See description above for details
+			bool operator!=(const PseudoIterator&) const
+			{
+				return !IsEnd();
+			}
+
+		private:
+
+			bool IsEnd() const
+			{
+				return !(ACurrent != AEnd) && !(BCurrent != BEnd);
+			}
+
+			void Ignore()
+			{
+				auto IsRangeContainsValue = [](auto Begin, auto End, const ValueType& Value)
+				{
+					for (auto Current = Begin; Current != End; ++Current)
+					{
+						if (*Current == Value)
+						{
+							return true;
+						}
+					}
+					
+					return false;
+				};
+
+				//Constexpr check for switching out this branch on optimize builds
+				if (IsAnB() || IsA_B())
+				{
+					for (; ACurrent != AEnd; ++ACurrent)
+					{
+						const bool bIntersected = IsRangeContainsValue(BBegin, BEnd, *ACurrent);
+
+						if (IsAnB() && bIntersected)
+						{
+							//We want Itersection and we found Intersected value => Stop Ignoring!
+							return;
+						}
+						
+						if (IsA_B() && !bIntersected)
+						{
+							//We want A without B and we found A element not presented in B => Stop Ignoring!
+							return;
+						}
+					}
+				}
+
+				//Constexpr check for switching out this branch on optimize builds
+				// We should start ignoring B elements
+				if (IsB_A() && !(ACurrent != AEnd))
+				{
+					for (; BCurrent != BEnd; ++BCurrent)
+					{
+						const bool bIntersected = IsRangeContainsValue(ABegin, AEnd, *BCurrent);
+
+						if (!bIntersected)
+						{
+							//We process only "B_A" case here
+							//We want B without A and we found B element not presented in A => Stop Ignoring!
+							return;
+						}
+					}
+				}
 			}
+
+			constexpr static bool IsA_B() { return (Operation & Utils::SetOperation::A_B) != 0; }
+			constexpr static bool IsB_A() { return (Operation & Utils::SetOperation::B_A) != 0; }
+			constexpr static bool IsAnB() { return (Operation & Utils::SetOperation::AnB) != 0; }
+
+			RangeAIteratorType ABegin;
+			RangeAIteratorType ACurrent;
+			RangeAIteratorType AEnd;
+
+			RangeBIteratorType BBegin;
+			RangeBIteratorType BCurrent;
+			RangeBIteratorType BEnd;
+		};
+
+		TSetOperationRange(RangeACaptureType&& RangeACapture, RangeBCaptureType&& RangeBCapture)
+			: RangeACapture(std::move(RangeACapture)), RangeBCapture(std::move(RangeBCapture)) { }
+
+		PseudoIterator begin() const
+		{
+			return {
+				UnrealRanges::Utils::RangeBegin(GetRangeA()), UnrealRanges::Utils::RangeEnd(GetRangeA()),
+				UnrealRanges::Utils::RangeBegin(GetRangeB()), UnrealRanges::Utils::RangeEnd(GetRangeB())
+			};
+		}
+
+		//NB: Should be not used directly because comparation with "end()" is not used
+		// at all in this range type. See description above for details
+		PseudoIterator end() const
+		{
+			return {
+				UnrealRanges::Utils::RangeEnd(GetRangeA()), UnrealRanges::Utils::RangeEnd(GetRangeA()),
+				UnrealRanges::Utils::RangeEnd(GetRangeB()), UnrealRanges::Utils::RangeEnd(GetRangeB())
+			};
+		}
+
+	private:
+
+		RangeAType& GetRangeA() const
+		{
+			return RangeACapture.Get();
+		}
+
+		RangeBType& GetRangeB() const
+		{
+			return RangeBCapture.Get();
 		}
+
+		RangeACaptureType RangeACapture;
+		RangeBCaptureType RangeBCapture;
 	};
 
-	template<typename ParentRangeCaptureType, typename TargetRangeCaptureType>
-	class TConditionalRange
+	// ===============================| Hashed set operation range |========================================
+
+	template<int Operation, typename RangeACaptureType, typename RangeBCaptureType, typename ProjectionType>
+	class THashedSetOperationRange
 	{
 	public:
-		using ParentRangeType = Private::Utils::CapturedValueType<ParentRangeCaptureType>;
-		using TargetRangeType = Private::Utils::CapturedValueType<TargetRangeCaptureType>;
-		using ParentRangeIteratorType = Private::Utils::RangeIteratorType<ParentRangeType>;
-		using TargetRangeIteratorType = Private::Utils::RangeIteratorType<TargetRangeType>;
-		using ValueType = Private::Utils::RangeElementType<ParentRangeType>;
+		using RangeAType = Private::Utils::CapturedAccessType<RangeACaptureType>;
+		using RangeBType = Private::Utils::CapturedAccessType<RangeBCaptureType>;
 
-		class Iterator
+		using ValueAType = Private::Utils::RangeElementType<RangeAType>;
+		using ValueBType = Private::Utils::RangeElementType<RangeBType>;
+		static_assert(std::is_same<ValueAType, ValueBType>::value, "Passed Ranges should contains some type Elements");
+
+		using ValueType = ValueAType;
+		using KeyType = std::decay_t<decltype(std::declval<const ProjectionType&>()(std::declval<const ValueType&>()))>;
+
+		using RangeAIteratorType = Private::Utils::RangeIteratorType<RangeAType>;
+		using RangeBIteratorType = Private::Utils::RangeIteratorType<RangeBType>;
+
+		using ReferenceType = TemplateDetails::SetOperationRange::ReferenceType<RangeAIteratorType, RangeBIteratorType>;
+
+		class PseudoIterator
 		{
 		public:
 
-			Iterator(ParentRangeIteratorType InParentCurrent, TargetRangeIteratorType InTargetCurrent, bool bInUseTarget)
-				: bUseTarget(bInUseTarget), ParentCurrent(InParentCurrent), TargetCurrent(InTargetCurrent)
+			PseudoIterator(
+				const THashedSetOperationRange& InRange,
+				RangeAIteratorType&& InACurrent, RangeAIteratorType&& InAEnd,
+				RangeBIteratorType&& InBCurrent, RangeBIteratorType&& InBEnd)
+				:
+				Range(&InRange),
+				ACurrent(InACurrent), AEnd(InAEnd),
+				BCurrent(InBCurrent), BEnd(InBEnd)
+			{
+				Ignore();
+			}
+
+			PseudoIterator() { }
+
+			ReferenceType operator*() const
+			{
+				UnrealRanges::Utils::Check(!IsEnd());
+
+				if (ACurrent != AEnd)
+				{
+					return *ACurrent;
+				}
+				else
+				{
+					return *BCurrent;
+				}
+			}
+
+			void operator++()
+			{
+				UnrealRanges::Utils::Check(!IsEnd());
+
+				if (ACurrent != AEnd)
+				{
+					++ACurrent;
+				}
+				else
+				{
+					++BCurrent;
+				}
+
+				Ignore();
+			}
+
+			//NB: DON'T use as actual iterator comparator!
+			// Just check if "Current" is not end (same as for "TSetOperationRange<>")
+			bool operator!=(const PseudoIterator&) const
 			{
+				return !IsEnd();
 			}
 
-			auto operator*() const
+		private:
+
+			bool IsEnd() const
 			{
-				return bUseTarget ? *TargetCurrent : *ParentCurrent;
+				return !(ACurrent != AEnd) && !(BCurrent != BEnd);
 			}
 
-			void operator++()
+			//NB: Projection result is passed to the index as is: key reference returned by
+			// Projection is probed without copying, key is constructed only if Projection
+			// returns it by value
+			void Ignore()
 			{
-				if (bUseTarget)
+				//NB: A elements are iterated only if index of B is built (see "begin()")
+				for (; ACurrent != AEnd; ++ACurrent)
 				{
-					++TargetCurrent;
+					const bool bIntersected = UnrealRanges::Utils::HashSetContains<KeyType>(Range->IndexB, Range->Projection(*ACurrent));
+
+					if (IsAnB() && Range->bIntersectionIteratesA && bIntersected)
+					{
+						return;
+					}
+
+					if (IsA_B() && !bIntersected)
+					{
+						return;
+					}
 				}
-				else
+
+				//NB: B elements are iterated only if index of A is built (see "begin()")
+				for (; BCurrent != BEnd; ++BCurrent)
 				{
-					++ParentCurrent;
+					const bool bIntersected = UnrealRanges::Utils::HashSetContains<KeyType>(Range->IndexA, Range->Projection(*BCurrent));
+
+					if (IsAnB() && !Range->bIntersectionIteratesA && bIntersected)
+					{
+						return;
+					}
+
+					if (IsB_A() && !bIntersected)
+					{
+						return;
+					}
 				}
 			}
 
-			bool operator!=(const Iterator& Other) const
-			{
-				return bUseTarget ?
-					(TargetCurrent != Other.TargetCurrent) :
-					(ParentCurrent != Other.ParentCurrent);
-			}
+			constexpr static bool IsA_B() { return (Operation & Utils::SetOperation::A_B) != 0; }
+			constexpr static bool IsB_A() { return (Operation & Utils::SetOperation::B_A) != 0; }
+			constexpr static bool IsAnB() { return (Operation & Utils::SetOperation::AnB) != 0; }
 
-		private:
+			const THashedSetOperationRange* Range = nullptr;
 
-			bool bUseTarget;
-			ParentRangeIteratorType ParentCurrent;
-			TargetRangeIteratorType TargetCurrent;
+			RangeAIteratorType ACurrent;
+			RangeAIteratorType AEnd;
+
+			RangeBIteratorType BCurrent;
+			RangeBIteratorType BEnd;
 		};
 
-		TConditionalRange(ParentRangeCaptureType&& InParentRangeCapture, TargetRangeCaptureType&& InTargetRangeCapture, bool bInUseTarget) :
-			bUseTarget(bInUseTarget),
-			ParentRangeCapture(std::move(InParentRangeCapture)),
-			TargetRangeCapture(std::move(InTargetRangeCapture)) { }
+		THashedSetOperationRange(RangeACaptureType&& RangeACapture, RangeBCaptureType&& RangeBCapture, ProjectionType&& Projection)
+			: RangeACapture(std::move(RangeACapture)), RangeBCapture(std::move(RangeBCapture)), Projection(std::move(Projection)) { }
 
-		Iterator begin() const
+		PseudoIterator begin() const
 		{
+			BuildIndices();
+
+			const bool bIterateA = IsA_B() || (IsAnB() && bIntersectionIteratesA);
+			const bool bIterateB = IsB_A() || (IsAnB() && !bIntersectionIteratesA);
+
 			return {
-				RangeBegin(GetParentRange()),
-				RangeBegin(GetTargetRange()),
-				bUseTarget
+				*this,
+				bIterateA ? UnrealRanges::Utils::RangeBegin(GetRangeA()) : UnrealRanges::Utils::RangeEnd(GetRangeA()),
+				UnrealRanges::Utils::RangeEnd(GetRangeA()),
+				bIterateB ? UnrealRanges::Utils::RangeBegin(GetRangeB()) : UnrealRanges::Utils::RangeEnd(GetRangeB()),
+				UnrealRanges::Utils::RangeEnd(GetRangeB())
 			};
 		}
 
-		Iterator end() const
+		//NB: Should be not used directly because comparation with "end()" is not used
+		// at all in this range type (same as for "TSetOperationRange<>")
+		PseudoIterator end() const
 		{
 			return {
-				RangeEnd(GetParentRange()),
-				RangeEnd(GetTargetRange()),
-				bUseTarget
+				*this,
+				UnrealRanges::Utils::RangeEnd(GetRangeA()), UnrealRanges::Utils::RangeEnd(GetRangeA()),
+				UnrealRanges::Utils::RangeEnd(GetRangeB()), UnrealRanges::Utils::RangeEnd(GetRangeB())
 			};
 		}
 
-		template<typename PassedDownParentRangeType>
-		auto Next(PassedDownParentRangeType&& ParentRangeCapture) const
+	private:
+
+		//NB: Indices are built once, on first "begin()". Ranges passed to the Operation
+		// should not be changed after that
+		void BuildIndices() const
 		{
-			UnrealRanges::Private::Utils::CheckPassedAsArgCaptureType<decltype(ParentRangeCapture)>();
+			if (bIndicesBuilt)
+			{
+				return;
+			}
 
-			//Convert capture "ParentRangeCapture" into Shared
-			auto ParentRangeCaptureShared = std::move(ParentRangeCapture).ConvertIntoShared();
+			bIndicesBuilt = true;
 
-			//Pass copy of the Shared "ParentRangeCapture"
-			auto ParentRangeCaptureSharedCopyForTargetRange = ParentRangeCaptureShared;
-			auto NextTargetRangeCapture = Capture(
-				GetTargetRange().Next(std::forward<PassedDownParentRangeType>(ParentRangeCaptureSharedCopyForTargetRange))
-			);
+			bIntersectionIteratesA =
+				IsA_B() ||
+				(!IsB_A() && TemplateDetails::SetOperationRange::IsIntersectionIteratesA(GetRangeA(), GetRangeB(), 0));
 
-			TemplateDetails::TConditionalRange::CheckIsTypeConsistent<decltype(ParentRangeCaptureShared), decltype(NextTargetRangeCapture)>();
+			if (IsA_B() || (IsAnB() && bIntersectionIteratesA))
+			{
+				BuildIndex(IndexB, GetRangeB());
+			}
 
-			return TConditionalRange<decltype(ParentRangeCaptureShared), decltype(NextTargetRangeCapture)>
+			if (IsB_A() || (IsAnB() && !bIntersectionIteratesA))
 			{
-				std::move(ParentRangeCaptureShared),
-				std::move(NextTargetRangeCapture),
-				bUseTarget
-			};
+				BuildIndex(IndexA, GetRangeA());
+			}
 		}
 
-	private:
-		const ParentRangeType& GetParentRange() const
+		template<typename RangeType>
+		void BuildIndex(UnrealRanges::Utils::TUnrealRanges_HashSet<KeyType>& Index, RangeType& Range) const
 		{
-			return ParentRangeCapture.Get();
-		}
+			TemplateDetails::SetOperationRange::ReserveIndex(Index, Range, 0);
 
-		const TargetRangeType& GetTargetRange() const
-		{
-			return TargetRangeCapture.Get();
+			for (auto&& Element : Range)
+			{
+				UnrealRanges::Utils::HashSetAdd<KeyType>(Index, Projection(Element));
+			}
 		}
 
-		bool bUseTarget;
-		ParentRangeCaptureType ParentRangeCapture;
-		TargetRangeCaptureType TargetRangeCapture;
-	};
-
-	// - - - - - Dummy
-
-	template<typename TargetRangeCaptureType>
-	class TConditionalRange<Private::Utils::DummyType, TargetRangeCaptureType>
-	{
-	public:
-		using TargetRangeType = Private::Utils::CapturedValueType<TargetRangeCaptureType>;
-
-		int* begin() const { return nullptr; }
-		int* end() const { return nullptr; }
+		constexpr static bool IsA_B() { return (Operation & Utils::SetOperation::A_B) != 0; }
+		constexpr static bool IsB_A() { return (Operation & Utils::SetOperation::B_A) != 0; }
+		constexpr static bool IsAnB() { return (Operation & Utils::SetOperation::AnB) != 0; }
 
-		TConditionalRange(TargetRangeCaptureType&& InTargetRangeCapture, bool bInUseTarget) :
-			bUseTarget(bInUseTarget),
-			TargetRangeCapture(std::move(InTargetRangeCapture)) { }
-		
-		template<typename PassedDownParentRangeType>
-		auto Next(PassedDownParentRangeType&& ParentRangeCapture) const
+		RangeAType& GetRangeA() const
 		{
-			UnrealRanges::Private::Utils::CheckPassedAsArgCaptureType<decltype(ParentRangeCapture)>();
-
-			//Convert capture "ParentRangeCapture" into Shared
-			auto ParentRangeCaptureShared = std::move(ParentRangeCapture).ConvertIntoShared();
-
-			//Pass copy of the Shared "ParentRangeCapture"
-			auto ParentRangeCaptureSharedCopyForTargetRange = ParentRangeCaptureShared;
-			auto NextTargetRangeCapture = Capture(
-				GetTargetRange().Next(std::move(ParentRangeCaptureSharedCopyForTargetRange))
-			);
-
-			TemplateDetails::TConditionalRange::CheckIsTypeConsistent<decltype(ParentRangeCaptureShared), decltype(NextTargetRangeCapture)>();
-
-			return TConditionalRange<decltype(ParentRangeCaptureShared), decltype(NextTargetRangeCapture)>
-			{
-				std::move(ParentRangeCaptureShared),
-				std::move(NextTargetRangeCapture), 
-				bUseTarget
-			};
+			return RangeACapture.Get();
 		}
-	private:
 
-		const TargetRangeType& GetTargetRange() const
+		RangeBType& GetRangeB() const
 		{
-			return TargetRangeCapture.Get();
+			return RangeBCapture.Get();
 		}
 
-		bool bUseTarget;
-		TargetRangeCaptureType TargetRangeCapture;
-	};
-
-	// -------------------------------- ConditionalRange() ----------------------------------------
+		RangeACaptureType RangeACapture;
+		RangeBCaptureType RangeBCapture;
+		ProjectionType Projection;
 
-	template<typename TargetRangeType>
-	auto ConditionalRange(TargetRangeType&& TargetRange, bool bUseTarget)
-	{
-		auto TargetRangeCapture = Private::Utils::Capture(std::forward<TargetRangeType>(TargetRange));
-		return TConditionalRange<UnrealRanges::Private::Utils::DummyType, decltype(TargetRangeCapture)>
-		{
-			std::move(TargetRangeCapture), bUseTarget
-		};
-	}
+		mutable UnrealRanges::Utils::TUnrealRanges_HashSet<KeyType> IndexA;
+		mutable UnrealRanges::Utils::TUnrealRanges_HashSet<KeyType> IndexB;
+		mutable bool bIndicesBuilt = false;
+		mutable bool bIntersectionIteratesA = true;
+	};
 
-	// ===============================| Set operation range |========================================
+	// ===============================| Sorted set operation range |========================================
 
-	//TODO: Support specializations for passed Operations
-	//
-	template<int Operation, typename RangeACaptureType, typename RangeBCaptureType>
-	class TSetOperationRange
+	template<int Operation, typename RangeACaptureType, typename RangeBCaptureType, typename ProjectionType, typename LessType>
+	class TSortedSetOperationRange
 	{
 	public:
-		using RangeAType = Private::Utils::CapturedValueType<RangeACaptureType>;
-		using RangeBType = Private::Utils::CapturedValueType<RangeBCaptureType>;
+		using RangeAType = Private::Utils::CapturedAccessType<RangeACaptureType>;
+		using RangeBType = Private::Utils::CapturedAccessType<RangeBCaptureType>;
 
 		using ValueAType = Private::Utils::RangeElementType<RangeAType>;
 		using ValueBType = Private::Utils::RangeElementType<RangeBType>;
 		static_assert(std::is_same<ValueAType, ValueBType>::value, "Passed Ranges should contains some type Elements");
 
-		using ValueType = ValueAType;
-		static_assert(Private::Utils::IsComparable<ValueType, ValueType>(), "Ranges elements should support \"{ElementType} == {ElementType}\"");
-
 		using RangeAIteratorType = Private::Utils::RangeIteratorType<RangeAType>;
 		using RangeBIteratorType = Private::Utils::RangeIteratorType<RangeBType>;
-		
+
+		using ReferenceType = TemplateDetails::SetOperationRange::ReferenceType<RangeAIteratorType, RangeBIteratorType>;
+
 		class PseudoIterator
 		{
 		public:
 
 			PseudoIterator(
-				RangeAIteratorType&& InABegin, RangeAIteratorType&& InAEnd,
-				RangeBIteratorType&& InBBegin, RangeBIteratorType&& InBEnd)
+				const TSortedSetOperationRange& InRange,
+				RangeAIteratorType&& InACurrent, RangeAIteratorType&& InAEnd,
+				RangeBIteratorType&& InBCurrent, RangeBIteratorType&& InBEnd)
 				:
-				ABegin(InABegin), ACurrent(IsA_B() || IsAnB() ? InABegin : InAEnd), AEnd(InAEnd),
-				BBegin(InBBegin), BCurrent(IsB_A() ? InBBegin : InBEnd), BEnd(InBEnd)
+				Range(&InRange),
+				ACurrent(InACurrent), AEnd(InAEnd),
+				BCurrent(InBCurrent), BEnd(InBEnd)
 			{
 				Ignore();
 			}
 
-			PseudoIterator()
-				: Current() { }
+			PseudoIterator() { }
 
-			auto operator*() const
+			ReferenceType operator*() const
 			{
 				UnrealRanges::Utils::Check(!IsEnd());
 
-				if (ACurrent != AEnd)
+				if (Side != ESide::B)
 				{
 					return *ACurrent;
 				}
@@ -1081,20 +2485,21 @@ namespace UnrealRanges {
 			{
 				UnrealRanges::Utils::Check(!IsEnd());
 
-				if (ACurrent != AEnd)
+				if (Side != ESide::B)
 				{
 					++ACurrent;
-					Ignore();
 				}
-				else
+
+				if (Side != ESide::A)
 				{
 					++BCurrent;
-					Ignore();
 				}
+
+				Ignore();
 			}
 
 			//NB: DON'T use as actual iterator comparator!
-			// Just check if "Current" is not end. See description above for details
+			// Just check if "Current" is not end (same as for "TSetOperationRange<>")
 			bool operator!=(const PseudoIterator&) const
 			{
 				return !IsEnd();
@@ -1102,61 +2507,85 @@ namespace UnrealRanges {
 
 		private:
 
+			// Side of the current element: presented only in A, only in B
+			// or in both Ranges (in this case A element is used)
+			enum class ESide
+			{
+				A,
+				B,
+				AnB
+			};
+
+			bool IsAEnd() const
+			{
+				return bARestIgnored || !(ACurrent != AEnd);
+			}
+
+			bool IsBEnd() const
+			{
+				return bBRestIgnored || !(BCurrent != BEnd);
+			}
+
 			bool IsEnd() const
 			{
-				return !(ACurrent != AEnd) && !(BCurrent != BEnd);
+				return IsAEnd() && IsBEnd();
 			}
 
 			void Ignore()
 			{
-				auto IsRangeContainsValue = [](auto Begin, auto End, ValueType Value)
+				while (!IsEnd())
 				{
-					for (auto Current = Begin; Current != End; ++Current)
+					const bool bAEnd = IsAEnd();
+					const bool bBEnd = IsBEnd();
+
+					if (!bAEnd && (bBEnd || Range->IsLess(*ACurrent, *BCurrent)))
 					{
-						if (*Current == Value)
+						if (IsA_B())
 						{
-							return true;
+							Side = ESide::A;
+							return;
 						}
-					}
-					
-					return false;
-				};
 
-				//Constexpr check for switching out this branch on optimize builds
-				if (IsAnB() || IsA_B())
-				{
-					for (; ACurrent != AEnd; ++ACurrent)
+						//NB: Rest of A elements are not in B if B is ended. Rest is marked as
+						// ignored instead of assigning "AEnd" - iterators of pipelines (that hold
+						// their functors) may be not assignable
+						if (bBEnd)
+						{
+							bARestIgnored = true;
+						}
+						else
+						{
+							++ACurrent;
+						}
+					}
+					else if (!bBEnd && (bAEnd || Range->IsLess(*BCurrent, *ACurrent)))
 					{
-						const bool bIntersected = IsRangeContainsValue(BBegin, BEnd, *ACurrent);
-
-						if (IsAnB() && bIntersected)
+						if (IsB_A())
 						{
-							//We want Itersection and we found Intersected value => Stop Ignoring!
+							Side = ESide::B;
 							return;
 						}
-						
-						if (IsA_B() && !bIntersected)
+
+						//NB: Rest of B elements are not in A if A is ended (see above)
+						if (bAEnd)
 						{
-							//We want A without B and we found A element not presented in B => Stop Ignoring!
-							return;
+							bBRestIgnored = true;
+						}
+						else
+						{
+							++BCurrent;
 						}
 					}
-				}
-
-				//Constexpr check for switching out this branch on optimize builds
-				// We should start ignoring B elements
-				if (IsB_A() && !(ACurrent != AEnd))
-				{
-					for (; BCurrent != BEnd; ++BCurrent)
+					else
 					{
-						const bool bIntersected = IsRangeContainsValue(ABegin, AEnd, *BCurrent);
-
-						if (!bIntersected)
+						if (IsAnB())
 						{
-							//We process only "B_A" case here
-							//We want B without A and we found B element not presented in A => Stop Ignoring!
+							Side = ESide::AnB;
 							return;
 						}
+
+						++ACurrent;
+						++BCurrent;
 					}
 				}
 			}
@@ -1165,72 +2594,202 @@ namespace UnrealRanges {
 			constexpr static bool IsB_A() { return (Operation & Utils::SetOperation::B_A) != 0; }
 			constexpr static bool IsAnB() { return (Operation & Utils::SetOperation::AnB) != 0; }
 
-			RangeAIteratorType ABegin;
+			const TSortedSetOperationRange* Range = nullptr;
+			ESide Side = ESide::A;
+
+			bool bARestIgnored = false;
+			bool bBRestIgnored = false;
+
 			RangeAIteratorType ACurrent;
 			RangeAIteratorType AEnd;
 
-			RangeBIteratorType BBegin;
 			RangeBIteratorType BCurrent;
 			RangeBIteratorType BEnd;
 		};
 
-		TSetOperationRange(RangeACaptureType&& RangeACapture, RangeBCaptureType&& RangeBCapture)
-			: RangeACapture(std::move(RangeACapture)), RangeBCapture(std::move(RangeBCapture)) { }
+		TSortedSetOperationRange(RangeACaptureType&& RangeACapture, RangeBCaptureType&& RangeBCapture, ProjectionType&& Projection, LessType&& Less)
+			:
+			RangeACapture(std::move(RangeACapture)), RangeBCapture(std::move(RangeBCapture)),
+			Projection(std::move(Projection)), Less(std::move(Less))
+		{ }
 
 		PseudoIterator begin() const
 		{
 			return {
-				GetRangeA().begin(), GetRangeA().end(), 
-				GetRangeB().begin(), GetRangeB().end()
+				*this,
+				UnrealRanges::Utils::RangeBegin(GetRangeA()), UnrealRanges::Utils::RangeEnd(GetRangeA()),
+				UnrealRanges::Utils::RangeBegin(GetRangeB()), UnrealRanges::Utils::RangeEnd(GetRangeB())
 			};
 		}
 
 		//NB: Should be not used directly because comparation with "end()" is not used
-		// at all in this range type. See description above for details
+		// at all in this range type (same as for "TSetOperationRange<>")
 		PseudoIterator end() const
 		{
 			return {
-				GetRangeA().end(), GetRangeA().end(),
-				GetRangeB().end(), GetRangeB().end()
+				*this,
+				UnrealRanges::Utils::RangeEnd(GetRangeA()), UnrealRanges::Utils::RangeEnd(GetRangeA()),
+				UnrealRanges::Utils::RangeEnd(GetRangeB()), UnrealRanges::Utils::RangeEnd(GetRangeB())
 			};
 		}
 
 	private:
 
-		const RangeAType& GetRangeA() const
+		template<typename ElementAType, typename ElementBType>
+		bool IsLess(const ElementAType& ElementA, const ElementBType& ElementB) const
+		{
+			return Less(Projection(ElementA), Projection(ElementB));
+		}
+
+		RangeAType& GetRangeA() const
 		{
 			return RangeACapture.Get();
 		}
 
-		const RangeBType& GetRangeB() const
+		RangeBType& GetRangeB() const
 		{
 			return RangeBCapture.Get();
 		}
 
 		RangeACaptureType RangeACapture;
 		RangeBCaptureType RangeBCapture;
+		ProjectionType Projection;
+		LessType Less;
 	};
 
-	template<int Operation, typename RangeAType, typename RangeBType>
+	// -------------------------------- SetOperationRange() ----------------------------------------
+
+	namespace TemplateDetails
+	{
+		namespace SetOperationRange
+		{
+			template<int Operation, Utils::SetOperation::EAlgorithm Algorithm>
+			struct TFactory;
+
+			template<int Operation>
+			struct TFactory<Operation, Utils::SetOperation::Scan>
+			{
+				template<typename RangeACaptureType, typename RangeBCaptureType>
+				static auto Make(RangeACaptureType&& RangeACapture, RangeBCaptureType&& RangeBCapture, FIdentityKey)
+				{
+					return UnrealRanges::TSetOperationRange<Operation, RangeACaptureType, RangeBCaptureType>
+					{
+						std::move(RangeACapture),
+						std::move(RangeBCapture)
+					};
+				}
+			};
+
+			template<int Operation>
+			struct TFactory<Operation, Utils::SetOperation::Hashed>
+			{
+				template<typename RangeACaptureType, typename RangeBCaptureType, typename ProjectionType>
+				static auto Make(RangeACaptureType&& RangeACapture, RangeBCaptureType&& RangeBCapture, ProjectionType&& Projection)
+				{
+					return UnrealRanges::THashedSetOperationRange<Operation, RangeACaptureType, RangeBCaptureType, std::decay_t<ProjectionType>>
+					{
+						std::move(RangeACapture),
+						std::move(RangeBCapture),
+						std::decay_t<ProjectionType>{ std::forward<ProjectionType>(Projection) }
+					};
+				}
+			};
+
+			template<int Operation>
+			struct TFactory<Operation, Utils::SetOperation::Sorted>
+			{
+				template<typename RangeACaptureType, typename RangeBCaptureType, typename ProjectionType>
+				static auto Make(RangeACaptureType&& RangeACapture, RangeBCaptureType&& RangeBCapture, ProjectionType&& Projection)
+				{
+					return Make(
+						std::move(RangeACapture),
+						std::move(RangeBCapture),
+						std::forward<ProjectionType>(Projection),
+						FLessKey{ });
+				}
+
+				template<typename RangeACaptureType, typename RangeBCaptureType, typename ProjectionType, typename LessType>
+				static auto Make(RangeACaptureType&& RangeACapture, RangeBCaptureType&& RangeBCapture, ProjectionType&& Projection, LessType&& Less)
+				{
+					return UnrealRanges::TSortedSetOperationRange<Operation, RangeACaptureType, RangeBCaptureType, std::decay_t<ProjectionType>, std::decay_t<LessType>>
+					{
+						std::move(RangeACapture),
+						std::move(RangeBCapture),
+						std::decay_t<ProjectionType>{ std::forward<ProjectionType>(Projection) },
+						std::decay_t<LessType>{ std::forward<LessType>(Less) }
+					};
+				}
+			};
+		}
+	}
+
+	namespace TemplateDetails
+	{
+		namespace SetOperationRange
+		{
+			//NB: Native operations don't depend on the Algorithm
+			template<int Operation, Utils::SetOperation::EAlgorithm Algorithm, typename RangeAType, typename RangeBType>
+			auto _(RangeAType&& RangeA, RangeBType&& RangeB, int)->
+				std::enable_if_t<IsNativeOperation<RangeAType, RangeBType>(),
+					decltype(TNativeOperation<std::decay_t<RangeAType>, std::decay_t<RangeBType>>::template Make<Operation>(RangeA, RangeB))>
+			{
+				return TNativeOperation<std::decay_t<RangeAType>, std::decay_t<RangeBType>>::template Make<Operation>(RangeA, RangeB);
+			}
+
+			template<int Operation, Utils::SetOperation::EAlgorithm Algorithm, typename RangeAType, typename RangeBType>
+			auto _(RangeAType&& RangeA, RangeBType&& RangeB, ...)
+			{
+				return UnrealRanges::SetOperationRange<Operation, Algorithm>(
+					std::forward<RangeAType>(RangeA),
+					std::forward<RangeBType>(RangeB),
+					FIdentityKey{ });
+			}
+		}
+	}
+
+	template<int Operation, Utils::SetOperation::EAlgorithm Algorithm, typename RangeAType, typename RangeBType>
 	auto SetOperationRange(RangeAType&& RangeA, RangeBType&& RangeB)
+	{
+		return TemplateDetails::SetOperationRange::_<Operation, Algorithm>(
+			std::forward<RangeAType>(RangeA),
+			std::forward<RangeBType>(RangeB),
+			0);
+	}
+
+	template<int Operation, Utils::SetOperation::EAlgorithm Algorithm, typename RangeAType, typename RangeBType, typename ProjectionType>
+	auto SetOperationRange(RangeAType&& RangeA, RangeBType&& RangeB, ProjectionType&& Projection)
 	{
 		auto RangeACapture = Private::Utils::Capture(std::forward<RangeAType>(RangeA));
 		auto RangeBCapture = Private::Utils::Capture(std::forward<RangeBType>(RangeB));
 
-		return TSetOperationRange<Operation, decltype(RangeACapture), decltype(RangeBCapture)>
-		{
+		return TemplateDetails::SetOperationRange::TFactory<Operation, Algorithm>::Make(
 			std::move(RangeACapture),
-			std::move(RangeBCapture)
-		};
+			std::move(RangeBCapture),
+			std::forward<ProjectionType>(Projection));
+	}
+
+	template<int Operation, Utils::SetOperation::EAlgorithm Algorithm, typename RangeAType, typename RangeBType, typename ProjectionType, typename LessType>
+	auto SetOperationRange(RangeAType&& RangeA, RangeBType&& RangeB, ProjectionType&& Projection, LessType&& Less)
+	{
+		static_assert(Algorithm == Utils::SetOperation::Sorted, "Custom comparator is supported only for the \"SetOperation::Sorted\" Algorithm");
+
+		auto RangeACapture = Private::Utils::Capture(std::forward<RangeAType>(RangeA));
+		auto RangeBCapture = Private::Utils::Capture(std::forward<RangeBType>(RangeB));
+
+		return TemplateDetails::SetOperationRange::TFactory<Operation, Algorithm>::Make(
+			std::move(RangeACapture),
+			std::move(RangeBCapture),
+			std::forward<ProjectionType>(Projection),
+			std::forward<LessType>(Less));
 	}
 
 	// ===============================| Pipe operator |========================================
 
 	template<typename ParentRangeType, typename DummyChildRangeType>
 	auto operator | (ParentRangeType&& ParentRange, DummyChildRangeType&& ChildRangeDummy)->
-		decltype(ChildRangeDummy.Next(Private::Utils::Capture(std::forward<ParentRangeType>(ParentRange))))
+		decltype(std::forward<DummyChildRangeType>(ChildRangeDummy).Next(Private::Utils::Capture(std::forward<ParentRangeType>(ParentRange))))
 	{
-		return ChildRangeDummy.Next(Private::Utils::Capture(std::forward<ParentRangeType>(ParentRange)));
+		return std::forward<DummyChildRangeType>(ChildRangeDummy).Next(Private::Utils::Capture(std::forward<ParentRangeType>(ParentRange)));
 	}
 
 } // namespace UnrealRanges
@@ -7,21 +7,81 @@
 // - "UnrealRanges_RandRange()"
 #include "UnrealRanges_Private_Utils.h"
 
+//For:
+// - "ForEachChunk()" and chunking heuristic for parallel algorithms
+#include "UnrealRanges_Private_Parallel.h"
+
+//For:
+// - SIMD kernels for searching in contiguous collections
+#include "UnrealRanges_Private_Simd.h"
+
+//For:
+// - "TFilterRangeLogic<>" detection for compaction of filtered ranges
+#include "../UnrealRanges_Basics.h"
+
+//For:
+// - "TFilterExcludeLogic<>" detection for compaction of filtered ranges
+#include "../UnrealRanges_Common_Ranges.h"
+
 #include <utility> //for "std::forward<...>"
 #include <type_traits> //for "std::decay_t<...>"
+#include <atomic> //for parallel algorithms cancellation
+#include <mutex> //for unsequenced parallel "AddAllFromRange()"
+#include <vector> //for parallel algorithms chunks results and "RangeToVector()"
+#include <memory> //for "std::allocator<>" of "RangeToVector()"
+#include <algorithm> //for heap of "MinElementsBy()" and sorted index of "Exclude()"
+#include <cmath> //for random sampling
+#include <limits> //for random sampling
+#include <cstdint> //for random indices of "Shuffle()"
 
 namespace UnrealRanges{ namespace Algorithm{
 
+	namespace TemplateDetails
+	{
+		template<typename RangeType>
+		constexpr bool IsIndexableInConstantTime()
+		{
+			return
+				UnrealRanges::Utils::IsSizedRange<RangeType>() &&
+				UnrealRanges::Private::Utils::IsRandomAccessIterator<
+					UnrealRanges::Private::Utils::RangeIteratorType<std::remove_reference_t<RangeType>>>();
+		}
+	}
+
 	// ===============================| Contains<...>(Range, Value) |=======================================
 
+	namespace TemplateDetails
+	{
+		namespace Contains
+		{
+			//Contiguous collections of arithmetic values, enums or pointers
+			template <typename RangeType, typename ValueType>
+			auto _(RangeType& Range, const ValueType& Value, int)->decltype(
+				UnrealRanges::Private::Simd::Contains(Range, Value))
+			{
+				return UnrealRanges::Private::Simd::Contains(Range, Value);
+			}
+
+			template <typename RangeType, typename ValueType>
+			bool _(RangeType& Range, const ValueType& Value, ...)
+			{
+				return !UnrealRanges::Utils::RangeForEachWhile(Range,
+					[&Value](const auto& Elem)
+					{
+						return !(Elem == Value);
+					});
+			}
+		}
+	}
+
 	template <typename RangeType, typename ValueType>
 	bool Contains(RangeType&& Range, ValueType&& Value)
 	{
-		for (auto&& Elem : Range)
-			if (Elem == Value)
-				return true;
-
-		return false;
+		return UnrealRanges::Utils::RangeVisit(Range,
+			[&Value](auto& UsedRange)
+			{
+				return TemplateDetails::Contains::_(UsedRange, Value, 0);
+			});
 	}
 
 	// ===============================| ContainsByPredicate<...>(Range, Pred) |=======================================
@@ -49,15 +109,18 @@ namespace UnrealRanges{ namespace Algorithm{
 	{
 		using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
 
-		TUnrealRanges_Optional<ValueType> Best;
+		UnrealRanges::Utils::TUnrealRanges_Optional<ValueType> Best = UnrealRanges::Utils::MakeOptional<ValueType>();
 
-		for (auto Current : Range)
-		{
-			if (SelectionFunc(Current, Best))
+		UnrealRanges::Utils::RangeForEachWhile(Range,
+			[&SelectionFunc, &Best](const auto& Current)
 			{
-				Best = UnrealRanges::Utils::MakeOptional(Current);
-			}
-		}
+				if (SelectionFunc(Current, Best))
+				{
+					Best = UnrealRanges::Utils::MakeOptional<ValueType>(Current);
+				}
+
+				return true;
+			});
 
 		return Best;
 	}
@@ -69,24 +132,160 @@ namespace UnrealRanges{ namespace Algorithm{
 
 		return SelectWithFirstPick(Range,
 			[SelectionFuncForwared = std::forward<SelectionFuncType>(SelectionFunc)]
-			(const ValueType& Current, const TUnrealRanges_Optional<ValueType>& Best)
+			(const ValueType& Current, const UnrealRanges::Utils::TUnrealRanges_Optional<ValueType>& Best)
 			{
-				return !UnrealRanges::Utils::IsOptionalSet(Best) || SelectionFuncForwared(Current, Best.GetValue());
+				return !UnrealRanges::Utils::IsOptionalSet(Best) || SelectionFuncForwared(Current, UnrealRanges::Utils::GetOptionalValue(Best));
 			});
 	}
 
+	// ================================| SelectBy core |========================================
+
+	namespace TemplateDetails
+	{
+		namespace SelectBy
+		{
+			// Best element found during selection. Ranges indexable in constant time keep
+			// index of the best element and copy it once when selection is finished, other
+			// ranges keep copy of the best element (references to elements of some ranges
+			// are valid only until iterator is moved)
+			template<typename RangeType, bool bIndexable = IsIndexableInConstantTime<RangeType>()>
+			class TBestElement
+			{
+			public:
+				using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
+
+				template<typename ElementType>
+				void Set(ElementType&&, const int Index)
+				{
+					BestIndex = Index;
+				}
+
+				UnrealRanges::Utils::TUnrealRanges_Optional<ValueType> Get(RangeType& Range) const
+				{
+					if (BestIndex < 0)
+					{
+						return UnrealRanges::Utils::MakeOptional<ValueType>();
+					}
+
+					auto Best = UnrealRanges::Utils::RangeBegin(Range);
+					Best += BestIndex;
+					return UnrealRanges::Utils::MakeOptional<ValueType>(*Best);
+				}
+
+			private:
+				int BestIndex = -1;
+			};
+
+			template<typename RangeType>
+			class TBestElement<RangeType, false>
+			{
+			public:
+				using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
+
+				template<typename ElementType>
+				void Set(ElementType&& Element, const int)
+				{
+					Best.Reset(std::forward<ElementType>(Element));
+				}
+
+				UnrealRanges::Utils::TUnrealRanges_Optional<ValueType> Get(RangeType&) const
+				{
+					return Best.IsSet() ?
+						UnrealRanges::Utils::MakeOptional<ValueType>(*Best) :
+						UnrealRanges::Utils::MakeOptional<ValueType>();
+				}
+
+			private:
+				UnrealRanges::Private::Utils::TOpaqueOptional<ValueType> Best;
+			};
+
+			//NB: Key of the best element is cached, so projection is called once per element.
+			// First element with the best key is selected
+			template<typename RangeType, typename ProjectionType, typename IsBetterType>
+			auto _(RangeType& Range, const ProjectionType& Proj, const IsBetterType& IsBetter)
+			{
+				using KeyType = std::decay_t<decltype(Proj(*UnrealRanges::Utils::RangeBegin(Range)))>;
+
+				TBestElement<RangeType> Best;
+				UnrealRanges::Private::Utils::TOpaqueOptional<KeyType> BestKey;
+
+				int Index = 0;
+				UnrealRanges::Utils::RangeForEachWhile(Range,
+					[&Proj, &IsBetter, &Best, &BestKey, &Index](auto&& Current)
+					{
+						KeyType Key = Proj(Current);
+						if (!BestKey.IsSet() || IsBetter(Key, *BestKey))
+						{
+							Best.Set(std::forward<decltype(Current)>(Current), Index);
+							BestKey.Reset(std::move(Key));
+						}
+
+						++Index;
+						return true;
+					});
+
+				return Best.Get(Range);
+			}
+
+			struct FIsLess
+			{
+				template<typename ValueAType, typename ValueBType>
+				bool operator()(const ValueAType& ValueA, const ValueBType& ValueB) const
+				{
+					return ValueA < ValueB;
+				}
+			};
+
+			struct FIsGreater
+			{
+				template<typename ValueAType, typename ValueBType>
+				bool operator()(const ValueAType& ValueA, const ValueBType& ValueB) const
+				{
+					return ValueA > ValueB;
+				}
+			};
+		}
+
+		namespace SelectExtremumBy
+		{
+			template<bool bMin, typename RangeType, typename ProjectionType>
+			auto _(RangeType& Range, ProjectionType& Proj, std::false_type)
+			{
+				return SelectBy::_(Range, Proj, std::conditional_t<bMin, SelectBy::FIsLess, SelectBy::FIsGreater>{ });
+			}
+
+			//Contiguous collections with arithmetic keys: keys are reduced by SIMD kernels
+			// and the best element is copied to the result once
+			template<bool bMin, typename RangeType, typename ProjectionType>
+			auto _(RangeType& Range, ProjectionType& Proj, std::true_type)
+			{
+				using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
+
+				const auto* Data = UnrealRanges::Private::Simd::RangeData(Range);
+				const int Num = UnrealRanges::Utils::RangeSize(Range);
+				const int Index = UnrealRanges::Private::Simd::IndexOfExtremumBy<bMin>(Data, Num, Proj);
+
+				return Index < Num ?
+					UnrealRanges::Utils::MakeOptional<ValueType>(Data[Index]) :
+					UnrealRanges::Utils::MakeOptional<ValueType>();
+			}
+
+			template<typename RangeType, typename ProjectionType>
+			using IsReducibleTag = std::integral_constant<bool, UnrealRanges::Private::Simd::IsReducibleBy<
+				std::remove_reference_t<RangeType>, std::remove_reference_t<ProjectionType>>()>;
+		}
+	}
+
 	// ===============================| MinElementBy<...>(Range, Proj) |=======================================
 
 	template <typename RangeType, typename ProjectionType>
 	auto MinElementBy(RangeType&& Range, ProjectionType&& Proj)
 	{
-		using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
-
-		return Select(
-			Range,
-			[ProjForwared = std::forward<ProjectionType>(Proj)](const ValueType& Current, const ValueType& Best)
+		return UnrealRanges::Utils::RangeVisit(Range,
+			[&Proj](auto& UsedRange)
 			{
-				return ProjForwared(Current) < ProjForwared(Best);
+				return TemplateDetails::SelectExtremumBy::_<true>(UsedRange, Proj,
+					TemplateDetails::SelectExtremumBy::IsReducibleTag<decltype(UsedRange), ProjectionType>{ });
 			});
 	}
 
@@ -95,16 +294,135 @@ namespace UnrealRanges{ namespace Algorithm{
 	template <typename RangeType, typename ProjectionType>
 	auto MaxElementBy(RangeType&& Range, ProjectionType&& Proj)
 	{
-		using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
-
-		return Select(
-			Range,
-			[ProjForwared = std::forward<ProjectionType>(Proj)](const ValueType& Current, const ValueType& Best)
+		return UnrealRanges::Utils::RangeVisit(Range,
+			[&Proj](auto& UsedRange)
 			{
-				return ProjForwared(Current) > ProjForwared(Best);
+				return TemplateDetails::SelectExtremumBy::_<false>(UsedRange, Proj,
+					TemplateDetails::SelectExtremumBy::IsReducibleTag<decltype(UsedRange), ProjectionType>{ });
 			});
 	}
 
+	// ===============================| SelectNumBy core |=======================================
+
+	namespace TemplateDetails
+	{
+		namespace SelectNumBy
+		{
+			template<typename KeyType, typename ValueType>
+			struct TSelected
+			{
+				KeyType Key;
+				int Index;
+				ValueType Value;
+			};
+
+			// Heap of "Num" best elements with the worst of them on top: new element is
+			// added only if it's better than the top one. Order of equal keys is decided by
+			// indices of elements, so result is same as for stable sorting
+			template<typename KeyType, typename ValueType, typename IsBetterType>
+			class THeap
+			{
+			public:
+				using SelectedType = TSelected<KeyType, ValueType>;
+
+				THeap(const int InNum, const IsBetterType& InIsBetter)
+					: Num(InNum > 0 ? InNum : 0), IsBetter(InIsBetter)
+				{ }
+
+				bool IsFull() const
+				{
+					return static_cast<int>(Selected.size()) == Num;
+				}
+
+				// Key of the worst selected element, valid only for full heap
+				const KeyType& GetWorstKey() const
+				{
+					return Selected.front().Key;
+				}
+
+				template<typename ElementType>
+				void Add(KeyType&& Key, const int Index, ElementType&& Element)
+				{
+					if (!IsFull())
+					{
+						Selected.push_back({ std::move(Key), Index, std::forward<ElementType>(Element) });
+						std::push_heap(Selected.begin(), Selected.end(), GetIsBetterSelected());
+					}
+					else if (Num > 0 && IsBetter(Key, GetWorstKey()))
+					{
+						std::pop_heap(Selected.begin(), Selected.end(), GetIsBetterSelected());
+						Selected.back() = { std::move(Key), Index, std::forward<ElementType>(Element) };
+						std::push_heap(Selected.begin(), Selected.end(), GetIsBetterSelected());
+					}
+				}
+
+				// Selected elements sorted from the best one
+				std::vector<SelectedType> Release()
+				{
+					std::sort_heap(Selected.begin(), Selected.end(), GetIsBetterSelected());
+					return std::move(Selected);
+				}
+
+			private:
+				auto GetIsBetterSelected() const
+				{
+					const IsBetterType& IsBetterKey = IsBetter;
+					return [&IsBetterKey](const SelectedType& SelectedA, const SelectedType& SelectedB)
+					{
+						return
+							IsBetterKey(SelectedA.Key, SelectedB.Key) ||
+							(!IsBetterKey(SelectedB.Key, SelectedA.Key) && SelectedA.Index < SelectedB.Index);
+					};
+				}
+
+				int Num;
+				IsBetterType IsBetter;
+				std::vector<SelectedType> Selected;
+			};
+
+			template<typename RangeType, typename ProjectionType, typename IsBetterType>
+			auto _(RangeType& Range, const int Num, const ProjectionType& Proj, const IsBetterType& IsBetter)
+			{
+				using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
+				using KeyType = std::decay_t<decltype(Proj(*UnrealRanges::Utils::RangeBegin(Range)))>;
+
+				THeap<KeyType, ValueType, IsBetterType> Heap{ Num, IsBetter };
+
+				int Index = 0;
+				UnrealRanges::Utils::RangeForEachWhile(Range,
+					[&Proj, &Heap, &Index](auto&& Current)
+					{
+						Heap.Add(KeyType(Proj(Current)), Index, std::forward<decltype(Current)>(Current));
+						++Index;
+						return true;
+					});
+
+				std::vector<ValueType> Result;
+				for (auto& Selected : Heap.Release())
+				{
+					Result.push_back(std::move(Selected.Value));
+				}
+				return Result;
+			}
+		}
+	}
+
+	// ===============================| MinElementsBy<...>(Range, Num, Proj) |=======================================
+
+	template <typename RangeType, typename ProjectionType>
+	auto MinElementsBy(RangeType&& Range, const int Num, ProjectionType&& Proj)
+	{
+		return TemplateDetails::SelectNumBy::_(Range, Num, Proj, TemplateDetails::SelectBy::FIsLess{ });
+	}
+
+	// ===============================| MaxElementsBy<...>(Range, Num, Proj) |=======================================
+
+	template <typename RangeType, typename ProjectionType>
+	auto MaxElementsBy(RangeType&& Range, const int Num, ProjectionType&& Proj)
+	{
+		return TemplateDetails::SelectNumBy::_(Range, Num, Proj, TemplateDetails::SelectBy::FIsGreater{ });
+	}
+
 	// ===============================| FindByPredicate<...>(Range, Proj) |=======================================
 
 	template <typename RangeType, typename PredicateType>
@@ -112,33 +430,44 @@ namespace UnrealRanges{ namespace Algorithm{
 	{
 		using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
 
-		for (auto&& Elem : Range)
-		{
-			if (Pred(Elem))
+		UnrealRanges::Private::Utils::TOpaqueOptional<ValueType> Found;
+		UnrealRanges::Utils::RangeForEachWhile(Range,
+			[&Pred, &Found](auto&& Elem)
 			{
-				return UnrealRanges::Utils::MakeOptional(Elem);
-			}
-		}
+				if (!Pred(Elem))
+				{
+					return true;
+				}
+
+				Found.Reset(std::forward<decltype(Elem)>(Elem));
+				return false;
+			});
 
-		return UnrealRanges::Utils::MakeOptional<ValueType>();
+		return Found.IsSet() ?
+			UnrealRanges::Utils::MakeOptional<ValueType>(*Found) :
+			UnrealRanges::Utils::MakeOptional<ValueType>();
 	}
 
 	template<typename RangeType, typename PredicateType>
 	auto IndexByPredicate(RangeType&& Range, PredicateType&& Pred)
 	{
 		unsigned int Index = 0;
-		
-		for (auto&& Elem : Range)
-		{
-			if (Pred(Elem))
+
+		const bool bFound = !UnrealRanges::Utils::RangeForEachWhile(Range,
+			[&Pred, &Index](const auto& Elem)
 			{
-				return UnrealRanges::Utils::MakeOptional(Index);
-			}
+				if (Pred(Elem))
+				{
+					return false;
+				}
 
-			++Index;
-		}
+				++Index;
+				return true;
+			});
 
-		return UnrealRanges::Utils::MakeOptional<unsigned int>();
+		return bFound ?
+			UnrealRanges::Utils::MakeOptional(Index) :
+			UnrealRanges::Utils::MakeOptional<unsigned int>();
 	}
 
 	// ===============================| FindNextByPredicate<...>(Range, Pred) |=======================================
@@ -149,81 +478,366 @@ namespace UnrealRanges{ namespace Algorithm{
 		using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
 		bool bFoundByPredicate = false;
 
-		for (auto&& Elem : Range)
+		UnrealRanges::Private::Utils::TOpaqueOptional<ValueType> Found;
+		UnrealRanges::Utils::RangeForEachWhile(Range,
+			[&Pred, &bFoundByPredicate, &Found](auto&& Elem)
+			{
+				if (bFoundByPredicate)
+				{
+					Found.Reset(std::forward<decltype(Elem)>(Elem));
+					return false;
+				}
+
+				bFoundByPredicate = Pred(Elem);
+				return true;
+			});
+
+		return Found.IsSet() ?
+			UnrealRanges::Utils::MakeOptional<ValueType>(*Found) :
+			UnrealRanges::Utils::MakeOptional<ValueType>();
+	}
+
+	// ===============================| GetByIndex<...>(Range, Index) |=======================================
+
+	namespace TemplateDetails
+	{
+		namespace GetByIndexSafe
 		{
-			if (bFoundByPredicate)
+			template <typename RangeType>
+			using ResultType = UnrealRanges::Utils::TUnrealRanges_Optional<UnrealRanges::Private::Utils::RangeElementType<RangeType>>;
+
+			template <typename RangeType>
+			auto _(RangeType& Range, const unsigned int Index, int)->
+				std::enable_if_t<IsIndexableInConstantTime<RangeType>(), ResultType<RangeType>>
 			{
-				return UnrealRanges::Utils::MakeOptional(Elem);
+				using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
+
+				if (Index >= static_cast<unsigned int>(UnrealRanges::Utils::RangeSize(Range)))
+				{
+					return UnrealRanges::Utils::MakeOptional<ValueType>();
+				}
+
+				auto Indexed = UnrealRanges::Utils::RangeBegin(Range);
+				Indexed += static_cast<int>(Index);
+				return UnrealRanges::Utils::MakeOptional<ValueType>(*Indexed);
 			}
 
-			bFoundByPredicate = Pred(Elem);
-		}
+			template <typename RangeType>
+			ResultType<RangeType> _(RangeType& Range, const unsigned int Index, ...)
+			{
+				using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
 
-		return UnrealRanges::Utils::MakeOptional<ValueType>();
+				return FindByPredicate(Range,
+					[Index, CurrentIndex = 0u](const ValueType&) mutable
+					{
+						return (CurrentIndex++) == Index;
+					});
+			}
+		}
 	}
 
-	// ===============================| GetRangeCount<...>(Range) |=======================================
-
 	template <typename RangeType>
 	auto GetByIndex(RangeType&& Range, const unsigned int Index)
 	{
 		return UnrealRanges::Utils::GetOptionalValueChecked(
-			UnrealRanges::Utils::GetByIndexSafe(Range, Index));
+			UnrealRanges::Algorithm::GetByIndexSafe(Range, Index));
 	}
 
 	template <typename RangeType>
 	auto GetByIndexSafe(RangeType&& Range, const unsigned int Index)
 	{
-		using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
-
-		return FindByPredicate(Range,
-			[Index, CurrentIndex = 0](const ValueType&) mutable
-			{
-				return (CurrentIndex++) == Index;
-			});
+		return TemplateDetails::GetByIndexSafe::_(Range, Index, 0);
 	}
 
 	// ===============================| GetRangeCount<...>(Range) |=======================================
 
+	namespace TemplateDetails
+	{
+		namespace GetRangeCount
+		{
+			//NB: Sized ranges (collections and ranges that keep size of sized collections)
+			// are counted in constant time, other ranges - by iterating
+
+			template <typename RangeType>
+			auto _(const RangeType& Range, int)->decltype(UnrealRanges::Utils::RangeSize(Range))
+			{
+				return UnrealRanges::Utils::RangeSize(Range);
+			}
+
+			template <typename RangeType>
+			int _(const RangeType& Range, ...)
+			{
+				int Count = 0;
+				UnrealRanges::Utils::RangeForEachWhile(Range,
+					[&Count](const auto&)
+					{
+						++Count;
+						return true;
+					});
+
+				return Count;
+			}
+		}
+	}
+
 	template <typename RangeType>
 	int GetRangeCount(const RangeType& Range)
 	{
-		// TODO: Make overloading for Unreal collections
+		return UnrealRanges::Utils::RangeVisit(Range,
+			[](auto& UsedRange)
+			{
+				return static_cast<int>(TemplateDetails::GetRangeCount::_(UsedRange, 0));
+			});
+	}
+
+	// ===============================| GetRandomRangeElement<...>(Range, Pred) |=======================================
 
-		int Count = 0;
-		for (auto Unused : Range)
+	namespace TemplateDetails
+	{
+		namespace Sample
 		{
-			++Count;
+			// Random value in "(0, 1)" range - its logarithm is finite
+			inline double RandOpenFraction()
+			{
+				const double Fraction = UnrealRanges::Utils::RandFraction();
+				return Fraction > 0.0 ? Fraction : static_cast<double>(std::numeric_limits<float>::min());
+			}
+
+			// Li's "Algorithm L": reservoir is filled by first elements, then number of elements
+			// to skip before next replacement is got from geometric distribution with parameter "W"
+			// that is decreased on each replacement
+			template<typename RangeType>
+			auto _(const RangeType& Range, const int Num)
+			{
+				using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
+
+				std::vector<ValueType> Reservoir;
+				if (Num <= 0)
+				{
+					return Reservoir;
+				}
+
+				auto Current = UnrealRanges::Utils::RangeBegin(Range);
+				const auto End = UnrealRanges::Utils::RangeEnd(Range);
+
+				for (; Current != End && static_cast<int>(Reservoir.size()) < Num; ++Current)
+				{
+					Reservoir.push_back(*Current);
+				}
+
+				double W = std::exp(std::log(RandOpenFraction()) / Num);
+				while (Current != End)
+				{
+					const double Skip = std::floor(std::log(RandOpenFraction()) / std::log1p(-W));
+					const int SkipNum = Skip < static_cast<double>(std::numeric_limits<int>::max()) ?
+						static_cast<int>(Skip) : std::numeric_limits<int>::max();
+
+					if (UnrealRanges::Private::Utils::AdvanceIterator(Current, End, SkipNum) < SkipNum || !(Current != End))
+					{
+						break;
+					}
+
+					Reservoir[UnrealRanges::Utils::Rand(0, Num - 1)] = *Current;
+					++Current;
+
+					W *= std::exp(std::log(RandOpenFraction()) / Num);
+				}
+
+				return Reservoir;
+			}
 		}
 
-		return Count;
-	}
+		namespace GetRandomRangeElement
+		{
+			//Sized ranges: element by random index
+			template <typename RangeType>
+			auto _(const RangeType& Range, int)->decltype(UnrealRanges::Utils::RangeSize(Range),
+				UnrealRanges::Utils::TUnrealRanges_Optional<UnrealRanges::Private::Utils::RangeElementType<RangeType>>())
+			{
+				using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
 
-	// ===============================| GetRandomRangeElement<...>(Range, Pred) |=======================================
+				const int Count = UnrealRanges::Utils::RangeSize(Range);
+
+				return Count > 0 ?
+					UnrealRanges::Algorithm::GetByIndexSafe(Range, UnrealRanges::Utils::Rand(0, Count - 1)) :
+					UnrealRanges::Utils::MakeOptional<ValueType>();
+			}
+
+			//Other ranges: single pass reservoir sampling
+			template <typename RangeType>
+			auto _(const RangeType& Range, ...)
+			{
+				using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
+
+				auto Sampled = Sample::_(Range, 1);
+
+				return !Sampled.empty() ?
+					UnrealRanges::Utils::MakeOptional<ValueType>(std::move(Sampled.front())) :
+					UnrealRanges::Utils::MakeOptional<ValueType>();
+			}
+		}
+	}
 
 	template <typename RangeType>
 	auto GetRandomRangeElement(const RangeType& Range)
+	{
+		return TemplateDetails::GetRandomRangeElement::_(Range, 0);
+	}
+
+	// ===============================| SampleK<...>(Range, Num) |=======================================
+
+	template <typename RangeType>
+	auto SampleK(const RangeType& Range, const int Num)
+	{
+		return TemplateDetails::Sample::_(Range, Num);
+	}
+
+	// ===============================| WeightedSampleK<...>(Range, Num, WeightProj) |=======================================
+
+	template <typename RangeType, typename WeightProjectionType>
+	auto WeightedSampleK(const RangeType& Range, const int Num, const WeightProjectionType& WeightProj)
 	{
 		using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
 
-		const int Count = GetRangeCount(Range);
+		//NB: Keys "log(U) / Weight" are compared instead of "U ^ (1 / Weight)" of "A-Res" - order
+		// is same, but small weights do not underflow keys to zero
+		TemplateDetails::SelectNumBy::THeap<double, ValueType, TemplateDetails::SelectBy::FIsGreater> Heap{
+			Num, TemplateDetails::SelectBy::FIsGreater{ } };
 
-		return Count > 0 ?
-			GetByIndexSafe(Range, UnrealRanges::Utils::Rand(0, Count - 1)) :
-			UnrealRanges::Utils::MakeOptional<ValueType>();
+		int Index = 0;
+		UnrealRanges::Utils::RangeForEachWhile(Range,
+			[&WeightProj, &Heap, &Index](auto&& Current)
+			{
+				const double Weight = static_cast<double>(WeightProj(Current));
+				if (Weight > 0.0)
+				{
+					Heap.Add(std::log(TemplateDetails::Sample::RandOpenFraction()) / Weight, Index,
+						std::forward<decltype(Current)>(Current));
+				}
+
+				++Index;
+				return true;
+			});
+
+		std::vector<ValueType> Result;
+		for (auto& Selected : Heap.Release())
+		{
+			Result.push_back(std::move(Selected.Value));
+		}
+		return Result;
 	}
 
-	// ===============================| RangeHasElements<...>(Range) |=======================================
+	// ===============================| Shuffle<...>(Range, Num, RandomEngine) |=======================================
 
-	template<typename RangeType>
-	bool RangeHasElements(const RangeType& Range)
+	namespace TemplateDetails
 	{
-		for (const auto& Unused : Range)
+		namespace Shuffle
 		{
-			return true;
+			// Random values below bounds by Lemire's multiplication method: 32 bit random
+			// value multiplied by bound gives result in high bits, rejection is needed only
+			// if low bits are below "2^32 % Bound". Each engine call gives two 32 bit values
+			template<typename RandomEngineType>
+			class TBoundedRandom
+			{
+			public:
+				explicit TBoundedRandom(RandomEngineType& InEngine)
+					: Engine(InEngine)
+				{ }
+
+				std::uint32_t Below(const std::uint32_t Bound)
+				{
+					std::uint64_t Multiplied = static_cast<std::uint64_t>(Next()) * Bound;
+					std::uint32_t Low = static_cast<std::uint32_t>(Multiplied);
+
+					if (Low < Bound)
+					{
+						const std::uint32_t Threshold = (0u - Bound) % Bound;
+						while (Low < Threshold)
+						{
+							Multiplied = static_cast<std::uint64_t>(Next()) * Bound;
+							Low = static_cast<std::uint32_t>(Multiplied);
+						}
+					}
+
+					return static_cast<std::uint32_t>(Multiplied >> 32);
+				}
+
+			private:
+				std::uint32_t Next()
+				{
+					if (bHasHalf)
+					{
+						bHasHalf = false;
+						return static_cast<std::uint32_t>(Bits >> 32);
+					}
+
+					Bits = static_cast<std::uint64_t>(Engine());
+					bHasHalf = true;
+					return static_cast<std::uint32_t>(Bits);
+				}
+
+				RandomEngineType& Engine;
+				std::uint64_t Bits = 0;
+				bool bHasHalf = false;
+			};
 		}
+	}
+
+	template <typename RangeType, typename RandomEngineType>
+	void Shuffle(RangeType&& Range, const int Num, RandomEngineType&& RandomEngine)
+	{
+		using IteratorType = UnrealRanges::Private::Utils::RangeIteratorType<std::remove_reference_t<RangeType>>;
+
+		static_assert(UnrealRanges::Private::Utils::IsRandomAccessIterator<IteratorType>(),
+			"Range passed to \"Shuffle()\" should have random access iterators");
+
+		const auto First = UnrealRanges::Utils::RangeBegin(Range);
+		const int Size = static_cast<int>(UnrealRanges::Utils::RangeEnd(Range) - First);
 
-		return false;
+		//NB: Last element has no choice, so it's never swapped
+		const int SwapsNum = std::min(Num, Size - 1);
+
+		TemplateDetails::Shuffle::TBoundedRandom<std::remove_reference_t<RandomEngineType>> Random{ RandomEngine };
+
+		for (int Index = 0; Index < SwapsNum; ++Index)
+		{
+			const int OtherIndex = Index + static_cast<int>(Random.Below(static_cast<std::uint32_t>(Size - Index)));
+			if (OtherIndex != Index)
+			{
+				auto Current = First;
+				Current += Index;
+				auto Other = First;
+				Other += OtherIndex;
+
+				using std::swap;
+				swap(*Current, *Other);
+			}
+		}
+	}
+
+	template <typename RangeType>
+	void Shuffle(RangeType&& Range, const int Num)
+	{
+		UnrealRanges::Utils::FRandomEngine RandomEngine;
+		UnrealRanges::Algorithm::Shuffle(Range, Num, RandomEngine);
+	}
+
+	template <typename RangeType>
+	void Shuffle(RangeType&& Range)
+	{
+		UnrealRanges::Algorithm::Shuffle(Range, std::numeric_limits<int>::max());
+	}
+
+	// ===============================| RangeHasElements<...>(Range) |=======================================
+
+	template<typename RangeType>
+	bool RangeHasElements(const RangeType& Range)
+	{
+		return !UnrealRanges::Utils::RangeForEachWhile(Range,
+			[](const auto&)
+			{
+				return false;
+			});
 	}
 
 	// ===============================| RangeFirstElement<...>(Range) |=======================================
@@ -233,45 +847,92 @@ namespace UnrealRanges{ namespace Algorithm{
 	{
 		using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
 
-		for (const ValueType& RangeElement : Range)
-		{
-			return UnrealRanges::Utils::MakeOptional(RangeElement);
-		}
+		UnrealRanges::Private::Utils::TOpaqueOptional<ValueType> First;
+		UnrealRanges::Utils::RangeForEachWhile(Range,
+			[&First](auto&& RangeElement)
+			{
+				First.Reset(std::forward<decltype(RangeElement)>(RangeElement));
+				return false;
+			});
 
-		return UnrealRanges::Utils::MakeOptional<ValueType>();
+		return First.IsSet() ?
+			UnrealRanges::Utils::MakeOptional<ValueType>(*First) :
+			UnrealRanges::Utils::MakeOptional<ValueType>();
 	}
 
 	// ===============================| RangeLastElement<...>(Range) |=======================================
 
-	template<typename RangeType>
-	auto RangeLastElement(const RangeType& Range)
+	namespace TemplateDetails
 	{
-		using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
+		namespace RangeLastElement
+		{
+			template<typename RangeType>
+			auto _(const RangeType& Range, int)->
+				std::enable_if_t<IsIndexableInConstantTime<const RangeType>(), GetByIndexSafe::ResultType<const RangeType>>
+			{
+				using ValueType = UnrealRanges::Private::Utils::RangeElementType<const RangeType>;
+
+				const int Size = UnrealRanges::Utils::RangeSize(Range);
+				return Size > 0 ?
+					GetByIndexSafe::_(Range, static_cast<unsigned int>(Size - 1), 0) :
+					UnrealRanges::Utils::MakeOptional<ValueType>();
+			}
+
+			template<typename RangeType>
+			GetByIndexSafe::ResultType<const RangeType> _(const RangeType& Range, ...)
+			{
+				using ValueType = UnrealRanges::Private::Utils::RangeElementType<const RangeType>;
 
-		TUnrealRanges_Optional<ValueType> Result = UnrealRanges::Utils::MakeOptional<ValueType>();
+				UnrealRanges::Utils::TUnrealRanges_Optional<ValueType> Result = UnrealRanges::Utils::MakeOptional<ValueType>();
 
-		for (const ValueType& Current : Range)
-		{
-			Result = UnrealRanges::Utils::MakeOptional<ValueType>(Current);
+				UnrealRanges::Utils::RangeForEachWhile(Range,
+					[&Result](const ValueType& Current)
+					{
+						Result = UnrealRanges::Utils::MakeOptional<ValueType>(Current);
+						return true;
+					});
+
+				return Result;
+			}
 		}
+	}
 
-		return Result;
+	template<typename RangeType>
+	auto RangeLastElement(const RangeType& Range)
+	{
+		return TemplateDetails::RangeLastElement::_(Range, 0);
 	}
 
 	// ===============================| EqualsToSome<...>(Value, ValuesToCompare) |=======================================
 
-	template<typename ValueType, typename RangeType>
-	bool EqualsToSome(const ValueType& Value, const RangeType& Range)
+	namespace TemplateDetails
 	{
-		for (const ValueType& ValueToCompare : Range)
+		namespace EqualsToSome
 		{
-			if (Value == ValueToCompare)
+			//Contiguous collections of arithmetic values, enums or pointers
+			template<typename ValueType, typename RangeType>
+			auto _(const ValueType& Value, const RangeType& Range, int)->decltype(
+				UnrealRanges::Private::Simd::Contains(Range, Value))
 			{
-				return true;
+				return UnrealRanges::Private::Simd::Contains(Range, Value);
+			}
+
+			template<typename ValueType, typename RangeType>
+			bool _(const ValueType& Value, const RangeType& Range, ...)
+			{
+				return !UnrealRanges::Utils::RangeForEachWhile(Range,
+					[&Value](const ValueType& ValueToCompare)
+					{
+						return !(Value == ValueToCompare);
+					});
 			}
 		}
+	}
 
-		return false;
+	template<typename ValueType, typename RangeType>
+	bool EqualsToSome(const ValueType& Value, const RangeType& Range)
+	{
+		return TemplateDetails::EqualsToSome::_(Value, Range, 0);
 	}
 
 	// ===============================| EqualsToSome<...>(Value, Range) |=======================================
@@ -282,4 +943,897 @@ namespace UnrealRanges{ namespace Algorithm{
 		return EqualsToSome<ValueType, std::initializer_list<ValueType>>(Value, ValuesToCompare);
 	}
 
+	// ===============================| AppendAllFromRange core |=======================================
+
+	namespace TemplateDetails
+	{
+		namespace AppendAllFromRange
+		{
+			template<typename RangeType>
+			using DataElementType = std::remove_cv_t<std::remove_pointer_t<
+				decltype(UnrealRanges::Private::Simd::RangeData(std::declval<const RangeType&>().GetParentRange()))>>;
+
+			//Filtered contiguous collections of trivially copyable elements: passed elements
+			// are packed by blocks and appended by "AppendElements(Elements, Num)"
+			template<typename ParentRangeCaptureType, typename SettingsType, typename AppendElementsType, typename AppendElementType>
+			auto _(
+				const UnrealRanges::TBasicRange<ParentRangeCaptureType, UnrealRanges::TFilterRangeLogic, SettingsType>& Range,
+				const AppendElementsType& AppendElements, const AppendElementType&, int)->std::enable_if_t<
+					UnrealRanges::Private::Simd::IsCompactable<DataElementType<std::decay_t<decltype(Range)>>>()>
+			{
+				const auto& ParentRange = Range.GetParentRange();
+
+				UnrealRanges::Private::Simd::CompactBy(
+					UnrealRanges::Private::Simd::RangeData(ParentRange),
+					UnrealRanges::Utils::RangeSize(ParentRange),
+					Range.GetSettings(),
+					AppendElements);
+			}
+
+			//NB: Same for excluding filter - SIMD skipping of excluded sequences helps only
+			// when they are long, while packing doesn't depend on excluded elements layout
+			template<typename ParentRangeCaptureType, typename ElementType, typename AppendElementsType, typename AppendElementType>
+			auto _(
+				const UnrealRanges::TBasicRange<ParentRangeCaptureType, UnrealRanges::TFilterExcludeLogic, ElementType>& Range,
+				const AppendElementsType& AppendElements, const AppendElementType&, int)->std::enable_if_t<
+					UnrealRanges::Private::Simd::IsCompactable<DataElementType<std::decay_t<decltype(Range)>>>()>
+			{
+				const auto& ParentRange = Range.GetParentRange();
+				const ElementType& ElementToIgnore = Range.GetSettings();
+
+				UnrealRanges::Private::Simd::CompactBy(
+					UnrealRanges::Private::Simd::RangeData(ParentRange),
+					UnrealRanges::Utils::RangeSize(ParentRange),
+					[&ElementToIgnore](const auto& Element)
+					{
+						return !(Element == ElementToIgnore);
+					},
+					AppendElements);
+			}
+
+			//NB: Elements are forwarded - temporaries produced by the Range may be moved
+			template<typename RangeType, typename AppendElementsType, typename AppendElementType>
+			void _(const RangeType& Range, const AppendElementsType&, const AppendElementType& AppendElement, ...)
+			{
+				UnrealRanges::Utils::RangeForEachWhile(Range,
+					[&AppendElement](auto&& RangeElement)
+					{
+						AppendElement(std::forward<decltype(RangeElement)>(RangeElement));
+						return true;
+					});
+			}
+		}
+	}
+
+	// ===============================| Collection sink core |=======================================
+
+	namespace TemplateDetails
+	{
+		namespace CollectionSink
+		{
+			//NB: Members are checked in order of overloads priority ("int" -> "long" -> "...")
+			// STL collections first, then Unreal ones
+
+			//NB: Capacity of other collections (like "std::unordered_set<>" or "TSet<>") is
+			// not known, so they are reserved only while empty - otherwise they grow by themselves
+			template<typename CollectionType, typename SizeType>
+			auto ReserveEmpty(CollectionType& Collection, const SizeType AddedNum, int)->
+				decltype(Collection.reserve(AddedNum), Collection.empty(), void())
+			{
+				if (Collection.empty())
+				{
+					Collection.reserve(AddedNum);
+				}
+			}
+
+			template<typename CollectionType, typename SizeType>
+			auto ReserveEmpty(CollectionType& Collection, const SizeType AddedNum, long)->
+				decltype(Collection.Reserve(AddedNum), Collection.Num(), void())
+			{
+				if (Collection.Num() == 0)
+				{
+					Collection.Reserve(AddedNum);
+				}
+			}
+
+			//NB: Reservation is performed only for collections that support it
+			template<typename CollectionType, typename SizeType>
+			void ReserveEmpty(CollectionType&, const SizeType, ...)
+			{
+			}
+
+			//NB: Collections are reserved only if their capacity is not enough, and at least
+			// twice - so repeated appending of few elements to same collection doesn't
+			// reallocate it on each append
+			template<typename CollectionType, typename SizeType>
+			auto Reserve(CollectionType& Collection, const SizeType AddedNum, int)->
+				decltype(Collection.reserve(Collection.capacity()), void())
+			{
+				const auto NeededNum = Collection.size() + AddedNum;
+				if (Collection.capacity() < NeededNum)
+				{
+					Collection.reserve(std::max<decltype(NeededNum)>(NeededNum, 2 * Collection.capacity()));
+				}
+			}
+
+			template<typename CollectionType, typename SizeType>
+			auto Reserve(CollectionType& Collection, const SizeType AddedNum, long)->
+				decltype(Collection.Reserve(Collection.Max()), void())
+			{
+				const auto NeededNum = Collection.Num() + AddedNum;
+				if (Collection.Max() < NeededNum)
+				{
+					Collection.Reserve(std::max<decltype(NeededNum)>(NeededNum, 2 * Collection.Max()));
+				}
+			}
+
+			template<typename CollectionType, typename SizeType>
+			void Reserve(CollectionType& Collection, const SizeType AddedNum, ...)
+			{
+				CollectionSink::ReserveEmpty(Collection, AddedNum, 0);
+			}
+
+			template<typename CollectionType, typename ElementType>
+			auto Add(CollectionType& Collection, ElementType&& Element, int)->
+				decltype(Collection.emplace_back(std::forward<ElementType>(Element)), void())
+			{
+				Collection.emplace_back(std::forward<ElementType>(Element));
+			}
+
+			template<typename CollectionType, typename ElementType>
+			auto Add(CollectionType& Collection, ElementType&& Element, long)->
+				decltype(Collection.insert(std::forward<ElementType>(Element)), void())
+			{
+				Collection.insert(std::forward<ElementType>(Element));
+			}
+
+			template<typename CollectionType, typename ElementType>
+			void Add(CollectionType& Collection, ElementType&& Element, ...)
+			{
+				Collection.Add(std::forward<ElementType>(Element));
+			}
+
+			template<typename CollectionType, typename ElementType>
+			auto AppendBlock(CollectionType& Collection, const ElementType* Elements, const int Num, int)->
+				decltype(Collection.Append(Elements, Num), void())
+			{
+				Collection.Append(Elements, Num);
+			}
+
+			template<typename CollectionType, typename ElementType>
+			auto AppendBlock(CollectionType& Collection, const ElementType* Elements, const int Num, long)->
+				decltype(Collection.insert(Collection.end(), Elements, Elements + Num), void())
+			{
+				Collection.insert(Collection.end(), Elements, Elements + Num);
+			}
+
+			template<typename CollectionType, typename ElementType>
+			void AppendBlock(CollectionType& Collection, const ElementType* Elements, const int Num, ...)
+			{
+				for (int Index = 0; Index < Num; ++Index)
+				{
+					CollectionSink::Add(Collection, Elements[Index], 0);
+				}
+			}
+
+			template<typename CollectionType, typename RangeType>
+			void AddAll(CollectionType& Collection, const RangeType& Range)
+			{
+				using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
+
+				UnrealRanges::Utils::RangeVisit(Range,
+					[&Collection](auto& UsedRange)
+					{
+						UnrealRanges::Algorithm::TemplateDetails::AppendAllFromRange::_(UsedRange,
+							[&Collection](const ValueType* Elements, const int Num)
+							{
+								CollectionSink::AppendBlock(Collection, Elements, Num, 0);
+							},
+							[&Collection](auto&& Element)
+							{
+								CollectionSink::Add(Collection, std::forward<decltype(Element)>(Element), 0);
+							},
+							0);
+					});
+			}
+
+			//NB: Only exact size is used - "Collection" may be filled several times, so
+			// reserving of upper bound would accumulate unused memory
+			template<typename CollectionType, typename RangeType>
+			auto ReserveExact(CollectionType& Collection, const RangeType& Range, int)->
+				decltype(UnrealRanges::Utils::RangeSize(Range), void())
+			{
+				CollectionSink::Reserve(Collection, UnrealRanges::Utils::RangeSize(Range), 0);
+			}
+
+			template<typename CollectionType, typename RangeType>
+			void ReserveExact(CollectionType&, const RangeType&, ...)
+			{
+			}
+
+			//NB: Upper bound is used - new collection is filled only once, so single
+			// allocation is prefered over reallocations on growing
+			template<typename CollectionType, typename RangeType>
+			auto ReserveMax(CollectionType& Collection, const RangeType& Range, int)->
+				decltype(UnrealRanges::Utils::RangeMaxSize(Range), void())
+			{
+				CollectionSink::Reserve(Collection, UnrealRanges::Utils::RangeMaxSize(Range), 0);
+			}
+
+			template<typename CollectionType, typename RangeType>
+			void ReserveMax(CollectionType&, const RangeType&, ...)
+			{
+			}
+		}
+	}
+
+	// ===============================| AddAllFromRange<...>(Collection, SourceRange) |=======================================
+
+	template<typename CollectionToFill, typename SourceRangeType>
+	void AddAllFromRange(CollectionToFill& Collection, const SourceRangeType& SourceRange)
+	{
+		TemplateDetails::CollectionSink::ReserveExact(Collection, SourceRange, 0);
+		TemplateDetails::CollectionSink::AddAll(Collection, SourceRange);
+	}
+
+	// ===============================| RangeToCollection<CollectionType, ...>(Range, CollectionArgs...) |=======================================
+
+	template<typename CollectionType, typename RangeType, typename... CollectionArgTypes>
+	CollectionType RangeToCollection(const RangeType& Range, CollectionArgTypes&&... CollectionArgs)
+	{
+		CollectionType Result(std::forward<CollectionArgTypes>(CollectionArgs)...);
+		TemplateDetails::CollectionSink::ReserveMax(Result, Range, 0);
+		TemplateDetails::CollectionSink::AddAll(Result, Range);
+		return Result;
+	}
+
+	// ===============================| RangeToVector<...>(Range) |=======================================
+
+	template<typename RangeType>
+	auto RangeToVector(const RangeType& Range)
+	{
+		using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
+
+		return RangeToVector<std::allocator<ValueType>>(Range);
+	}
+
+	// ===============================| RangeToVector<AllocatorType, ...>(Range) |=======================================
+
+	template<typename AllocatorType, typename RangeType>
+	auto RangeToVector(const RangeType& Range)
+	{
+		using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
+
+		return RangeToCollection<std::vector<ValueType, AllocatorType>>(Range);
+	}
+
+	// ===============================| Exclude core |=======================================
+
+	namespace TemplateDetails
+	{
+		namespace Exclude
+		{
+			// Index of "RangeToExclude" elements that is built once and used to check each
+			// element of collection. "IsEmpty()" allows to skip compaction at all
+			template<Utils::SetOperation::EAlgorithm Algorithm, typename ValueType, typename RangeToExcludeType>
+			class TExcludedIndex;
+
+			template<typename ValueType, typename RangeToExcludeType>
+			class TExcludedIndex<Utils::SetOperation::Scan, ValueType, RangeToExcludeType>
+			{
+			public:
+				explicit TExcludedIndex(const RangeToExcludeType& InRange)
+					: Range(InRange)
+				{ }
+
+				bool IsEmpty() const
+				{
+					return !(UnrealRanges::Utils::RangeBegin(Range) != UnrealRanges::Utils::RangeEnd(Range));
+				}
+
+				bool Contains(const ValueType& Value) const
+				{
+					return !UnrealRanges::Utils::RangeForEachWhile(Range,
+						[&Value](const auto& Excluded)
+						{
+							return !(Value == Excluded);
+						});
+				}
+
+			private:
+				const RangeToExcludeType& Range;
+			};
+
+			template<typename ValueType, typename RangeToExcludeType>
+			class TExcludedIndex<Utils::SetOperation::Hashed, ValueType, RangeToExcludeType>
+			{
+			public:
+				explicit TExcludedIndex(const RangeToExcludeType& Range)
+				{
+					UnrealRanges::TemplateDetails::SetOperationRange::ReserveIndex(Index, Range, 0);
+					UnrealRanges::Utils::RangeForEachWhile(Range,
+						[this](const auto& Excluded)
+						{
+							UnrealRanges::Utils::HashSetAdd(Index, ValueType{ Excluded });
+							bEmpty = false;
+							return true;
+						});
+				}
+
+				bool IsEmpty() const
+				{
+					return bEmpty;
+				}
+
+				bool Contains(const ValueType& Value) const
+				{
+					return UnrealRanges::Utils::HashSetContains(Index, Value);
+				}
+
+			private:
+				UnrealRanges::Utils::TUnrealRanges_HashSet<ValueType> Index;
+				bool bEmpty = true;
+			};
+
+			template<typename ValueType, typename RangeToExcludeType>
+			class TExcludedIndex<Utils::SetOperation::Sorted, ValueType, RangeToExcludeType>
+			{
+			public:
+				explicit TExcludedIndex(const RangeToExcludeType& Range)
+				{
+					UnrealRanges::Utils::RangeForEachWhile(Range,
+						[this](const auto& Excluded)
+						{
+							Index.push_back(ValueType{ Excluded });
+							return true;
+						});
+					std::sort(Index.begin(), Index.end());
+				}
+
+				bool IsEmpty() const
+				{
+					return Index.empty();
+				}
+
+				bool Contains(const ValueType& Value) const
+				{
+					return std::binary_search(Index.begin(), Index.end(), Value);
+				}
+
+			private:
+				std::vector<ValueType> Index;
+			};
+
+			// Moves kept elements to the beginning keeping their order, returns number of kept elements
+			template<typename ElementType, typename IndexType>
+			int CompactStable(ElementType* Data, const int Num, const IndexType& ExcludedIndex)
+			{
+				int KeptNum = 0;
+				for (int Index = 0; Index < Num; ++Index)
+				{
+					if (!ExcludedIndex.Contains(Data[Index]))
+					{
+						if (KeptNum != Index)
+						{
+							Data[KeptNum] = std::move(Data[Index]);
+						}
+						++KeptNum;
+					}
+				}
+				return KeptNum;
+			}
+
+			// Replaces excluded elements by the last not checked ones, returns number of kept elements
+			template<typename ElementType, typename IndexType>
+			int CompactSwap(ElementType* Data, const int Num, const IndexType& ExcludedIndex)
+			{
+				int KeptEnd = Num;
+				int Index = 0;
+				while (Index < KeptEnd)
+				{
+					if (ExcludedIndex.Contains(Data[Index]))
+					{
+						--KeptEnd;
+						if (Index != KeptEnd)
+						{
+							Data[Index] = std::move(Data[KeptEnd]);
+						}
+					}
+					else
+					{
+						++Index;
+					}
+				}
+				return KeptEnd;
+			}
+
+			// Algorithm used if it is not passed explicitly
+			template<typename ValueType>
+			constexpr Utils::SetOperation::EAlgorithm DefaultAlgorithm()
+			{
+				return UnrealRanges::Utils::IsHashSetKey<ValueType>() ?
+					Utils::SetOperation::Hashed : Utils::SetOperation::Scan;
+			}
+
+			template<Utils::SetOperation::EAlgorithm Algorithm, bool bStable, typename ValueType, typename RangeToExcludeType>
+			int _(ValueType* Data, const int Num, const RangeToExcludeType& RangeToExclude)
+			{
+				static_assert(
+					Algorithm == Utils::SetOperation::Scan ||
+					Algorithm == Utils::SetOperation::Hashed ||
+					Algorithm == Utils::SetOperation::Sorted,
+					"Invalid Algorithm template argument value passed");
+
+				const TExcludedIndex<Algorithm, ValueType, RangeToExcludeType> ExcludedIndex{ RangeToExclude };
+				if (Num == 0 || ExcludedIndex.IsEmpty())
+				{
+					return Num;
+				}
+
+				return bStable ?
+					CompactStable(Data, Num, ExcludedIndex) :
+					CompactSwap(Data, Num, ExcludedIndex);
+			}
+		}
+	}
+
+	// ===============================| Exclude<...>(VectorToExcludeFrom, RangeToExclude) |=======================================
+
+	template<Utils::SetOperation::EAlgorithm Algorithm, typename ValueType, typename AllocatorType, typename RangeToExcludeType>
+	void Exclude(std::vector<ValueType, AllocatorType>& VectorToExcludeFrom, const RangeToExcludeType& RangeToExclude)
+	{
+		const int KeptNum = TemplateDetails::Exclude::_<Algorithm, true>(
+			VectorToExcludeFrom.data(), static_cast<int>(VectorToExcludeFrom.size()), RangeToExclude);
+
+		VectorToExcludeFrom.erase(VectorToExcludeFrom.begin() + KeptNum, VectorToExcludeFrom.end());
+	}
+
+	template<typename ValueType, typename AllocatorType, typename RangeToExcludeType>
+	void Exclude(std::vector<ValueType, AllocatorType>& VectorToExcludeFrom, const RangeToExcludeType& RangeToExclude)
+	{
+		Exclude<TemplateDetails::Exclude::DefaultAlgorithm<ValueType>()>(VectorToExcludeFrom, RangeToExclude);
+	}
+
+	// ===============================| ExcludeSwap<...>(VectorToExcludeFrom, RangeToExclude) |=======================================
+
+	template<Utils::SetOperation::EAlgorithm Algorithm, typename ValueType, typename AllocatorType, typename RangeToExcludeType>
+	void ExcludeSwap(std::vector<ValueType, AllocatorType>& VectorToExcludeFrom, const RangeToExcludeType& RangeToExclude)
+	{
+		const int KeptNum = TemplateDetails::Exclude::_<Algorithm, false>(
+			VectorToExcludeFrom.data(), static_cast<int>(VectorToExcludeFrom.size()), RangeToExclude);
+
+		VectorToExcludeFrom.erase(VectorToExcludeFrom.begin() + KeptNum, VectorToExcludeFrom.end());
+	}
+
+	template<typename ValueType, typename AllocatorType, typename RangeToExcludeType>
+	void ExcludeSwap(std::vector<ValueType, AllocatorType>& VectorToExcludeFrom, const RangeToExcludeType& RangeToExclude)
+	{
+		ExcludeSwap<TemplateDetails::Exclude::DefaultAlgorithm<ValueType>()>(VectorToExcludeFrom, RangeToExclude);
+	}
+
+	// ===============================| ForEach<...>(Range, Func) |=======================================
+
+	template<typename RangeType, typename FuncType>
+	void ForEach(const RangeType& Range, FuncType&& Func)
+	{
+		UnrealRanges::Utils::RangeForEachWhile(Range,
+			[&Func](auto&& Element)
+			{
+				Func(std::forward<decltype(Element)>(Element));
+				return true;
+			});
+	}
+
+	// ===============================| ForEachByDistance<...>(Range, Point, Distance, LocationProj, Func) |=======================================
+
+	namespace TemplateDetails
+	{
+		namespace ForEachByDistance
+		{
+			// Number of elements which locations are gathered and checked at once
+			constexpr int BlockSize = 256;
+		}
+	}
+
+	template<Utils::Logic::EDistanceQueryPredicate DistanceQueryPredicate, typename RangeType,
+		typename PointType, typename DistanceType, typename LocationProjectionType, typename FuncType>
+	void ForEachByDistance(const RangeType& Range, const PointType& Point, const DistanceType Distance,
+		const LocationProjectionType& LocationProj, const FuncType& Func)
+	{
+		static_assert(
+			DistanceQueryPredicate == Utils::Logic::Close || DistanceQueryPredicate == Utils::Logic::Far,
+			"Invalid DistanceQueryPredicate template argument value passed");
+
+		using CoordType = std::decay_t<decltype(Point.X)>;
+		using ElementType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
+		constexpr int BlockSize = TemplateDetails::ForEachByDistance::BlockSize;
+
+		const CoordType DistanceToCheckSquared =
+			UnrealRanges::Private::Utils::ClampedDistanceSquared(static_cast<CoordType>(Distance));
+
+		CoordType X[BlockSize];
+		CoordType Y[BlockSize];
+		CoordType Z[BlockSize];
+		CoordType DistancesSquared[BlockSize];
+		int PassedIndices[BlockSize];
+
+		std::vector<ElementType> Elements;
+		Elements.reserve(BlockSize);
+
+		auto ProcessBlock = [&]()
+		{
+			const int Num = static_cast<int>(Elements.size());
+
+			const int PassedNum = UnrealRanges::Private::Simd::FilterByDistanceSquared<DistanceQueryPredicate == Utils::Logic::Close>(
+				X, Y, Z, Num, Point.X, Point.Y, Point.Z, DistanceToCheckSquared, DistancesSquared, PassedIndices);
+
+			for (int PassedIndex = 0; PassedIndex < PassedNum; ++PassedIndex)
+			{
+				const int Index = PassedIndices[PassedIndex];
+				Func(Elements[Index], DistancesSquared[Index]);
+			}
+
+			Elements.clear();
+		};
+
+		UnrealRanges::Utils::RangeForEachWhile(Range,
+			[&](const auto& Element)
+			{
+				const auto& Location = LocationProj(Element);
+				const int Index = static_cast<int>(Elements.size());
+
+				X[Index] = Location.X;
+				Y[Index] = Location.Y;
+				Z[Index] = Location.Z;
+				Elements.push_back(Element);
+
+				if (Index + 1 == BlockSize)
+				{
+					ProcessBlock();
+				}
+
+				return true;
+			});
+
+		if (!Elements.empty())
+		{
+			ProcessBlock();
+		}
+	}
+
+	// ===============================| Parallel execution |=======================================
+
+	namespace TemplateDetails
+	{
+		namespace Parallel
+		{
+			using UnrealRanges::Utils::Execution::EPolicy;
+
+			//NB: Parallel execution is used only if it is requested and Range may be split
+			// to chunks without iterating, otherwise algorithm is performed sequentially.
+			// Results of order sensitive algorithms with "Parallel" policy are same as for
+			// sequenced execution only if chunks follow Range order, so Ranges with unordered
+			// chunks (like hash containers) are processed sequentially by them
+			template<EPolicy Policy, typename RangeType, bool bOrderSensitive = true>
+			using IsParallelTag = std::integral_constant<bool,
+				Policy != UnrealRanges::Utils::Execution::Sequenced &&
+				UnrealRanges::Private::Parallel::IsChunkable<std::remove_reference_t<RangeType>>() && (
+					!bOrderSensitive || Policy == UnrealRanges::Utils::Execution::ParallelUnsequenced ||
+					UnrealRanges::Private::Parallel::IsOrderedChunkable<std::remove_reference_t<RangeType>>())>;
+
+			// ------------------------------ Find ------------------------------------
+
+			template<EPolicy Policy, typename RangeType, typename PredicateType>
+			auto FindByPredicate(RangeType& Range, const PredicateType& Pred, std::false_type)
+			{
+				return UnrealRanges::Algorithm::FindByPredicate(Range, Pred);
+			}
+
+			//NB: Chunk stops searching (cooperative cancellation) if element was found
+			// in one of the previous chunks, so the first element is returned as for
+			// sequential search. For "ParallelUnsequenced" chunk stops searching if element
+			// was found in any chunk
+			template<EPolicy Policy, typename RangeType, typename PredicateType>
+			auto FindByPredicate(RangeType& Range, const PredicateType& Pred, std::true_type)
+			{
+				using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
+				using ResultType = UnrealRanges::Utils::TUnrealRanges_Optional<ValueType>;
+
+				const int ChunksNum = UnrealRanges::Private::Parallel::ChunksNum(Range);
+				if (ChunksNum <= 1)
+				{
+					return UnrealRanges::Algorithm::FindByPredicate(Range, Pred);
+				}
+
+				std::vector<ResultType> ChunkResults(ChunksNum, UnrealRanges::Utils::MakeOptional<ValueType>());
+				std::atomic<int> FoundChunkIndex{ ChunksNum };
+
+				UnrealRanges::Private::Parallel::ForEachChunk(Range, ChunksNum,
+					[&ChunkResults, &FoundChunkIndex, &Pred, ChunksNum](const int ChunkIndex, const auto& Chunk)
+					{
+						UnrealRanges::Utils::RangeForEachWhile(Chunk,
+							[&ChunkResults, &FoundChunkIndex, &Pred, ChunksNum, ChunkIndex](const auto& Element)
+							{
+								const int CurrentFoundChunkIndex = FoundChunkIndex.load(std::memory_order_relaxed);
+								const bool bCancelled = (Policy == UnrealRanges::Utils::Execution::ParallelUnsequenced) ?
+									(CurrentFoundChunkIndex != ChunksNum) :
+									(CurrentFoundChunkIndex < ChunkIndex);
+
+								if (bCancelled)
+								{
+									return false;
+								}
+
+								if (Pred(Element))
+								{
+									ChunkResults[ChunkIndex] = UnrealRanges::Utils::MakeOptional<ValueType>(Element);
+
+									int ExpectedFoundChunkIndex = CurrentFoundChunkIndex;
+									while (ChunkIndex < ExpectedFoundChunkIndex &&
+										!FoundChunkIndex.compare_exchange_weak(ExpectedFoundChunkIndex, ChunkIndex)) { }
+
+									return false;
+								}
+
+								return true;
+							});
+					});
+
+				const int ResultChunkIndex = FoundChunkIndex.load();
+				return ResultChunkIndex < ChunksNum ?
+					ChunkResults[ResultChunkIndex] :
+					UnrealRanges::Utils::MakeOptional<ValueType>();
+			}
+
+			// ------------------------------ Select ------------------------------------
+
+			template<typename RangeType, typename ProjectionType, typename IsBetterType>
+			auto SelectBy(RangeType& Range, const ProjectionType& Proj, const IsBetterType& IsBetter, std::false_type)
+			{
+				return TemplateDetails::SelectBy::_(Range, Proj, IsBetter);
+			}
+
+			//NB: Best element of each chunk is selected in parallel, then chunks results are
+			// selected in Range order. So first best element is returned as for sequential
+			// selection
+			template<typename RangeType, typename ProjectionType, typename IsBetterType>
+			auto SelectBy(RangeType& Range, const ProjectionType& Proj, const IsBetterType& IsBetter, std::true_type)
+			{
+				using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
+				using ResultType = UnrealRanges::Utils::TUnrealRanges_Optional<ValueType>;
+
+				const int ChunksNum = UnrealRanges::Private::Parallel::ChunksNum(Range);
+				if (ChunksNum <= 1)
+				{
+					return SelectBy(Range, Proj, IsBetter, std::false_type{ });
+				}
+
+				std::vector<ResultType> ChunkResults(ChunksNum, UnrealRanges::Utils::MakeOptional<ValueType>());
+
+				UnrealRanges::Private::Parallel::ForEachChunk(Range, ChunksNum,
+					[&ChunkResults, &Proj, &IsBetter](const int ChunkIndex, const auto& Chunk)
+					{
+						ChunkResults[ChunkIndex] = SelectBy(Chunk, Proj, IsBetter, std::false_type{ });
+					});
+
+				ResultType Best = UnrealRanges::Utils::MakeOptional<ValueType>();
+				for (const ResultType& ChunkResult : ChunkResults)
+				{
+					if (UnrealRanges::Utils::IsOptionalSet(ChunkResult) && (
+						!UnrealRanges::Utils::IsOptionalSet(Best) ||
+						IsBetter(Proj(UnrealRanges::Utils::GetOptionalValue(ChunkResult)), Proj(UnrealRanges::Utils::GetOptionalValue(Best)))))
+					{
+						Best = ChunkResult;
+					}
+				}
+
+				return Best;
+			}
+
+			// ------------------------------ Count ------------------------------------
+
+			template<typename RangeType>
+			int GetRangeCount(const RangeType& Range, std::false_type)
+			{
+				return UnrealRanges::Algorithm::GetRangeCount(Range);
+			}
+
+			//NB: Sized ranges are counted in constant time, other chunkable ranges (like
+			// filtered ranges) are counted by chunks in parallel
+			template<typename RangeType>
+			int GetRangeCount(const RangeType& Range, std::true_type)
+			{
+				if (UnrealRanges::Utils::IsSizedRange<RangeType>())
+				{
+					return UnrealRanges::Algorithm::GetRangeCount(Range);
+				}
+
+				const int ChunksNum = UnrealRanges::Private::Parallel::ChunksNum(Range);
+				if (ChunksNum <= 1)
+				{
+					return UnrealRanges::Algorithm::GetRangeCount(Range);
+				}
+
+				std::vector<int> ChunkCounts(ChunksNum, 0);
+
+				UnrealRanges::Private::Parallel::ForEachChunk(Range, ChunksNum,
+					[&ChunkCounts](const int ChunkIndex, const auto& Chunk)
+					{
+						ChunkCounts[ChunkIndex] = UnrealRanges::Algorithm::GetRangeCount(Chunk);
+					});
+
+				int Count = 0;
+				for (const int ChunkCount : ChunkCounts)
+				{
+					Count += ChunkCount;
+				}
+
+				return Count;
+			}
+
+			// ------------------------------ Collect ------------------------------------
+
+			template<EPolicy Policy, typename CollectionType, typename RangeType, typename AddAllSequentiallyType>
+			void AddAllFromRange(CollectionType&, const RangeType&,
+				const AddAllSequentiallyType& AddAllSequentially, std::false_type)
+			{
+				AddAllSequentially();
+			}
+
+			template<typename CollectionType, typename BufferType>
+			void MoveBuffer(CollectionType& Collection, BufferType& Buffer)
+			{
+				for (auto& Element : Buffer)
+				{
+					UnrealRanges::Algorithm::TemplateDetails::CollectionSink::Add(Collection, std::move(Element), 0);
+				}
+			}
+
+			//NB: Chunks are collected to local buffers in parallel. For "Parallel" buffers
+			// are moved to "Collection" in chunks order after single reservation for all
+			// collected elements. For "ParallelUnsequenced" each buffer is moved to
+			// "Collection" under lock as soon as its chunk is collected, so moving is
+			// overlapped with collecting of other chunks, but chunks order is not kept
+			template<EPolicy Policy, typename CollectionType, typename RangeType, typename AddAllSequentiallyType>
+			void AddAllFromRange(CollectionType& Collection, const RangeType& Range,
+				const AddAllSequentiallyType& AddAllSequentially, std::true_type)
+			{
+				using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
+				using BufferType = std::vector<ValueType>;
+
+				const int ChunksNum = UnrealRanges::Private::Parallel::ChunksNum(Range);
+				if (ChunksNum <= 1)
+				{
+					AddAllSequentially();
+					return;
+				}
+
+				if (Policy == UnrealRanges::Utils::Execution::ParallelUnsequenced)
+				{
+					UnrealRanges::Algorithm::TemplateDetails::CollectionSink::ReserveExact(Collection, Range, 0);
+
+					std::mutex CollectionMutex;
+					UnrealRanges::Private::Parallel::ForEachChunk(Range, ChunksNum,
+						[&Collection, &CollectionMutex](const int, const auto& Chunk)
+						{
+							BufferType ChunkBuffer;
+							UnrealRanges::Algorithm::TemplateDetails::CollectionSink::AddAll(ChunkBuffer, Chunk);
+
+							std::lock_guard<std::mutex> Lock{ CollectionMutex };
+							MoveBuffer(Collection, ChunkBuffer);
+						});
+
+					return;
+				}
+
+				std::vector<BufferType> ChunkBuffers(ChunksNum);
+
+				UnrealRanges::Private::Parallel::ForEachChunk(Range, ChunksNum,
+					[&ChunkBuffers](const int ChunkIndex, const auto& Chunk)
+					{
+						UnrealRanges::Algorithm::TemplateDetails::CollectionSink::AddAll(ChunkBuffers[ChunkIndex], Chunk);
+					});
+
+				std::size_t CollectedNum = 0;
+				for (const BufferType& ChunkBuffer : ChunkBuffers)
+				{
+					CollectedNum += ChunkBuffer.size();
+				}
+
+				UnrealRanges::Algorithm::TemplateDetails::CollectionSink::Reserve(Collection, CollectedNum, 0);
+				for (BufferType& ChunkBuffer : ChunkBuffers)
+				{
+					MoveBuffer(Collection, ChunkBuffer);
+				}
+			}
+		}
+	}
+
+	template<Utils::Execution::EPolicy Policy, typename RangeType, typename ValueType>
+	bool Contains(RangeType&& Range, ValueType&& Value)
+	{
+		return ContainsByPredicate<Policy>(Range,
+			[&Value](const auto& Element)
+			{
+				return Element == Value;
+			});
+	}
+
+	template<Utils::Execution::EPolicy Policy, typename RangeType, typename PredicateType>
+	bool ContainsByPredicate(RangeType&& Range, PredicateType&& Pred)
+	{
+		return UnrealRanges::Utils::IsOptionalSet(
+			FindByPredicate<Policy>(Range, Pred)
+		);
+	}
+
+	template<Utils::Execution::EPolicy Policy, typename RangeType, typename PredicateType>
+	auto FindByPredicate(RangeType&& Range, PredicateType&& Pred)
+	{
+		return TemplateDetails::Parallel::FindByPredicate<Policy>(Range, Pred,
+			TemplateDetails::Parallel::IsParallelTag<Policy, RangeType>{ });
+	}
+
+	template<Utils::Execution::EPolicy Policy, typename RangeType, typename ProjectionType>
+	auto MinElementBy(RangeType&& Range, ProjectionType&& Proj)
+	{
+		return TemplateDetails::Parallel::SelectBy(Range, Proj, TemplateDetails::SelectBy::FIsLess{ },
+			TemplateDetails::Parallel::IsParallelTag<Policy, RangeType>{ });
+	}
+
+	template<Utils::Execution::EPolicy Policy, typename RangeType, typename ProjectionType>
+	auto MaxElementBy(RangeType&& Range, ProjectionType&& Proj)
+	{
+		return TemplateDetails::Parallel::SelectBy(Range, Proj, TemplateDetails::SelectBy::FIsGreater{ },
+			TemplateDetails::Parallel::IsParallelTag<Policy, RangeType>{ });
+	}
+
+	template<Utils::Execution::EPolicy Policy, typename RangeType>
+	int GetRangeCount(const RangeType& Range)
+	{
+		return TemplateDetails::Parallel::GetRangeCount(Range,
+			TemplateDetails::Parallel::IsParallelTag<Policy, RangeType, false>{ });
+	}
+
+	template<Utils::Execution::EPolicy Policy, typename ValueType, typename RangeType>
+	bool EqualsToSome(const ValueType& Value, const RangeType& Range)
+	{
+		return Contains<Policy>(Range, Value);
+	}
+
+	template<Utils::Execution::EPolicy Policy, typename CollectionToFill, typename SourceRangeType>
+	void AddAllFromRange(CollectionToFill& Collection, const SourceRangeType& SourceRange)
+	{
+		TemplateDetails::Parallel::AddAllFromRange<Policy>(Collection, SourceRange,
+			[&Collection, &SourceRange]()
+			{
+				UnrealRanges::Algorithm::AddAllFromRange(Collection, SourceRange);
+			},
+			TemplateDetails::Parallel::IsParallelTag<Policy, SourceRangeType>{ });
+	}
+
+	template<Utils::Execution::EPolicy Policy, typename CollectionType, typename RangeType, typename... CollectionArgTypes>
+	CollectionType RangeToCollection(const RangeType& Range, CollectionArgTypes&&... CollectionArgs)
+	{
+		CollectionType Result(std::forward<CollectionArgTypes>(CollectionArgs)...);
+
+		TemplateDetails::Parallel::AddAllFromRange<Policy>(Result, Range,
+			[&Result, &Range]()
+			{
+				TemplateDetails::CollectionSink::ReserveMax(Result, Range, 0);
+				TemplateDetails::CollectionSink::AddAll(Result, Range);
+			},
+			TemplateDetails::Parallel::IsParallelTag<Policy, RangeType>{ });
+
+		return Result;
+	}
+
+	template<Utils::Execution::EPolicy Policy, typename RangeType>
+	auto RangeToVector(const RangeType& Range)
+	{
+		using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
+
+		return RangeToCollection<Policy, std::vector<ValueType>>(Range);
+	}
+
 }} // namespace UnrealRanges::Algorithm
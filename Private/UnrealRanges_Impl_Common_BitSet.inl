@@ -0,0 +1,716 @@
+#pragma once
+
+#include "../UnrealRanges_Utils.h"//for "Check()"
+
+#include <cstdint>//for "std::uint64_t"
+#include <vector>//for "TSparseBitSet<>" storage
+#include <algorithm>//for "std::lower_bound()"
+#include <initializer_list>
+
+#if defined(_MSC_VER)
+#	include <intrin.h>//for "__popcnt64()", "_BitScanForward64()"
+#endif
+
+namespace UnrealRanges{ namespace Utils{
+
+	namespace TemplateDetails
+	{
+		namespace BitSet
+		{
+			using WordType = std::uint64_t;
+
+			constexpr int WordBitsNum = 64;
+
+			constexpr int WordsNum(const int BitsNum)
+			{
+				return (BitsNum + WordBitsNum - 1) / WordBitsNum;
+			}
+
+			inline int PopCount(const WordType Word)
+			{
+#if defined(_MSC_VER) && defined(_M_X64)
+				return static_cast<int>(__popcnt64(Word));
+#elif defined(__GNUC__) || defined(__clang__)
+				return __builtin_popcountll(Word);
+#else
+				WordType Value = Word - ((Word >> 1) & 0x5555555555555555ull);
+				Value = (Value & 0x3333333333333333ull) + ((Value >> 2) & 0x3333333333333333ull);
+				Value = (Value + (Value >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+				return static_cast<int>((Value * 0x0101010101010101ull) >> 56);
+#endif
+			}
+
+			//NB: "Word" should not be zero
+			inline int CountTrailingZeros(const WordType Word)
+			{
+#if defined(_MSC_VER) && defined(_M_X64)
+				unsigned long Index = 0;
+				_BitScanForward64(&Index, Word);
+				return static_cast<int>(Index);
+#elif defined(__GNUC__) || defined(__clang__)
+				return __builtin_ctzll(Word);
+#else
+				int Index = 0;
+				for (WordType Current = Word; (Current & 1) == 0; Current >>= 1)
+				{
+					++Index;
+				}
+				return Index;
+#endif
+			}
+
+			//NB: Operation is constant, so branches are switched out on optimize builds
+			template<int Operation>
+			WordType CombineWords(const WordType WordA, const WordType WordB)
+			{
+				WordType Result = 0;
+
+				if ((Operation & SetOperation::A_B) != 0)
+				{
+					Result |= WordA & ~WordB;
+				}
+
+				if ((Operation & SetOperation::B_A) != 0)
+				{
+					Result |= WordB & ~WordA;
+				}
+
+				if ((Operation & SetOperation::AnB) != 0)
+				{
+					Result |= WordA & WordB;
+				}
+
+				return Result;
+			}
+
+			// Iterates set bits of words array
+			template<typename ElementType>
+			class TBitsIterator
+			{
+			public:
+
+				TBitsIterator(const WordType* InWords, const int InWordsNum, const int InWordIndex, const std::uint32_t InBase)
+					: Words(InWords), WordsNum(InWordsNum), WordIndex(InWordIndex), Base(InBase)
+				{
+					CurrentWord = WordIndex < WordsNum ? Words[WordIndex] : 0;
+					Seek();
+				}
+
+				ElementType operator*() const
+				{
+					return static_cast<ElementType>(
+						Base + static_cast<std::uint32_t>(WordIndex * WordBitsNum + CountTrailingZeros(CurrentWord)));
+				}
+
+				void operator++()
+				{
+					CurrentWord &= CurrentWord - 1;
+					Seek();
+				}
+
+				bool operator!=(const TBitsIterator& Other) const
+				{
+					return WordIndex != Other.WordIndex || CurrentWord != Other.CurrentWord;
+				}
+
+				bool IsEnd() const
+				{
+					return WordIndex >= WordsNum;
+				}
+
+			private:
+
+				void Seek()
+				{
+					while (CurrentWord == 0 && WordIndex < WordsNum)
+					{
+						++WordIndex;
+						CurrentWord = WordIndex < WordsNum ? Words[WordIndex] : 0;
+					}
+				}
+
+				const WordType* Words = nullptr;
+				int WordsNum = 0;
+				int WordIndex = 0;
+				WordType CurrentWord = 0;
+				std::uint32_t Base = 0;
+			};
+		}
+	}
+
+	// ===============================| TFixedBitSet |=======================================
+
+	template<typename ElementType, int BitsNum>
+	class TFixedBitSet
+	{
+		static_assert(BitsNum > 0, "Bit set should have at least one bit");
+
+		using WordType = TemplateDetails::BitSet::WordType;
+		static constexpr int WordsNum = TemplateDetails::BitSet::WordsNum(BitsNum);
+
+	public:
+		using Iterator = TemplateDetails::BitSet::TBitsIterator<ElementType>;
+
+		TFixedBitSet() { }
+
+		TFixedBitSet(std::initializer_list<ElementType> Elements)
+		{
+			for (const ElementType Element : Elements)
+			{
+				Add(Element);
+			}
+		}
+
+		void Add(const ElementType Element)
+		{
+			const int Index = ToIndex(Element);
+			Words[Index / TemplateDetails::BitSet::WordBitsNum] |= WordType{ 1 } << (Index % TemplateDetails::BitSet::WordBitsNum);
+		}
+
+		void Remove(const ElementType Element)
+		{
+			const int Index = ToIndex(Element);
+			Words[Index / TemplateDetails::BitSet::WordBitsNum] &= ~(WordType{ 1 } << (Index % TemplateDetails::BitSet::WordBitsNum));
+		}
+
+		bool Contains(const ElementType Element) const
+		{
+			const int Index = static_cast<int>(Element);
+			return Index >= 0 && Index < BitsNum &&
+				(Words[Index / TemplateDetails::BitSet::WordBitsNum] >> (Index % TemplateDetails::BitSet::WordBitsNum)) & 1;
+		}
+
+		void Reset()
+		{
+			for (WordType& Word : Words)
+			{
+				Word = 0;
+			}
+		}
+
+		int Num() const
+		{
+			int Result = 0;
+			for (const WordType Word : Words)
+			{
+				Result += TemplateDetails::BitSet::PopCount(Word);
+			}
+
+			return Result;
+		}
+
+		bool IsEmpty() const
+		{
+			for (const WordType Word : Words)
+			{
+				if (Word != 0)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		Iterator begin() const
+		{
+			return { Words, WordsNum, 0, 0u };
+		}
+
+		Iterator end() const
+		{
+			return { Words, WordsNum, WordsNum, 0u };
+		}
+
+		template<int Operation>
+		static TFixedBitSet Combine(const TFixedBitSet& SetA, const TFixedBitSet& SetB)
+		{
+			TFixedBitSet Result;
+			for (int WordIndex = 0; WordIndex < WordsNum; ++WordIndex)
+			{
+				Result.Words[WordIndex] = TemplateDetails::BitSet::CombineWords<Operation>(SetA.Words[WordIndex], SetB.Words[WordIndex]);
+			}
+
+			return Result;
+		}
+
+	private:
+
+		static int ToIndex(const ElementType Element)
+		{
+			const int Index = static_cast<int>(Element);
+			UnrealRanges::Utils::Check(Index >= 0 && Index < BitsNum, "Element is out of bit set domain");
+			return Index;
+		}
+
+		WordType Words[WordsNum] = { };
+	};
+
+	// ===============================| TSparseBitSet |=======================================
+
+	template<typename ElementType>
+	class TSparseBitSet
+	{
+		using WordType = TemplateDetails::BitSet::WordType;
+
+		static constexpr int ContainerBitsNum = 1 << 16;
+		static constexpr int ContainerWordsNum = TemplateDetails::BitSet::WordsNum(ContainerBitsNum);
+
+		//NB: Sorted array of 16 bit values takes same memory as bitmap with this number of values
+		static constexpr int ArrayMaxNum = ContainerBitsNum / 16;
+
+		struct FContainer
+		{
+			bool IsBitmap() const
+			{
+				return !Bitmap.empty();
+			}
+
+			std::uint16_t Key = 0;
+			int Num = 0;
+			std::vector<std::uint16_t> Array;//sorted, used while "Bitmap" is empty
+			std::vector<WordType> Bitmap;
+		};
+
+	public:
+
+		class Iterator
+		{
+		public:
+
+			Iterator(const std::vector<FContainer>& InContainers, const int InContainerIndex)
+				: Containers(&InContainers), ContainerIndex(InContainerIndex)
+			{
+				StartContainer();
+			}
+
+			ElementType operator*() const
+			{
+				const FContainer& Container = (*Containers)[ContainerIndex];
+				return Container.IsBitmap() ?
+					*Bits :
+					static_cast<ElementType>((static_cast<std::uint32_t>(Container.Key) << 16) | Container.Array[ArrayIndex]);
+			}
+
+			void operator++()
+			{
+				const FContainer& Container = (*Containers)[ContainerIndex];
+				if (Container.IsBitmap())
+				{
+					++Bits;
+					if (Bits.IsEnd())
+					{
+						++ContainerIndex;
+						StartContainer();
+					}
+				}
+				else if (++ArrayIndex >= static_cast<int>(Container.Array.size()))
+				{
+					++ContainerIndex;
+					StartContainer();
+				}
+			}
+
+			bool operator!=(const Iterator& Other) const
+			{
+				return ContainerIndex != Other.ContainerIndex || ArrayIndex != Other.ArrayIndex || Bits != Other.Bits;
+			}
+
+		private:
+
+			//NB: Containers are never empty, so first element of container always exists
+			void StartContainer()
+			{
+				ArrayIndex = 0;
+
+				const bool bBitmap = ContainerIndex < static_cast<int>(Containers->size()) && (*Containers)[ContainerIndex].IsBitmap();
+				Bits = bBitmap ?
+					BitsIteratorType{
+						(*Containers)[ContainerIndex].Bitmap.data(), ContainerWordsNum, 0,
+						static_cast<std::uint32_t>((*Containers)[ContainerIndex].Key) << 16 } :
+					BitsIteratorType{ nullptr, 0, 0, 0u };
+			}
+
+			using BitsIteratorType = TemplateDetails::BitSet::TBitsIterator<ElementType>;
+
+			const std::vector<FContainer>* Containers = nullptr;
+			int ContainerIndex = 0;
+			int ArrayIndex = 0;
+			BitsIteratorType Bits{ nullptr, 0, 0, 0u };
+		};
+
+		TSparseBitSet() { }
+
+		TSparseBitSet(std::initializer_list<ElementType> Elements)
+		{
+			for (const ElementType Element : Elements)
+			{
+				Add(Element);
+			}
+		}
+
+		void Add(const ElementType Element)
+		{
+			const std::uint32_t Value = static_cast<std::uint32_t>(Element);
+			const std::uint16_t Low = static_cast<std::uint16_t>(Value & 0xFFFF);
+
+			FContainer& Container = FindOrAddContainer(static_cast<std::uint16_t>(Value >> 16));
+
+			if (Container.IsBitmap())
+			{
+				WordType& Word = Container.Bitmap[Low / TemplateDetails::BitSet::WordBitsNum];
+				const WordType Bit = WordType{ 1 } << (Low % TemplateDetails::BitSet::WordBitsNum);
+				Container.Num += (Word & Bit) ? 0 : 1;
+				Word |= Bit;
+				return;
+			}
+
+			const auto Position = std::lower_bound(Container.Array.begin(), Container.Array.end(), Low);
+			if (Position != Container.Array.end() && *Position == Low)
+			{
+				return;
+			}
+
+			Container.Array.insert(Position, Low);
+			++Container.Num;
+
+			if (Container.Num > ArrayMaxNum)
+			{
+				ConvertToBitmap(Container);
+			}
+		}
+
+		void Remove(const ElementType Element)
+		{
+			const std::uint32_t Value = static_cast<std::uint32_t>(Element);
+			const std::uint16_t Low = static_cast<std::uint16_t>(Value & 0xFFFF);
+
+			const auto ContainerPosition = LowerBound(static_cast<std::uint16_t>(Value >> 16));
+			if (ContainerPosition == Containers.end() || ContainerPosition->Key != static_cast<std::uint16_t>(Value >> 16))
+			{
+				return;
+			}
+
+			FContainer& Container = *ContainerPosition;
+
+			if (Container.IsBitmap())
+			{
+				WordType& Word = Container.Bitmap[Low / TemplateDetails::BitSet::WordBitsNum];
+				const WordType Bit = WordType{ 1 } << (Low % TemplateDetails::BitSet::WordBitsNum);
+				Container.Num -= (Word & Bit) ? 1 : 0;
+				Word &= ~Bit;
+			}
+			else
+			{
+				const auto Position = std::lower_bound(Container.Array.begin(), Container.Array.end(), Low);
+				if (Position != Container.Array.end() && *Position == Low)
+				{
+					Container.Array.erase(Position);
+					--Container.Num;
+				}
+			}
+
+			if (Container.Num == 0)
+			{
+				Containers.erase(ContainerPosition);
+			}
+		}
+
+		bool Contains(const ElementType Element) const
+		{
+			const std::uint32_t Value = static_cast<std::uint32_t>(Element);
+			const std::uint16_t Low = static_cast<std::uint16_t>(Value & 0xFFFF);
+
+			const auto ContainerPosition = LowerBound(static_cast<std::uint16_t>(Value >> 16));
+			if (ContainerPosition == Containers.end() || ContainerPosition->Key != static_cast<std::uint16_t>(Value >> 16))
+			{
+				return false;
+			}
+
+			const FContainer& Container = *ContainerPosition;
+
+			return Container.IsBitmap() ?
+				((Container.Bitmap[Low / TemplateDetails::BitSet::WordBitsNum] >> (Low % TemplateDetails::BitSet::WordBitsNum)) & 1) != 0 :
+				std::binary_search(Container.Array.begin(), Container.Array.end(), Low);
+		}
+
+		void Reset()
+		{
+			Containers.clear();
+		}
+
+		int Num() const
+		{
+			int Result = 0;
+			for (const FContainer& Container : Containers)
+			{
+				Result += Container.Num;
+			}
+
+			return Result;
+		}
+
+		bool IsEmpty() const
+		{
+			return Containers.empty();
+		}
+
+		Iterator begin() const
+		{
+			return { Containers, 0 };
+		}
+
+		Iterator end() const
+		{
+			return { Containers, static_cast<int>(Containers.size()) };
+		}
+
+		template<int Operation>
+		static TSparseBitSet Combine(const TSparseBitSet& SetA, const TSparseBitSet& SetB)
+		{
+			TSparseBitSet Result;
+
+			auto ACurrent = SetA.Containers.begin();
+			auto BCurrent = SetB.Containers.begin();
+
+			while (ACurrent != SetA.Containers.end() || BCurrent != SetB.Containers.end())
+			{
+				const bool bAEnd = ACurrent == SetA.Containers.end();
+				const bool bBEnd = BCurrent == SetB.Containers.end();
+
+				if (!bAEnd && (bBEnd || ACurrent->Key < BCurrent->Key))
+				{
+					if ((Operation & SetOperation::A_B) != 0)
+					{
+						Result.Containers.push_back(*ACurrent);
+					}
+
+					++ACurrent;
+				}
+				else if (!bBEnd && (bAEnd || BCurrent->Key < ACurrent->Key))
+				{
+					if ((Operation & SetOperation::B_A) != 0)
+					{
+						Result.Containers.push_back(*BCurrent);
+					}
+
+					++BCurrent;
+				}
+				else
+				{
+					FContainer Combined = CombineContainers<Operation>(*ACurrent, *BCurrent);
+					if (Combined.Num > 0)
+					{
+						Result.Containers.push_back(std::move(Combined));
+					}
+
+					++ACurrent;
+					++BCurrent;
+				}
+			}
+
+			return Result;
+		}
+
+	private:
+
+		typename std::vector<FContainer>::iterator LowerBound(const std::uint16_t Key)
+		{
+			return std::lower_bound(Containers.begin(), Containers.end(), Key,
+				[](const FContainer& Container, const std::uint16_t Key) { return Container.Key < Key; });
+		}
+
+		typename std::vector<FContainer>::const_iterator LowerBound(const std::uint16_t Key) const
+		{
+			return std::lower_bound(Containers.begin(), Containers.end(), Key,
+				[](const FContainer& Container, const std::uint16_t Key) { return Container.Key < Key; });
+		}
+
+		FContainer& FindOrAddContainer(const std::uint16_t Key)
+		{
+			const auto Position = LowerBound(Key);
+			if (Position != Containers.end() && Position->Key == Key)
+			{
+				return *Position;
+			}
+
+			FContainer NewContainer;
+			NewContainer.Key = Key;
+			return *Containers.insert(Position, std::move(NewContainer));
+		}
+
+		static void ConvertToBitmap(FContainer& Container)
+		{
+			Container.Bitmap.assign(ContainerWordsNum, 0);
+			for (const std::uint16_t Low : Container.Array)
+			{
+				Container.Bitmap[Low / TemplateDetails::BitSet::WordBitsNum] |= WordType{ 1 } << (Low % TemplateDetails::BitSet::WordBitsNum);
+			}
+
+			Container.Array.clear();
+			Container.Array.shrink_to_fit();
+		}
+
+		static void ConvertToArray(FContainer& Container)
+		{
+			Container.Array.reserve(Container.Num);
+			for (TemplateDetails::BitSet::TBitsIterator<std::uint32_t> Current{ Container.Bitmap.data(), ContainerWordsNum, 0, 0u };
+				!Current.IsEnd(); ++Current)
+			{
+				Container.Array.push_back(static_cast<std::uint16_t>(*Current));
+			}
+
+			Container.Bitmap.clear();
+			Container.Bitmap.shrink_to_fit();
+		}
+
+		template<int Operation>
+		static FContainer CombineContainers(const FContainer& ContainerA, const FContainer& ContainerB)
+		{
+			FContainer Result;
+			Result.Key = ContainerA.Key;
+
+			if (!ContainerA.IsBitmap() && !ContainerB.IsBitmap())
+			{
+				// Both containers are small: sorted merge
+				auto ACurrent = ContainerA.Array.begin();
+				auto BCurrent = ContainerB.Array.begin();
+
+				while (ACurrent != ContainerA.Array.end() || BCurrent != ContainerB.Array.end())
+				{
+					const bool bAEnd = ACurrent == ContainerA.Array.end();
+					const bool bBEnd = BCurrent == ContainerB.Array.end();
+
+					if (!bAEnd && (bBEnd || *ACurrent < *BCurrent))
+					{
+						if ((Operation & SetOperation::A_B) != 0)
+						{
+							Result.Array.push_back(*ACurrent);
+						}
+
+						++ACurrent;
+					}
+					else if (!bBEnd && (bAEnd || *BCurrent < *ACurrent))
+					{
+						if ((Operation & SetOperation::B_A) != 0)
+						{
+							Result.Array.push_back(*BCurrent);
+						}
+
+						++BCurrent;
+					}
+					else
+					{
+						if ((Operation & SetOperation::AnB) != 0)
+						{
+							Result.Array.push_back(*ACurrent);
+						}
+
+						++ACurrent;
+						++BCurrent;
+					}
+				}
+
+				Result.Num = static_cast<int>(Result.Array.size());
+
+				if (Result.Num > ArrayMaxNum)
+				{
+					ConvertToBitmap(Result);
+				}
+
+				return Result;
+			}
+
+			// At least one container is big: small one is expanded to temporary
+			// bitmap and containers are combined word-at-a-time
+			FContainer ExpandedA;
+			if (!ContainerA.IsBitmap())
+			{
+				ExpandedA = ContainerA;
+				ConvertToBitmap(ExpandedA);
+			}
+
+			FContainer ExpandedB;
+			if (!ContainerB.IsBitmap())
+			{
+				ExpandedB = ContainerB;
+				ConvertToBitmap(ExpandedB);
+			}
+
+			const std::vector<WordType>& WordsA = ContainerA.IsBitmap() ? ContainerA.Bitmap : ExpandedA.Bitmap;
+			const std::vector<WordType>& WordsB = ContainerB.IsBitmap() ? ContainerB.Bitmap : ExpandedB.Bitmap;
+
+			Result.Bitmap.resize(ContainerWordsNum);
+			for (int WordIndex = 0; WordIndex < ContainerWordsNum; ++WordIndex)
+			{
+				const WordType Word = TemplateDetails::BitSet::CombineWords<Operation>(WordsA[WordIndex], WordsB[WordIndex]);
+				Result.Bitmap[WordIndex] = Word;
+				Result.Num += TemplateDetails::BitSet::PopCount(Word);
+			}
+
+			if (Result.Num <= ArrayMaxNum)
+			{
+				ConvertToArray(Result);
+			}
+
+			return Result;
+		}
+
+		std::vector<FContainer> Containers;//sorted by "Key"
+	};
+
+	// ===============================| RangeToBitSet<...>(Range) |=======================================
+
+	template<typename BitSetType, typename RangeType>
+	BitSetType RangeToBitSet(const RangeType& Range)
+	{
+		BitSetType Result;
+		for (auto&& Element : Range)
+		{
+			Result.Add(Element);
+		}
+
+		return Result;
+	}
+
+}}//namespace UnrealRanges::Utils
+
+namespace UnrealRanges{
+
+	// ===============================| Set operations on bit sets |=======================================
+
+	namespace TemplateDetails
+	{
+		namespace SetOperationRange
+		{
+			template<typename ElementType, int BitsNum>
+			struct TNativeOperation<Utils::TFixedBitSet<ElementType, BitsNum>, Utils::TFixedBitSet<ElementType, BitsNum>>
+			{
+				static constexpr bool bSupported = true;
+
+				template<int Operation>
+				static Utils::TFixedBitSet<ElementType, BitsNum> Make(
+					const Utils::TFixedBitSet<ElementType, BitsNum>& SetA,
+					const Utils::TFixedBitSet<ElementType, BitsNum>& SetB)
+				{
+					return Utils::TFixedBitSet<ElementType, BitsNum>::template Combine<Operation>(SetA, SetB);
+				}
+			};
+
+			template<typename ElementType>
+			struct TNativeOperation<Utils::TSparseBitSet<ElementType>, Utils::TSparseBitSet<ElementType>>
+			{
+				static constexpr bool bSupported = true;
+
+				template<int Operation>
+				static Utils::TSparseBitSet<ElementType> Make(
+					const Utils::TSparseBitSet<ElementType>& SetA,
+					const Utils::TSparseBitSet<ElementType>& SetB)
+				{
+					return Utils::TSparseBitSet<ElementType>::template Combine<Operation>(SetA, SetB);
+				}
+			};
+		}
+	}
+
+} // namespace UnrealRanges
@@ -6,7 +6,12 @@
 // - "UnrealRanges::Utils::GetMemberValue()"
 #include "../UnrealRanges_Utils.h"
 
+//For:
+// - SIMD kernels for skipping of excluded elements
+#include "UnrealRanges_Private_Simd.h"
+
 #include <utility> //for "std::forward<...>"
+#include <type_traits> //for "std::enable_if_t<>"
 
 namespace UnrealRanges{
 
@@ -17,7 +22,7 @@ namespace UnrealRanges{
 	template<Utils::Logic::ELogicInvertion LogicInversion, typename FieldOrMethodPointer, typename ... MethodArgTypes>
 	auto RangeFilteredBy(FieldOrMethodPointer MemberPointer, MethodArgTypes&& ... MethodArgs)
 	{
-		return FilteredRange([MemberPointer, MethodArgs ...](auto Value)
+		return FilteredRange([MemberPointer, MethodArgs ...](auto&& Value)
 		{
 			const bool bValueCheckResult = static_cast<bool>(GetMemberValue(Value, MemberPointer, MethodArgs ...));
 			return Utils::CheckBoolWithInvertionCondition<LogicInversion>(bValueCheckResult);
@@ -37,7 +42,7 @@ namespace UnrealRanges{
 	template<typename MemberPointerType, typename ... MethodArgTypes>
 	auto RangeTransformedBy(MemberPointerType MemberPointer, MethodArgTypes&& ... MethodArgs)
 	{
-		return TransformedRange([MemberPointer, MethodArgs ...](auto Value)
+		return TransformedRange([MemberPointer, MethodArgs ...](auto&& Value)
 		{
 			return Utils::GetMemberValue(Value, MemberPointer, MethodArgs ...);
 		});
@@ -45,13 +50,54 @@ namespace UnrealRanges{
 
 	// =======================| FilterExclude<...>(ElementToIgnore) |=========================
 
+	namespace TemplateDetails
+	{
+		namespace FilterExclude
+		{
+			//NB: Excluded elements are usually rare, so SIMD kernel is used only to skip
+			// sequence of excluded elements in contiguous Parent Range
+			template<typename ParentIteratorType, typename ElementType>
+			auto Ignore(ParentIteratorType& Current, const ParentIteratorType& End, const ElementType& ElementToIgnore, int)->
+				std::enable_if_t<
+					UnrealRanges::Private::Simd::IsVectorizableIterator<ParentIteratorType>() &&
+					std::is_same<std::remove_cv_t<std::remove_reference_t<decltype(*Current)>>, ElementType>::value>
+			{
+				if (Current != End && *Current == ElementToIgnore)
+				{
+					Current += UnrealRanges::Private::Simd::FindNotEqual(&*Current, static_cast<int>(End - Current), ElementToIgnore);
+				}
+			}
+
+			template<typename ParentIteratorType, typename ElementType>
+			void Ignore(ParentIteratorType& Current, const ParentIteratorType& End, const ElementType& ElementToIgnore, ...)
+			{
+				for (; Current != End && !(*Current != ElementToIgnore); ++Current);
+			}
+		}
+	}
+
+	template<typename ParentIteratorType, typename ElementType>
+	struct TFilterExcludeLogic
+	{
+		using SettingType = ElementType;
+
+		static constexpr bool bSizePreserving = false;
+
+		static decltype(auto) Get(const ParentIteratorType& Current, const SettingType& Setting)
+		{
+			return *Current;
+		}
+
+		static void Ignore(ParentIteratorType& Current, const ParentIteratorType& End, const SettingType& Setting)
+		{
+			TemplateDetails::FilterExclude::Ignore(Current, End, Setting, 0);
+		}
+	};
+
 	template<typename ElementType>
 	auto FilterExclude(ElementType ElementToIgnore)
 	{
-		return FilteredRange([ElementToIgnore](auto Value)
-		{
-			return (Value != ElementToIgnore);
-		});
+		return TBasicRange<UnrealRanges::Private::Utils::DummyType, TFilterExcludeLogic, ElementType>{ std::move(ElementToIgnore) };
 	}
 
 } //namespace UnrealRanges
@@ -9,6 +9,7 @@
 #include "Containers/Array.h"
 #include "Math/Vector.h"
 #include "Misc/Optional.h"
+#include "Math/NumericLimits.h"//for not limited "ClosestActors<...>()"
 
 //Std
 #include <type_traits> //for std::underlying_type_t<>
@@ -17,30 +18,101 @@ namespace UnrealRanges{ namespace Algorithm{
 
 	// ===============================| Exclude<...>(ArrayToExcludeFrom, RangeToExclude) |=======================================
 
+	template <Utils::SetOperation::EAlgorithm Algorithm, typename ValueType, typename AllocatorType, typename RangeToExcludeType>
+	void Exclude(TArray<ValueType, AllocatorType>& ArrayToExcludeFrom, const RangeToExcludeType& RangeToExclude)
+	{
+		const int32 Num = ArrayToExcludeFrom.Num();
+		const int32 KeptNum = UnrealRanges::Algorithm::TemplateDetails::Exclude::_<Algorithm, true>(
+			ArrayToExcludeFrom.GetData(), Num, RangeToExclude);
+
+		ArrayToExcludeFrom.RemoveAt(KeptNum, Num - KeptNum);
+	}
+
 	template <typename ValueType, typename AllocatorType, typename RangeToExcludeType>
 	void Exclude(TArray<ValueType, AllocatorType>& ArrayToExcludeFrom, const RangeToExcludeType& RangeToExclude)
 	{
-		for (auto&& ElementToExclude : RangeToExclude)
-		{
-			ArrayToExcludeFrom.Remove(ElementToExclude);
-		}
+		Exclude<UnrealRanges::Algorithm::TemplateDetails::Exclude::DefaultAlgorithm<ValueType>()>(
+			ArrayToExcludeFrom, RangeToExclude);
+	}
+
+	// ===============================| ExcludeSwap<...>(ArrayToExcludeFrom, RangeToExclude) |=======================================
+
+	template <Utils::SetOperation::EAlgorithm Algorithm, typename ValueType, typename AllocatorType, typename RangeToExcludeType>
+	void ExcludeSwap(TArray<ValueType, AllocatorType>& ArrayToExcludeFrom, const RangeToExcludeType& RangeToExclude)
+	{
+		const int32 Num = ArrayToExcludeFrom.Num();
+		const int32 KeptNum = UnrealRanges::Algorithm::TemplateDetails::Exclude::_<Algorithm, false>(
+			ArrayToExcludeFrom.GetData(), Num, RangeToExclude);
+
+		ArrayToExcludeFrom.RemoveAt(KeptNum, Num - KeptNum);
+	}
+
+	template <typename ValueType, typename AllocatorType, typename RangeToExcludeType>
+	void ExcludeSwap(TArray<ValueType, AllocatorType>& ArrayToExcludeFrom, const RangeToExcludeType& RangeToExclude)
+	{
+		ExcludeSwap<UnrealRanges::Algorithm::TemplateDetails::Exclude::DefaultAlgorithm<ValueType>()>(
+			ArrayToExcludeFrom, RangeToExclude);
 	}
 
 	// ===============================| ClosestActorWithDistance<...>(Point, Range) |=======================================
 
-	template<typename RangeType>
-	auto ClosestActorWithDistance(const FVector& Point, RangeType&& Range)
+	namespace TemplateDetails
 	{
-		//TODO: Add static check "IsActorsRange()" in the beginning
+		namespace ClosestActorWithDistance
+		{
+			//Spatial grids (see "TActorsSpatialGrid<>"): cells around Point are checked
+			template<typename RangeType>
+			auto _(const FVector& Point, const RangeType& Range, int)->decltype(Range.FindClosestWithDistance(Point))
+			{
+				return Range.FindClosestWithDistance(Point);
+			}
 
-		// "auto" in lambda <=> "TPair<Distance, ActorType>"
-		// "return-type" <=> "const TPair<Distance, ActorType>*"
-		return UnrealRanges::Algorithm::MinElementBy(
-			Range | ActorsWithDistanceRange(Point),
-			[](auto ActorWithDistance)
+			template<typename RangeType>
+			auto _(const FVector& Point, const RangeType& Range, ...)
 			{
-				return ActorWithDistance.Key;
-			});
+				//TODO: Add static check "IsActorsRange()" in the beginning
+
+				// "auto" in lambda <=> "TPair<Distance, ActorType>"
+				// "return-type" <=> "const TPair<Distance, ActorType>*"
+				return UnrealRanges::Algorithm::MinElementBy(
+					Range | ActorsWithDistanceRange(Point),
+					[](auto ActorWithDistance)
+					{
+						return ActorWithDistance.Key;
+					});
+			}
+		}
+
+		namespace ClosestActorWithDistanceInRadius
+		{
+			template<typename RangeType>
+			auto _(const FVector& Point, const float RadiusLimit, const RangeType& Range, int)->decltype(
+				Range.FindClosestWithDistance(Point, RadiusLimit))
+			{
+				return Range.FindClosestWithDistance(Point, RadiusLimit);
+			}
+
+			template<typename RangeType>
+			auto _(const FVector& Point, const float RadiusLimit, const RangeType& Range, ...)
+			{
+				//TODO: Add static check "IsActorsRange()" in the beginning
+
+				// "auto" <=> "const TPair<Distance, ActorType>*"
+				// "return-type" <=> "const TPair<Distance, ActorType>*"
+				return UnrealRanges::Algorithm::MinElementBy(
+					Range | ActorsWithDistanceFilterByDistance(Point, RadiusLimit),
+					[](auto ActorWithDistance)
+					{
+						return ActorWithDistance.Key;
+					});
+			}
+		}
+	}
+
+	template<typename RangeType>
+	auto ClosestActorWithDistance(const FVector& Point, RangeType&& Range)
+	{
+		return TemplateDetails::ClosestActorWithDistance::_(Point, Range, 0);
 	}
 
 	// ===============================| ClosestActorWithDistance<...>(Point, RadiusLimit, Range) |=======================================
@@ -48,16 +120,7 @@ namespace UnrealRanges{ namespace Algorithm{
 	template<typename RangeType>
 	auto ClosestActorWithDistance(const FVector& Point, const float RadiusLimit, RangeType&& Range)
 	{
-		//TODO: Add static check "IsActorsRange()" in the beginning
-
-		// "auto" <=> "const TPair<Distance, ActorType>*"
-		// "return-type" <=> "const TPair<Distance, ActorType>*"
-		return UnrealRanges::Algorithm::MinElementBy(
-			Range | ActorsNearblyWithDistanceRange(Point, RadiusLimit),
-			[](auto ActorWithDistance)
-			{
-				return ActorWithDistance.Key;
-			});
+		return TemplateDetails::ClosestActorWithDistanceInRadius::_(Point, RadiusLimit, Range, 0);
 	}
 
 	// ===============================| ClosestActor<...>(Point, Distance, Range) |=======================================
@@ -80,43 +143,186 @@ namespace UnrealRanges{ namespace Algorithm{
 		return ClosestPair.IsSet() ? ClosestPair.GetValue().Value : nullptr;
 	}
 
-	// ===============================| Shuffle<...>(ArrayToShuffle, ElementsNumToShuffle) |=======================================
+	// ===============================| ClosestActorsWithDistance<...>(Point, Num, RadiusLimit, Range) |=======================================
 
-	template <typename ElementType, typename Allocator>
-	void Shuffle(
-		TArray<ElementType, Allocator>& ArrayToShuffle, const TOptional<int32>& ElementsNumToShuffle)
+	namespace TemplateDetails
 	{
-		const int32 Num = ArrayToShuffle.Num();
+		namespace ClosestActorsWithDistance
+		{
+			//Spatial grids (see "TActorsSpatialGrid<>"): cells around Point are checked
+			template<typename RangeType>
+			auto _(const FVector& Point, const int32 Num, const float RadiusLimit, const RangeType& Range, int)->decltype(
+				Range.FindClosestNumWithDistance(Point, Num, RadiusLimit))
+			{
+				return Range.FindClosestNumWithDistance(Point, Num, RadiusLimit);
+			}
 
-		const int32 NumToShuffle = ElementsNumToShuffle.IsSet() ?
-			FMath::Min(Num, ElementsNumToShuffle.GetValue()) : Num;
+			template<typename RangeType>
+			auto _(const FVector& Point, const int32 Num, const float RadiusLimit, const RangeType& Range, ...)
+			{
+				//TODO: Add static check "IsActorsRange()" in the beginning
+
+				using ActorType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
+				using DistanceType = std::decay_t<decltype(FVector::X)>;
+
+				const DistanceType RadiusLimitSquared =
+					UnrealRanges::Private::Utils::ClampedDistanceSquared(static_cast<DistanceType>(RadiusLimit));
+
+				// "auto" <=> "TPair<DistanceSquared, ActorType>"
+				const auto ClosestWithDistancesSquared = UnrealRanges::Algorithm::MinElementsBy(
+					Range |
+					ActorsWithDistanceSquaredRange(Point) |
+					FilteredRange([RadiusLimitSquared](auto ActorWithDistanceSquared)
+					{
+						return ActorWithDistanceSquared.Key < RadiusLimitSquared;
+					}),
+					Num,
+					[](auto ActorWithDistanceSquared)
+					{
+						return ActorWithDistanceSquared.Key;
+					});
+
+				TArray<TPair<DistanceType, ActorType>> Result;
+				Result.Reserve(static_cast<int32>(ClosestWithDistancesSquared.size()));
+				for (const auto& ActorWithDistanceSquared : ClosestWithDistancesSquared)
+				{
+					Result.Emplace(FMath::Sqrt(ActorWithDistanceSquared.Key), ActorWithDistanceSquared.Value);
+				}
+
+				return Result;
+			}
+		}
 
-		const int32 LastIndex = NumToShuffle - 1;
-		for (int32 i = 0; i <= LastIndex; ++i)
+		namespace ClosestActors
 		{
-			int32 IndexToSwap = FMath::RandRange(i, ArrayToShuffle.Num() - 1);
-
-			if (i != IndexToSwap)
+			template<typename AllocatorType, typename ClosestWithDistancesType>
+			auto ToActors(const ClosestWithDistancesType& ClosestWithDistances)
 			{
-				// swap these values
-				APlayerStart* LeftSpawn = ArrayToShuffle[i];
-				APlayerStart* RightSpawn = ArrayToShuffle[IndexToSwap];
+				using ActorType = std::decay_t<decltype(ClosestWithDistances[0].Value)>;
 
-				ArrayToShuffle[i] = RightSpawn;
-				ArrayToShuffle[IndexToSwap] = LeftSpawn;
+				TArray<ActorType, AllocatorType> Result;
+				Result.Reserve(ClosestWithDistances.Num());
+				for (const auto& ActorWithDistance : ClosestWithDistances)
+				{
+					Result.Add(ActorWithDistance.Value);
+				}
+
+				return Result;
 			}
 		}
 	}
 
-	// ===============================| AddAllFromRange<...>(Collection, SourceRange) |=======================================
+	template<typename RangeType>
+	auto ClosestActorsWithDistance(const FVector& Point, const int32 Num, const float RadiusLimit, RangeType&& Range)
+	{
+		return TemplateDetails::ClosestActorsWithDistance::_(Point, Num, RadiusLimit, Range, 0);
+	}
+
+	// ===============================| ClosestActorsWithDistance<...>(Point, Num, Range) |=======================================
 
-	template<typename CollectionToFill, typename SourceRangeType>
-	void AddAllFromRange(CollectionToFill& Collection, const SourceRangeType& SourceRange)
+	template<typename RangeType>
+	auto ClosestActorsWithDistance(const FVector& Point, const int32 Num, RangeType&& Range)
 	{
-		for (const auto& RangeElement : SourceRange)
-		{
-			Collection.Add(RangeElement);
-		}
+		return TemplateDetails::ClosestActorsWithDistance::_(Point, Num, TNumericLimits<float>::Max(), Range, 0);
+	}
+
+	// ===============================| ClosestActors<...>(Point, Num, RadiusLimit, Range) |=======================================
+
+	template<typename RangeType>
+	auto ClosestActors(const FVector& Point, const int32 Num, const float RadiusLimit, RangeType&& Range)
+	{
+		return TemplateDetails::ClosestActors::ToActors<FDefaultAllocator>(
+			ClosestActorsWithDistance(Point, Num, RadiusLimit, Forward<RangeType>(Range)));
+	}
+
+	// ===============================| ClosestActors<...>(Point, Num, Range) |=======================================
+
+	template<typename RangeType>
+	auto ClosestActors(const FVector& Point, const int32 Num, RangeType&& Range)
+	{
+		return TemplateDetails::ClosestActors::ToActors<FDefaultAllocator>(
+			ClosestActorsWithDistance(Point, Num, Forward<RangeType>(Range)));
+	}
+
+	// ===============================| ClosestActors<Num, ...>(Point, RadiusLimit, Range) |=======================================
+
+	template<int32 Num, typename RangeType>
+	auto ClosestActors(const FVector& Point, const float RadiusLimit, RangeType&& Range)
+	{
+		static_assert(Num > 0, "\"Num\" should be positive");
+
+		return TemplateDetails::ClosestActors::ToActors<TInlineAllocator<Num>>(
+			ClosestActorsWithDistance(Point, Num, RadiusLimit, Forward<RangeType>(Range)));
+	}
+
+	// ===============================| ClosestActors<Num, ...>(Point, Range) |=======================================
+
+	template<int32 Num, typename RangeType>
+	auto ClosestActors(const FVector& Point, RangeType&& Range)
+	{
+		static_assert(Num > 0, "\"Num\" should be positive");
+
+		return TemplateDetails::ClosestActors::ToActors<TInlineAllocator<Num>>(
+			ClosestActorsWithDistance(Point, Num, Forward<RangeType>(Range)));
+	}
+
+	// ===============================| ActorsFilterByDistanceToArray<...>(Point, Distance, Range) |=======================================
+
+	template<Utils::Logic::EDistanceQueryPredicate DistanceQueryPredicate, typename RangeType>
+	auto ActorsFilterByDistanceToArray(const FVector& Point, const float Distance, const RangeType& Range)
+	{
+		using ActorType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
+		using DistanceType = std::decay_t<decltype(FVector::X)>;
+
+		TArray<ActorType> Result;
+		ForEachByDistance<DistanceQueryPredicate>(Range, Point, Distance,
+			[](const ActorType& Actor)
+			{
+				return Actor->GetActorLocation();
+			},
+			[&Result](const ActorType& Actor, const DistanceType)
+			{
+				Result.Add(Actor);
+			});
+
+		return Result;
+	}
+
+	// ===============================| ActorsWithDistanceFilterByDistanceToArray<...>(Point, Distance, Range) |=======================================
+
+	template<Utils::Logic::EDistanceQueryPredicate DistanceQueryPredicate, typename RangeType>
+	auto ActorsWithDistanceFilterByDistanceToArray(const FVector& Point, const float Distance, const RangeType& Range)
+	{
+		using ActorType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
+		using DistanceType = std::decay_t<decltype(FVector::X)>;
+
+		TArray<TPair<DistanceType, ActorType>> Result;
+		ForEachByDistance<DistanceQueryPredicate>(Range, Point, Distance,
+			[](const ActorType& Actor)
+			{
+				return Actor->GetActorLocation();
+			},
+			[&Result](const ActorType& Actor, const DistanceType DistanceSquared)
+			{
+				Result.Emplace(FMath::Sqrt(DistanceSquared), Actor);
+			});
+
+		return Result;
+	}
+
+	// ===============================| Shuffle<...>(ArrayToShuffle, ElementsNumToShuffle) |=======================================
+
+	template <typename ElementType, typename Allocator>
+	void Shuffle(
+		TArray<ElementType, Allocator>& ArrayToShuffle, const TOptional<int32>& ElementsNumToShuffle)
+	{
+		const int32 Num = ArrayToShuffle.Num();
+
+		const int32 NumToShuffle = ElementsNumToShuffle.IsSet() ?
+			FMath::Min(Num, ElementsNumToShuffle.GetValue()) : Num;
+
+		UnrealRanges::Utils::FRandomEngine RandomEngine;
+		UnrealRanges::Algorithm::Shuffle(ArrayToShuffle, NumToShuffle, RandomEngine);
 	}
 
 	// ===============================| RangeToArray<...>(Range) |=======================================
@@ -134,9 +340,25 @@ namespace UnrealRanges{ namespace Algorithm{
 	{
 		using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
 
-		TArray<ValueType, ArrayAllocatorType> Result;
-		AddAllFromRange(Result, Range);
-		return Result;
+		return RangeToCollection<TArray<ValueType, ArrayAllocatorType>>(Range);
+	}
+
+	// ===============================| RangeToArray<Policy, ...>(Range) |=======================================
+
+	template<Utils::Execution::EPolicy Policy, typename RangeType>
+	auto RangeToArray(const RangeType& Range)
+	{
+		return RangeToArray<Policy, FDefaultAllocator>(Range);
+	}
+
+	// ===============================| RangeToArray<Policy, ArrayAllocatorType, ...>(Range) |=======================================
+
+	template<Utils::Execution::EPolicy Policy, typename ArrayAllocatorType, typename RangeType>
+	auto RangeToArray(const RangeType& Range)
+	{
+		using ValueType = UnrealRanges::Private::Utils::RangeElementType<RangeType>;
+
+		return RangeToCollection<Policy, TArray<ValueType, ArrayAllocatorType>>(Range);
 	}
 
 	// ====================================================================
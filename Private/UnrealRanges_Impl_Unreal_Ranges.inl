@@ -163,28 +163,15 @@ namespace UnrealRanges{
 	auto ActorsFilterByDistance(const FVector& Point, const float Distance)
 	{
 		//TODO: Add static check "IsActorsRange()" in the beginning
-		//TODO: Optimise using Squared Distance
 
-		static_assert(
-			DistanceQueryPredicate == Utils::Logic::Close || DistanceQueryPredicate == Utils::Logic::Far,
-			"Invalid DistanceQueryPredicate template argument value passed");
-
-		//TODO: Move to seprate function and reuse in "ActorsWithDistanceFilterByDistance<...>(...)"
-		auto IsPassed = [ClampedDistanceToCheck = FMath::Max(Distance, 0.0f)](const float Distance)
-		{
-			switch (DistanceQueryPredicate)
-			{
-				case Utils::Logic::Close:  return Distance < ClampedDistanceToCheck;
-				case Utils::Logic::Far:    return Distance > ClampedDistanceToCheck;
-				default:                   return false;
-			}
-		};
-
-		return ActorsWithDistanceRange(Point) |
-			FilteredAndTransformedRange([IsPassed]
-			(auto ActorWithDistance) //"auto" <=> TPair<Distance, Actor*>
+		return ActorsWithDistanceSquaredRange(Point) |
+			FilteredAndTransformedRange([DistanceToCheckSquared = UnrealRanges::Private::Utils::ClampedDistanceSquared(Distance)]
+			(auto ActorWithDistanceSquared) //"auto" <=> TPair<DistanceSquared, Actor*>
 			{
-				return UnrealRanges::Utils::MakeOptional(IsPassed(ActorWithDistance.Key), ActorWithDistance.Value);
+				return UnrealRanges::Utils::MakeOptional(
+					UnrealRanges::Private::Utils::IsPassedByDistanceSquared<DistanceQueryPredicate>(
+						ActorWithDistanceSquared.Key, static_cast<decltype(ActorWithDistanceSquared.Key)>(DistanceToCheckSquared)),
+					ActorWithDistanceSquared.Value);
 			});
 	}
 
@@ -194,27 +181,18 @@ namespace UnrealRanges{
 	auto ActorsWithDistanceFilterByDistance(const FVector& Point, const float Distance)
 	{
 		//TODO: Add static check "IsActorsRange()" in the beginning
-		//TODO: Optimise using Squared Distance
 
-		static_assert(
-			DistanceQueryPredicate == Utils::Logic::Close || DistanceQueryPredicate == Utils::Logic::Far,
-			"Invalid DistanceQueryPredicate template argument value passed");
-
-		auto IsPassed = [ClampedDistanceToCheck = FMath::Max(Distance, 0.0f)](const float Distance)
-		{
-			switch (DistanceQueryPredicate)
+		//NB: Square root is computed only for passed Actors
+		return ActorsWithDistanceSquaredRange(Point) |
+			FilteredRange([DistanceToCheckSquared = UnrealRanges::Private::Utils::ClampedDistanceSquared(Distance)]
+			(auto ActorWithDistanceSquared) //"auto" <=> TPair<DistanceSquared, Actor*>
 			{
-				case Utils::Logic::Close:  return Distance < ClampedDistanceToCheck;
-				case Utils::Logic::Far:    return Distance > ClampedDistanceToCheck;
-				default:            return false;
-			}
-		};
-
-		return ActorsWithDistanceRange(Point) |
-			FilteredRange([IsPassed]
-			(auto ActorWithDistance) //"auto" <=> TPair<Distance, Actor*>
+				return UnrealRanges::Private::Utils::IsPassedByDistanceSquared<DistanceQueryPredicate>(
+					ActorWithDistanceSquared.Key, static_cast<decltype(ActorWithDistanceSquared.Key)>(DistanceToCheckSquared));
+			}) |
+			TransformedRange([](auto ActorWithDistanceSquared) //"auto" <=> TPair<DistanceSquared, Actor*>
 			{
-				return IsPassed(ActorWithDistance.Key);
+				return MakeTuple(FMath::Sqrt(ActorWithDistanceSquared.Key), ActorWithDistanceSquared.Value);
 			});
 	}
 
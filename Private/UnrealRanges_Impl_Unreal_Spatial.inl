@@ -0,0 +1,301 @@
+#pragma once
+
+//For:
+// - "THashGrid<>" and query shapes
+#include "UnrealRanges_Private_SpatialGrid.h"
+
+//For:
+// - "ClosestActor<...>()" used by "TClosestActorQuery<>"
+#include "../UnrealRanges_Unreal_Algorithm.h"
+
+//Unreal
+#include "Containers/Array.h"
+#include "Templates/Tuple.h"//for "ClosestActorWithDistance<>()" results
+#include "UObject/Object.h"//for "IsValid()"
+#include "UObject/WeakObjectPtrTemplates.h"//for previous result of "TClosestActorQuery<>"
+#include "Math/NumericLimits.h"//for not limited queries
+
+#include <limits>//for not limited closest Actor search
+#include <type_traits>//for "std::decay_t<>", "std::true_type"
+#include <utility>//for "std::pair<>", "std::declval<>()"
+#include <vector>//for closest entries of grid
+
+namespace UnrealRanges{ namespace Utils{
+
+	// ===============================| TActorsSpatialGrid<ActorType> |=======================================
+
+	template<typename ActorType>
+	class TActorsSpatialGrid
+	{
+	public:
+		using DistanceType = std::decay_t<decltype(FVector::X)>;
+
+	private:
+		using PointType = UnrealRanges::Private::Spatial::TPoint<DistanceType>;
+		using GridType = UnrealRanges::Private::Spatial::THashGrid<ActorType*, DistanceType>;
+
+		static PointType ToPoint(const FVector& Vector)
+		{
+			return { Vector.X, Vector.Y, Vector.Z };
+		}
+
+	public:
+		explicit TActorsSpatialGrid(const float CellSize = 1000.f)
+			: Grid(static_cast<DistanceType>(CellSize))
+		{ }
+
+		void Add(ActorType* Actor)
+		{
+			Grid.Add(Actor, ToPoint(Actor->GetActorLocation()));
+		}
+
+		template<typename RangeType>
+		void AddAll(const RangeType& Range)
+		{
+			for (ActorType* Actor : Range)
+			{
+				Add(Actor);
+			}
+		}
+
+		bool Update(ActorType* Actor)
+		{
+			return Grid.Update(Actor, ToPoint(Actor->GetActorLocation()));
+		}
+
+		//NB: Locations of all Actors are read, but grid is changed only for moved ones
+		void UpdateAll()
+		{
+			TArray<ActorType*> MovedActors;
+			Grid.ForEach([&MovedActors](ActorType* Actor, const PointType& Location)
+			{
+				const FVector CurrentLocation = Actor->GetActorLocation();
+				if (CurrentLocation.X != Location.X || CurrentLocation.Y != Location.Y || CurrentLocation.Z != Location.Z)
+				{
+					MovedActors.Add(Actor);
+				}
+			});
+
+			for (ActorType* Actor : MovedActors)
+			{
+				Update(Actor);
+			}
+		}
+
+		bool Remove(ActorType* Actor)
+		{
+			return Grid.Remove(Actor);
+		}
+
+		void RemoveInvalid()
+		{
+			TArray<ActorType*> InvalidActors;
+			Grid.ForEach([&InvalidActors](ActorType* Actor, const PointType&)
+			{
+				if (!IsValid(Actor))
+				{
+					InvalidActors.Add(Actor);
+				}
+			});
+
+			for (ActorType* Actor : InvalidActors)
+			{
+				Remove(Actor);
+			}
+		}
+
+		void Reset()
+		{
+			Grid.Reset();
+		}
+
+		int32 Num() const
+		{
+			return Grid.Num();
+		}
+
+		// - - - - - Queries
+
+		auto SphereRange(const FVector& Center, const float Radius) const
+		{
+			return Grid.Query(UnrealRanges::Private::Spatial::TSphere<DistanceType>{
+				ToPoint(Center), static_cast<DistanceType>(Radius) });
+		}
+
+		auto BoxRange(const FBox& Box) const
+		{
+			return Grid.Query(UnrealRanges::Private::Spatial::TBox<DistanceType>{
+				ToPoint(Box.Min), ToPoint(Box.Max) });
+		}
+
+		auto ConeRange(const FVector& Apex, const FVector& Direction, const float HalfAngleRadians, const float Length) const
+		{
+			return Grid.Query(UnrealRanges::Private::Spatial::TCone<DistanceType>{
+				ToPoint(Apex), ToPoint(Direction), static_cast<DistanceType>(HalfAngleRadians), static_cast<DistanceType>(Length) });
+		}
+
+		//NB: Used by "ClosestActorWithDistance<...>()" for grids passed as Range
+		TUnrealRanges_Optional<TTuple<DistanceType, ActorType*>> FindClosestWithDistance(
+			const FVector& Point, const DistanceType RadiusLimit = std::numeric_limits<DistanceType>::max()) const
+		{
+			DistanceType DistanceSquared;
+			const auto* Closest = Grid.FindClosest(ToPoint(Point), RadiusLimit, DistanceSquared);
+
+			return Closest ?
+				UnrealRanges::Utils::MakeOptional(MakeTuple(FMath::Sqrt(DistanceSquared), Closest->Element)) :
+				UnrealRanges::Utils::MakeOptional<TTuple<DistanceType, ActorType*>>();
+		}
+
+		//NB: Used by "ClosestActorsWithDistance<...>()" for grids passed as Range
+		TArray<TTuple<DistanceType, ActorType*>> FindClosestNumWithDistance(
+			const FVector& Point, const int32 Num, const DistanceType RadiusLimit = std::numeric_limits<DistanceType>::max()) const
+		{
+			std::vector<std::pair<DistanceType, const typename GridType::FEntry*>> Closest;
+			Grid.FindClosestNum(ToPoint(Point), Num, RadiusLimit, Closest);
+
+			TArray<TTuple<DistanceType, ActorType*>> Result;
+			Result.Reserve(static_cast<int32>(Closest.size()));
+			for (const auto& EntryWithDistanceSquared : Closest)
+			{
+				Result.Emplace(FMath::Sqrt(EntryWithDistanceSquared.first), EntryWithDistanceSquared.second->Element);
+			}
+
+			return Result;
+		}
+
+	private:
+		GridType Grid;
+	};
+
+	// ===============================| TClosestActorQuery<ActorType> |=======================================
+
+	namespace TemplateDetails
+	{
+		namespace ClosestActorQuery
+		{
+			//Ranges that check less Actors for smaller radius (like "TActorsSpatialGrid<>")
+			template<typename RangeType>
+			auto IsRadiusPruning(const RangeType& Range, int)->decltype(
+				Range.FindClosestWithDistance(std::declval<const FVector&>(), 0.f), std::true_type{ });
+
+			template<typename RangeType>
+			std::false_type IsRadiusPruning(const RangeType& Range, ...);
+		}
+	}
+
+	template<typename ActorType>
+	class TClosestActorQuery
+	{
+	public:
+		template<typename RangeType>
+		ActorType* Find(const FVector& Point, RangeType&& Range)
+		{
+			return Find(Point, TNumericLimits<float>::Max(), Forward<RangeType>(Range));
+		}
+
+		template<typename RangeType>
+		ActorType* Find(const FVector& Point, const float RadiusLimit, RangeType&& Range)
+		{
+			++Stats.QueriesNum;
+
+			//NB: Previous Actor is re-validated directly - it gives the bound only if it is
+			// still valid and inside "RadiusLimit". Bound is enlarged a bit - previous Actor
+			// itself should pass the bounded query. Presence of previous Actor in the Range
+			// is not required: any Actor found inside the bound is the closest one
+			float Bound = RadiusLimit;
+			bool bBounded = false;
+
+			ActorType* PreviousActor = Previous.Get();
+			if (IsValid(PreviousActor))
+			{
+				const float PreviousDistance = static_cast<float>(FVector::Distance(Point, PreviousActor->GetActorLocation()));
+				const float EnlargedDistance = PreviousDistance + FMath::Max(PreviousDistance * 1.e-4f, KINDA_SMALL_NUMBER);
+
+				if (EnlargedDistance < RadiusLimit)
+				{
+					Bound = EnlargedDistance;
+					bBounded = true;
+				}
+			}
+
+			return Find(Point, RadiusLimit, Bound, bBounded, Range,
+				decltype(TemplateDetails::ClosestActorQuery::IsRadiusPruning(Range, 0)){ });
+		}
+
+		ActorType* GetPrevious() const
+		{
+			return Previous.Get();
+		}
+
+		void Reset()
+		{
+			Previous.Reset();
+		}
+
+		const FClosestActorQueryStats& GetStats() const
+		{
+			return Stats;
+		}
+
+		void ResetStats()
+		{
+			Stats = FClosestActorQueryStats{ };
+		}
+
+	private:
+		//Ranges with radius pruning: query in the bound checks less Actors, so it is performed
+		// first. Query in "RadiusLimit" is performed only if nothing is found in the bound
+		template<typename RangeType>
+		ActorType* Find(const FVector& Point, const float RadiusLimit, const float Bound, const bool bBounded,
+			RangeType& Range, std::true_type)
+		{
+			if (bBounded)
+			{
+				if (ActorType* Found = UnrealRanges::Algorithm::ClosestActor(Point, Bound, Range))
+				{
+					++Stats.BoundedQueriesNum;
+					return SetResult(Found);
+				}
+			}
+
+			++Stats.FullQueriesNum;
+			return SetResult(UnrealRanges::Algorithm::ClosestActor(Point, RadiusLimit, Range));
+		}
+
+		//Other Ranges: all Actors are checked by any query, so single query in "RadiusLimit"
+		// is performed and the bound is only used for statistics
+		template<typename RangeType>
+		ActorType* Find(const FVector& Point, const float RadiusLimit, const float Bound, const bool bBounded,
+			RangeType& Range, std::false_type)
+		{
+			const auto Closest = UnrealRanges::Algorithm::ClosestActorWithDistance(Point, RadiusLimit, Range);
+			ActorType* Found = Closest.IsSet() ? Closest.GetValue().Value : nullptr;
+
+			if (Found && bBounded && Closest.GetValue().Key <= Bound)
+			{
+				++Stats.BoundedQueriesNum;
+			}
+			else
+			{
+				++Stats.FullQueriesNum;
+			}
+
+			return SetResult(Found);
+		}
+
+		ActorType* SetResult(ActorType* Found)
+		{
+			if (Found && Found == Previous.Get())
+			{
+				++Stats.SameResultsNum;
+			}
+
+			Previous = Found;
+			return Found;
+		}
+
+		TWeakObjectPtr<ActorType> Previous;
+		FClosestActorQueryStats Stats;
+	};
+
+}} //namespace UnrealRanges::Utils
@@ -37,13 +37,13 @@ namespace UnrealRanges{ namespace Utils{
 	// See "UnrealRanges_Utils_Details.h" for "TemplateDetails::RangeBegin"
 
 	template<typename RangeType>
-	auto RangeBegin(const RangeType& Range)->decltype(TemplateDetails::RangeBegin::_(Range, 0))
+	auto RangeBegin(RangeType&& Range)->decltype(TemplateDetails::RangeBegin::_(Range, 0))
 	{
 		return TemplateDetails::RangeBegin::_(Range, 0);
 	}
 
 	template<typename RangeType>
-	auto RangeEnd(const RangeType& Range)->decltype(TemplateDetails::RangeEnd::_(Range, 0))
+	auto RangeEnd(RangeType&& Range)->decltype(TemplateDetails::RangeEnd::_(Range, 0))
 	{
 		return TemplateDetails::RangeEnd::_(Range, 0);
 	}
@@ -77,6 +77,135 @@ namespace UnrealRanges{ namespace Utils{
 		return TemplateDetails::IsRange::_<PossibleRangeType>(0);
 	}
 
+	// ===================== Universal Size ========================
+
+	// See "UnrealRanges_Utils_Details.h" for "TemplateDetails::RangeSize"
+
+	template<typename RangeType>
+	auto RangeSize(const RangeType& Range)->decltype(TemplateDetails::RangeSize::_(Range, 0))
+	{
+		return TemplateDetails::RangeSize::_(Range, 0);
+	}
+
+	template<typename RangeType>
+	auto RangeMaxSize(const RangeType& Range)->decltype(TemplateDetails::RangeMaxSize::_(Range, 0))
+	{
+		return TemplateDetails::RangeMaxSize::_(Range, 0);
+	}
+
+	namespace TemplateDetails{
+		namespace IsSizedRange{
+
+			template<typename RangeType>
+			constexpr auto _(int)->decltype(
+				UnrealRanges::Utils::RangeSize(std::declval<const RangeType&>()),
+				true)
+			{
+				return true;
+			}
+
+			template<typename RangeType>
+			constexpr bool _(...)
+			{
+				return false;
+			}
+
+		}
+
+		namespace IsMaxSizedRange{
+
+			template<typename RangeType>
+			constexpr auto _(int)->decltype(
+				UnrealRanges::Utils::RangeMaxSize(std::declval<const RangeType&>()),
+				true)
+			{
+				return true;
+			}
+
+			template<typename RangeType>
+			constexpr bool _(...)
+			{
+				return false;
+			}
+
+		}
+	}
+
+	template<typename RangeType>
+	constexpr bool IsSizedRange()
+	{
+		return TemplateDetails::IsSizedRange::_<std::remove_reference_t<RangeType>>(0);
+	}
+
+	template<typename RangeType>
+	constexpr bool IsMaxSizedRange()
+	{
+		return TemplateDetails::IsMaxSizedRange::_<std::remove_reference_t<RangeType>>(0);
+	}
+
+	// ==================== Universal Split ========================
+
+	template<typename RangeType>
+	auto RangeSplit(const RangeType& Range, int PartsNum)->decltype(TemplateDetails::RangeSplit::_(Range, PartsNum, 0, 0))
+	{
+		return TemplateDetails::RangeSplit::_(Range, PartsNum, 0, 0);
+	}
+
+	namespace TemplateDetails{
+		namespace IsSplittableRange{
+
+			template<typename RangeType>
+			constexpr auto _(int)->decltype(
+				UnrealRanges::Utils::RangeSplit(std::declval<const RangeType&>(), 0),
+				true)
+			{
+				return true;
+			}
+
+			template<typename RangeType>
+			constexpr bool _(...)
+			{
+				return false;
+			}
+
+		}
+	}
+
+	template<typename RangeType>
+	constexpr bool IsSplittableRange()
+	{
+		return TemplateDetails::IsSplittableRange::_<std::remove_reference_t<RangeType>>(0);
+	}
+
+	template<typename RangeType>
+	constexpr bool IsOrderedSplitRange()
+	{
+		return TemplateDetails::IsOrderedSplitRange::_<std::remove_reference_t<RangeType>>(0);
+	}
+
+	// ==================== Universal Visit ========================
+
+	template<typename RangeType, typename FuncType>
+	decltype(auto) RangeVisit(RangeType&& Range, FuncType&& Func)
+	{
+		return TemplateDetails::RangeVisit::_(Range, Func, 0);
+	}
+
+	// ================ Universal internal iteration ===============
+
+	template<typename RangeType, typename FuncType>
+	bool RangeForEachWhile(const RangeType& Range, FuncType&& Func)
+	{
+		//NB: Ranges push elements into const Sink, so "Func" (that may be mutable) is
+		// called through the reference
+		const auto Sink = [&Func](auto&& Element)->decltype(Func(std::forward<decltype(Element)>(Element)))
+		{
+			return Func(std::forward<decltype(Element)>(Element));
+		};
+
+		return TemplateDetails::RangeForEachWhile::_(Range, Sink, 0);
+	}
+
 	// ================= Universal dereference =====================
 
 	//TODO: Implement "Dereference_Universal" and use here
@@ -99,6 +228,15 @@ namespace UnrealRanges{ namespace Utils{
 		return static_cast<EnumType>(EnumNumericValue - 1);
 	}
 
+	template<typename EnumType>
+	int EnumValuesNum(const EnumType StartEnum, const EnumType EndEnum)
+	{
+		using EnumNumericValueType = std::underlying_type_t<EnumType>;
+		const EnumNumericValueType StartNumericValue = static_cast<EnumNumericValueType>(StartEnum);
+		const EnumNumericValueType EndNumericValue = static_cast<EnumNumericValueType>(EndEnum);
+		return static_cast<int>(EndNumericValue) - static_cast<int>(StartNumericValue);
+	}
+
 	// ==================== GetMemberValue =========================
 
 	namespace TemplateDetails{
@@ -187,6 +325,63 @@ namespace UnrealRanges{ namespace Utils{
 		return Value;
 	}
 
+	// ================================== FRandomEngine ===================================
+
+	class FRandomEngine
+	{
+	public:
+		FRandomEngine()
+			: FRandomEngine(MakeSeed())
+		{ }
+
+		//NB: State is filled by "splitmix64" from the seed, so it's never all zeros
+		explicit FRandomEngine(std::uint64_t Seed)
+		{
+			for (std::uint64_t& Word : State)
+			{
+				Seed += 0x9E3779B97F4A7C15ull;
+				std::uint64_t Mixed = Seed;
+				Mixed = (Mixed ^ (Mixed >> 30)) * 0xBF58476D1CE4E5B9ull;
+				Mixed = (Mixed ^ (Mixed >> 27)) * 0x94D049BB133111EBull;
+				Word = Mixed ^ (Mixed >> 31);
+			}
+		}
+
+		std::uint64_t operator()()
+		{
+			const std::uint64_t Result = RotateLeft(State[1] * 5, 7) * 9;
+			const std::uint64_t Shifted = State[1] << 17;
+
+			State[2] ^= State[0];
+			State[3] ^= State[1];
+			State[1] ^= State[2];
+			State[0] ^= State[3];
+			State[2] ^= Shifted;
+			State[3] = RotateLeft(State[3], 45);
+
+			return Result;
+		}
+
+	private:
+		static std::uint64_t RotateLeft(const std::uint64_t Value, const int Bits)
+		{
+			return (Value << Bits) | (Value >> (64 - Bits));
+		}
+
+		//NB: Seed is combined from 16 bit parts - "Rand()" range should not overflow "int"
+		static std::uint64_t MakeSeed()
+		{
+			std::uint64_t Seed = 0;
+			for (int Part = 0; Part < 4; ++Part)
+			{
+				Seed = (Seed << 16) | static_cast<std::uint64_t>(UnrealRanges::Utils::Rand(0, 0xFFFF));
+			}
+			return Seed;
+		}
+
+		std::uint64_t State[4];
+	};
+
 	// ===================== SafeGet<...>(Target, FieldPointer) ===========================
 
 	template <typename TargetType, typename FieldType>
@@ -43,6 +43,45 @@ namespace UnrealRanges{ namespace Utils{
 		return UnrealRanges_Injection::GetOptionalValue(InOptional);
 	}
 
+	// ========================== HashSet ============================
+
+	template<typename KeyType>
+	void HashSetReserve(TUnrealRanges_HashSet<KeyType>& InSet, int InNum)
+	{
+		UnrealRanges_Injection::HashSetReserve(InSet, InNum);
+	}
+
+	template<typename KeyType>
+	void HashSetAdd(TUnrealRanges_HashSet<KeyType>& InSet, const KeyType& InKey)
+	{
+		UnrealRanges_Injection::HashSetAdd(InSet, InKey);
+	}
+
+	template<typename KeyType>
+	bool HashSetContains(const TUnrealRanges_HashSet<KeyType>& InSet, const KeyType& InKey)
+	{
+		return UnrealRanges_Injection::HashSetContains(InSet, InKey);
+	}
+
+	template<typename KeyType>
+	constexpr bool IsHashSetKey()
+	{
+		return UnrealRanges_Injection::IsHashSetKey<KeyType>(0);
+	}
+
+	// ========================== Parallel ============================
+
+	template<typename FunctionType>
+	void ParallelFor(int InNum, const FunctionType& InBody)
+	{
+		UnrealRanges_Injection::ParallelFor(InNum, InBody);
+	}
+
+	inline int ParallelWorkersNum()
+	{
+		return UnrealRanges_Injection::ParallelWorkersNum();
+	}
+
 	// ========================== Random ============================
 
 	inline int Rand(int Start, int End)
@@ -50,6 +89,11 @@ namespace UnrealRanges{ namespace Utils{
 		return UnrealRanges_Injection::Rand(Start, End);
 	}
 
+	inline float RandFraction()
+	{
+		return UnrealRanges_Injection::RandFraction();
+	}
+
 	// ========================== Check ============================
 
 #	if UNREAL_RANGES__DEBUG //{
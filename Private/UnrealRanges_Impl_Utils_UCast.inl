@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>//for "std::static_pointer_cast<>()", "std::dynamic_pointer_cast<>()"
+
 namespace UnrealRanges{ namespace Utils{
 
 	//------------------------------Common------------------------------
@@ -0,0 +1,108 @@
+#pragma once
+
+//For:
+// - "ParallelFor()", "ParallelWorkersNum()"
+// - "RangeSize()", "RangeMaxSize()"
+// - "RangeSplit()", "IsSplittableRange<>()"
+#include "../UnrealRanges_Utils.h"
+
+#include <algorithm>//for "std::min()"
+#include <type_traits>//for "std::integral_constant<>"
+
+// Minimal number of elements processed by one parallel task. Ranges with
+// less elements per worker are processed by less workers (sequentially if
+// there are not enough elements even for two tasks)
+#ifndef UNREAL_RANGES__PARALLEL_MIN_CHUNK_NUM
+#	define UNREAL_RANGES__PARALLEL_MIN_CHUNK_NUM 4096
+#endif
+
+// Number of parts per worker Range is split to. Parts of non-random access
+// ranges (like filtered ranges) may take different time to process, so
+// workers that finished their parts earlier take remaining parts
+#ifndef UNREAL_RANGES__PARALLEL_PARTS_PER_WORKER
+#	define UNREAL_RANGES__PARALLEL_PARTS_PER_WORKER 4
+#endif
+
+namespace UnrealRanges{ namespace Private{ namespace Parallel{
+
+	// ---------------------- Chunks ------------------------
+
+	//NB: Range may be split to chunks without iterating of elements
+	// (see "RangeSplit<>()")
+	template<typename RangeType>
+	constexpr bool IsChunkable()
+	{
+		return UnrealRanges::Utils::IsSplittableRange<RangeType>();
+	}
+
+	template<typename RangeType>
+	using IsChunkableTag = std::integral_constant<bool, IsChunkable<RangeType>()>;
+
+	//NB: Chunks of hash containers are groups of buckets, so they don't follow each
+	// other in Range order (see "IsOrderedSplitRange<>()")
+	template<typename RangeType>
+	constexpr bool IsOrderedChunkable()
+	{
+		return UnrealRanges::Utils::IsOrderedSplitRange<RangeType>();
+	}
+
+	namespace TemplateDetails
+	{
+		namespace ElementsNumEstimation
+		{
+			template<typename RangeType>
+			auto _(const RangeType& Range, int)->decltype(UnrealRanges::Utils::RangeMaxSize(Range))
+			{
+				return UnrealRanges::Utils::RangeMaxSize(Range);
+			}
+
+			//NB: Ranges of unknown size are processed sequentially
+			template<typename RangeType>
+			int _(const RangeType&, ...)
+			{
+				return 0;
+			}
+
+			//NB: Ranges of unknown size that produce elements from elements of Parent Range
+			// (like ranges that step into elements) are estimated by Parent Range
+			template<typename RangeType>
+			auto _(const RangeType& Range, long)->decltype(Range.GetParentRange(), int())
+			{
+				return _(Range.GetParentRange(), 0);
+			}
+		}
+	}
+
+	// Size heuristic: every chunk should have enough elements to pay for
+	// the task scheduling. Returns "1" if Range should be processed
+	// sequentially
+	template<typename RangeType>
+	int ChunksNum(const RangeType& Range)
+	{
+		const int WorkersNum = UnrealRanges::Utils::ParallelWorkersNum();
+		if (WorkersNum <= 1)
+		{
+			return 1;
+		}
+
+		const int ElementsNum = TemplateDetails::ElementsNumEstimation::_(Range, 0);
+		const int MaxChunksNum = ElementsNum / UNREAL_RANGES__PARALLEL_MIN_CHUNK_NUM;
+		return std::max(1, std::min(WorkersNum * UNREAL_RANGES__PARALLEL_PARTS_PER_WORKER, MaxChunksNum));
+	}
+
+	// Splits Range to not more than "ChunksNum" parts and calls "Body(ChunkIndex, {ChunkRange})"
+	// for each of them in parallel. Chunks follow each other in Range order by "ChunkIndex" only
+	// if Range is ordered chunkable (see "IsOrderedChunkable<>()")
+	template<typename RangeType, typename BodyType>
+	void ForEachChunk(const RangeType& Range, const int ChunksNum, const BodyType& Body)
+	{
+		auto Chunks = UnrealRanges::Utils::RangeSplit(Range, ChunksNum);
+
+		UnrealRanges::Utils::ParallelFor(static_cast<int>(Chunks.size()),
+			[&Chunks, &Body](const int ChunkIndex)
+			{
+				Body(ChunkIndex, Chunks[ChunkIndex]);
+			});
+	}
+
+}}} //namespace UnrealRanges::Private::Parallel
@@ -0,0 +1,1029 @@
+#pragma once
+
+//For:
+// - "RangeSize()"
+#include "../UnrealRanges_Utils.h"
+
+#include <cstdint>//for "std::uint8_t", ...
+#include <algorithm>//for "std::min()"
+#include <cstring>//for "std::memcpy()"
+#include <limits>//for "std::numeric_limits<>"
+#include <type_traits>//for "std::enable_if_t<>", ...
+#include <vector>//for contiguous iterators detection
+
+// Enables SIMD kernels for searching in contiguous collections of arithmetic
+// values, enums and pointers. Enabled by default on x86-64: SSE2 is always
+// available there, AVX2 is used if CPU supports it (checked once at runtime).
+// May be defined as "0" before including Unreal Ranges to use scalar code only
+#ifndef UNREAL_RANGES__SIMD
+#	if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#		define UNREAL_RANGES__SIMD 1
+#	else
+#		define UNREAL_RANGES__SIMD 0
+#	endif
+#endif
+
+#if UNREAL_RANGES__SIMD
+#	include <emmintrin.h>
+#	include <immintrin.h>
+#	if defined(_MSC_VER)
+#		include <intrin.h>
+#	endif
+#	if defined(_MSC_VER) && !defined(__clang__)
+#		define UNREAL_RANGES__SIMD_AVX2
+#	else
+#		define UNREAL_RANGES__SIMD_AVX2 __attribute__((target("avx2")))
+#	endif
+#endif
+
+namespace UnrealRanges{ namespace Private{ namespace Simd{
+
+	// ---------------------- Elements ------------------------
+
+	//NB: Elements are compared as unsigned integers of same size (bitwise equality
+	// is same as "==" for integers, enums and pointers) or as floating point values
+	template<typename ElementType>
+	constexpr bool IsVectorizable()
+	{
+		return UNREAL_RANGES__SIMD &&
+			(std::is_arithmetic<ElementType>::value || std::is_enum<ElementType>::value || std::is_pointer<ElementType>::value) &&
+			(sizeof(ElementType) == 1 || sizeof(ElementType) == 2 || sizeof(ElementType) == 4 || sizeof(ElementType) == 8);
+	}
+
+	// -------------------- Contiguity ------------------------
+
+	namespace TemplateDetails
+	{
+		//NB: Iterators of C++14 don't report contiguity, so only pointers and iterators
+		// of "std::vector" are detected ("std::vector<bool>" is not contiguous)
+		template<typename IteratorType, typename ElementType,
+			bool bVectorizable = IsVectorizable<ElementType>() && !std::is_same<ElementType, bool>::value>
+		struct TIsVectorizableIterator : std::false_type { };
+
+		template<typename IteratorType, typename ElementType>
+		struct TIsVectorizableIterator<IteratorType, ElementType, true> : std::integral_constant<bool,
+			std::is_pointer<IteratorType>::value ||
+			std::is_same<IteratorType, typename std::vector<ElementType>::iterator>::value ||
+			std::is_same<IteratorType, typename std::vector<ElementType>::const_iterator>::value> { };
+	}
+
+	// "true" if elements of "IteratorType" are vectorizable and stored contiguously
+	template<typename IteratorType>
+	constexpr bool IsVectorizableIterator()
+	{
+		return TemplateDetails::TIsVectorizableIterator<IteratorType,
+			std::remove_cv_t<std::remove_reference_t<decltype(*std::declval<IteratorType>())>>>::value;
+	}
+
+	namespace TemplateDetails
+	{
+		namespace RangeData
+		{
+			//Std collections
+			template<typename RangeType>
+			auto _(const RangeType& Range, int, int)->std::enable_if_t<
+				std::is_pointer<decltype(Range.data())>::value, decltype(Range.data())>
+			{
+				return Range.data();
+			}
+
+			template<typename ElementType, decltype(sizeof(int)) ElementsNum>
+			const ElementType* _(const ElementType(&Range)[ElementsNum], int, int)
+			{
+				return Range;
+			}
+
+			//Unreal collections
+			template<typename RangeType>
+			auto _(const RangeType& Range, int, ...)->std::enable_if_t<
+				std::is_pointer<decltype(Range.GetData())>::value, decltype(Range.GetData())>
+			{
+				return Range.GetData();
+			}
+
+			//Collections with pointer iterators (like "std::initializer_list")
+			template<typename RangeType>
+			auto _(const RangeType& Range, ...)->std::enable_if_t<
+				std::is_pointer<decltype(Range.begin())>::value, decltype(Range.begin())>
+			{
+				return Range.begin();
+			}
+		}
+	}
+
+	// Pointer to elements of contiguous collection
+	template<typename RangeType>
+	auto RangeData(const RangeType& Range)->decltype(TemplateDetails::RangeData::_(Range, 0, 0))
+	{
+		return TemplateDetails::RangeData::_(Range, 0, 0);
+	}
+
+	template<typename RangeType>
+	using RangeDataElementType = std::remove_cv_t<std::remove_pointer_t<
+		decltype(RangeData(std::declval<const RangeType&>()))>>;
+
+	// ----------------------- Kernels ------------------------
+
+	namespace TemplateDetails
+	{
+		template<int Size> struct TUnsignedOfSize;
+		template<> struct TUnsignedOfSize<1> { using Type = std::uint8_t; };
+		template<> struct TUnsignedOfSize<2> { using Type = std::uint16_t; };
+		template<> struct TUnsignedOfSize<4> { using Type = std::uint32_t; };
+		template<> struct TUnsignedOfSize<8> { using Type = std::uint64_t; };
+
+		template<typename ElementType>
+		using LaneType = std::conditional_t<std::is_floating_point<ElementType>::value,
+			ElementType, typename TUnsignedOfSize<static_cast<int>(sizeof(ElementType))>::Type>;
+
+		template<typename ElementType>
+		LaneType<ElementType> ToLane(const ElementType& Element)
+		{
+			LaneType<ElementType> Lane;
+			std::memcpy(&Lane, &Element, sizeof(Lane));
+			return Lane;
+		}
+
+		template<bool bEqual, typename ElementType>
+		int FindScalar(const ElementType* Data, const int Num, const ElementType& Value)
+		{
+			int Index = 0;
+			for (; Index < Num && (Data[Index] == Value) != bEqual; ++Index);
+			return Index;
+		}
+
+#if UNREAL_RANGES__SIMD
+
+		inline int CountTrailingZeros(const unsigned int Mask)
+		{
+#	if defined(_MSC_VER) && !defined(__clang__)
+			unsigned long Index;
+			_BitScanForward(&Index, Mask);
+			return static_cast<int>(Index);
+#	else
+			return __builtin_ctz(Mask);
+#	endif
+		}
+
+		inline bool IsAvx2Supported()
+		{
+#	if defined(_MSC_VER)
+			int CpuInfo[4];
+			__cpuid(CpuInfo, 1);
+			const bool bOsSavesYmm = (CpuInfo[2] & (1 << 27)) && ((_xgetbv(0) & 0x6) == 0x6);
+
+			__cpuidex(CpuInfo, 7, 0);
+			return bOsSavesYmm && (CpuInfo[1] & (1 << 5));
+#	else
+			return __builtin_cpu_supports("avx2");
+#	endif
+		}
+
+		inline bool HasAvx2()
+		{
+			static const bool bHasAvx2 = IsAvx2Supported();
+			return bHasAvx2;
+		}
+
+		// - - - - - SSE2 (16 bytes per comparison)
+
+		inline __m128i Splat128(const std::uint8_t Value) { return _mm_set1_epi8(static_cast<char>(Value)); }
+		inline __m128i Splat128(const std::uint16_t Value) { return _mm_set1_epi16(static_cast<short>(Value)); }
+		inline __m128i Splat128(const std::uint32_t Value) { return _mm_set1_epi32(static_cast<int>(Value)); }
+		inline __m128i Splat128(const std::uint64_t Value) { return _mm_set1_epi64x(static_cast<long long>(Value)); }
+		inline __m128i Splat128(const float Value) { return _mm_castps_si128(_mm_set1_ps(Value)); }
+		inline __m128i Splat128(const double Value) { return _mm_castpd_si128(_mm_set1_pd(Value)); }
+
+		//NB: Masks have one bit per byte, "LaneType" pointer is used only for overload selection
+		inline unsigned int EqualMask128(const std::uint8_t*, const __m128i A, const __m128i B) { return _mm_movemask_epi8(_mm_cmpeq_epi8(A, B)); }
+		inline unsigned int EqualMask128(const std::uint16_t*, const __m128i A, const __m128i B) { return _mm_movemask_epi8(_mm_cmpeq_epi16(A, B)); }
+		inline unsigned int EqualMask128(const std::uint32_t*, const __m128i A, const __m128i B) { return _mm_movemask_epi8(_mm_cmpeq_epi32(A, B)); }
+		inline unsigned int EqualMask128(const float*, const __m128i A, const __m128i B) { return _mm_movemask_epi8(_mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(A), _mm_castsi128_ps(B)))); }
+		inline unsigned int EqualMask128(const double*, const __m128i A, const __m128i B) { return _mm_movemask_epi8(_mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(A), _mm_castsi128_pd(B)))); }
+
+		//NB: SSE2 has no 64 bit comparison: both 32 bit halves should be equal
+		inline unsigned int EqualMask128(const std::uint64_t*, const __m128i A, const __m128i B)
+		{
+			const __m128i Halves = _mm_cmpeq_epi32(A, B);
+			return _mm_movemask_epi8(_mm_and_si128(Halves, _mm_shuffle_epi32(Halves, _MM_SHUFFLE(2, 3, 0, 1))));
+		}
+
+		template<bool bEqual, typename ElementType>
+		int Find128(const ElementType* Data, const int Num, const ElementType& Value)
+		{
+			constexpr int LanesNum = 16 / sizeof(ElementType);
+			const __m128i Values = Splat128(ToLane(Value));
+
+			int Index = 0;
+			for (; Index + LanesNum <= Num; Index += LanesNum)
+			{
+				const __m128i Lanes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Data + Index));
+				const unsigned int Mask = EqualMask128(static_cast<const LaneType<ElementType>*>(nullptr), Lanes, Values) ^ (bEqual ? 0u : 0xFFFFu);
+
+				if (Mask != 0)
+				{
+					return Index + CountTrailingZeros(Mask) / static_cast<int>(sizeof(ElementType));
+				}
+			}
+
+			return Index + FindScalar<bEqual>(Data + Index, Num - Index, Value);
+		}
+
+		// - - - - - AVX2 (32 bytes per comparison)
+
+		UNREAL_RANGES__SIMD_AVX2 inline __m256i Splat256(const std::uint8_t Value) { return _mm256_set1_epi8(static_cast<char>(Value)); }
+		UNREAL_RANGES__SIMD_AVX2 inline __m256i Splat256(const std::uint16_t Value) { return _mm256_set1_epi16(static_cast<short>(Value)); }
+		UNREAL_RANGES__SIMD_AVX2 inline __m256i Splat256(const std::uint32_t Value) { return _mm256_set1_epi32(static_cast<int>(Value)); }
+		UNREAL_RANGES__SIMD_AVX2 inline __m256i Splat256(const std::uint64_t Value) { return _mm256_set1_epi64x(static_cast<long long>(Value)); }
+		UNREAL_RANGES__SIMD_AVX2 inline __m256i Splat256(const float Value) { return _mm256_castps_si256(_mm256_set1_ps(Value)); }
+		UNREAL_RANGES__SIMD_AVX2 inline __m256i Splat256(const double Value) { return _mm256_castpd_si256(_mm256_set1_pd(Value)); }
+
+		UNREAL_RANGES__SIMD_AVX2 inline unsigned int EqualMask256(const std::uint8_t*, const __m256i A, const __m256i B) { return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(A, B))); }
+		UNREAL_RANGES__SIMD_AVX2 inline unsigned int EqualMask256(const std::uint16_t*, const __m256i A, const __m256i B) { return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(A, B))); }
+		UNREAL_RANGES__SIMD_AVX2 inline unsigned int EqualMask256(const std::uint32_t*, const __m256i A, const __m256i B) { return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi32(A, B))); }
+		UNREAL_RANGES__SIMD_AVX2 inline unsigned int EqualMask256(const std::uint64_t*, const __m256i A, const __m256i B) { return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi64(A, B))); }
+		UNREAL_RANGES__SIMD_AVX2 inline unsigned int EqualMask256(const float*, const __m256i A, const __m256i B) { return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(A), _mm256_castsi256_ps(B), _CMP_EQ_OQ)))); }
+		UNREAL_RANGES__SIMD_AVX2 inline unsigned int EqualMask256(const double*, const __m256i A, const __m256i B) { return static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(A), _mm256_castsi256_pd(B), _CMP_EQ_OQ)))); }
+
+		template<bool bEqual, typename ElementType>
+		UNREAL_RANGES__SIMD_AVX2 int Find256(const ElementType* Data, const int Num, const ElementType& Value)
+		{
+			constexpr int LanesNum = 32 / sizeof(ElementType);
+			const __m256i Values = Splat256(ToLane(Value));
+
+			int Index = 0;
+			for (; Index + LanesNum <= Num; Index += LanesNum)
+			{
+				const __m256i Lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Data + Index));
+				const unsigned int Mask = EqualMask256(static_cast<const LaneType<ElementType>*>(nullptr), Lanes, Values) ^ (bEqual ? 0u : 0xFFFFFFFFu);
+
+				if (Mask != 0)
+				{
+					return Index + CountTrailingZeros(Mask) / static_cast<int>(sizeof(ElementType));
+				}
+			}
+
+			return Index + FindScalar<bEqual>(Data + Index, Num - Index, Value);
+		}
+
+#endif //UNREAL_RANGES__SIMD
+
+		template<bool bEqual, typename ElementType>
+		int Find(const ElementType* Data, const int Num, const ElementType& Value)
+		{
+#if UNREAL_RANGES__SIMD
+			if (Num >= static_cast<int>(32 / sizeof(ElementType)) && HasAvx2())
+			{
+				return Find256<bEqual>(Data, Num, Value);
+			}
+
+			return Find128<bEqual>(Data, Num, Value);
+#else
+			return FindScalar<bEqual>(Data, Num, Value);
+#endif
+		}
+	}
+
+	// Index of the first element in "[Data, Data + Num)" that is equal to "Value",
+	// "Num" if there is no such element
+	template<typename ElementType>
+	int FindEqual(const ElementType* Data, const int Num, const ElementType& Value)
+	{
+		static_assert(IsVectorizable<ElementType>(), "Element type is not supported by SIMD kernels");
+		return TemplateDetails::Find<true>(Data, Num, Value);
+	}
+
+	// Index of the first element in "[Data, Data + Num)" that is not equal to "Value",
+	// "Num" if there is no such element
+	template<typename ElementType>
+	int FindNotEqual(const ElementType* Data, const int Num, const ElementType& Value)
+	{
+		static_assert(IsVectorizable<ElementType>(), "Element type is not supported by SIMD kernels");
+		return TemplateDetails::Find<false>(Data, Num, Value);
+	}
+
+	// ------------------ Reduction kernels -------------------
+
+	// "true" if minimum and maximum of keys of "KeyType" may be computed by SIMD kernels
+	template<typename KeyType>
+	constexpr bool IsReducible()
+	{
+		return UNREAL_RANGES__SIMD && (
+			std::is_same<KeyType, std::int32_t>::value ||
+			std::is_same<KeyType, float>::value ||
+			std::is_same<KeyType, double>::value);
+	}
+
+	namespace TemplateDetails
+	{
+		//NB: NaN keys are never better, as for scalar comparisons
+		template<bool bMin, typename KeyType>
+		bool IsBetter(const KeyType& Key, const KeyType& BestKey)
+		{
+			return bMin ? (Key < BestKey) : (BestKey < Key);
+		}
+
+		//NB: Infinities for floating point keys - to not be better than any key
+		template<bool bMin, typename KeyType>
+		KeyType WorstKey()
+		{
+			return std::numeric_limits<KeyType>::has_infinity ?
+				(bMin ? std::numeric_limits<KeyType>::infinity() : -std::numeric_limits<KeyType>::infinity()) :
+				(bMin ? std::numeric_limits<KeyType>::max() : std::numeric_limits<KeyType>::lowest());
+		}
+
+		template<bool bMin, typename KeyType>
+		KeyType ExtremumScalar(const KeyType* Keys, const int Num, KeyType Best)
+		{
+			for (int Index = 0; Index < Num; ++Index)
+			{
+				if (IsBetter<bMin>(Keys[Index], Best))
+				{
+					Best = Keys[Index];
+				}
+			}
+
+			return Best;
+		}
+
+#if UNREAL_RANGES__SIMD
+
+		using FMin = std::true_type;
+		using FMax = std::false_type;
+
+		// - - - - - SSE2
+
+		//NB: SSE2 has no 32 bit integers min/max: lanes are selected by comparison mask
+		inline __m128i Better128(FMin, const std::int32_t*, const __m128i Keys, const __m128i Best)
+		{
+			const __m128i IsKeyBetter = _mm_cmplt_epi32(Keys, Best);
+			return _mm_or_si128(_mm_and_si128(IsKeyBetter, Keys), _mm_andnot_si128(IsKeyBetter, Best));
+		}
+
+		inline __m128i Better128(FMax, const std::int32_t*, const __m128i Keys, const __m128i Best)
+		{
+			const __m128i IsKeyBetter = _mm_cmpgt_epi32(Keys, Best);
+			return _mm_or_si128(_mm_and_si128(IsKeyBetter, Keys), _mm_andnot_si128(IsKeyBetter, Best));
+		}
+
+		//NB: Floating point min/max return second operand if any operand is NaN, so NaN keys are skipped
+		inline __m128i Better128(FMin, const float*, const __m128i Keys, const __m128i Best) { return _mm_castps_si128(_mm_min_ps(_mm_castsi128_ps(Keys), _mm_castsi128_ps(Best))); }
+		inline __m128i Better128(FMax, const float*, const __m128i Keys, const __m128i Best) { return _mm_castps_si128(_mm_max_ps(_mm_castsi128_ps(Keys), _mm_castsi128_ps(Best))); }
+		inline __m128i Better128(FMin, const double*, const __m128i Keys, const __m128i Best) { return _mm_castpd_si128(_mm_min_pd(_mm_castsi128_pd(Keys), _mm_castsi128_pd(Best))); }
+		inline __m128i Better128(FMax, const double*, const __m128i Keys, const __m128i Best) { return _mm_castpd_si128(_mm_max_pd(_mm_castsi128_pd(Keys), _mm_castsi128_pd(Best))); }
+
+		template<bool bMin, typename KeyType>
+		KeyType Extremum128(const KeyType* Keys, const int Num)
+		{
+			constexpr int LanesNum = 16 / sizeof(KeyType);
+			__m128i Best = Splat128(ToLane(WorstKey<bMin, KeyType>()));
+
+			int Index = 0;
+			for (; Index + LanesNum <= Num; Index += LanesNum)
+			{
+				const __m128i Lanes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Keys + Index));
+				Best = Better128(std::integral_constant<bool, bMin>{ }, Keys, Lanes, Best);
+			}
+
+			KeyType BestLanes[LanesNum];
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(BestLanes), Best);
+
+			return ExtremumScalar<bMin>(Keys + Index, Num - Index,
+				ExtremumScalar<bMin>(BestLanes, LanesNum, WorstKey<bMin, KeyType>()));
+		}
+
+		// - - - - - AVX2
+
+		UNREAL_RANGES__SIMD_AVX2 inline __m256i Better256(FMin, const std::int32_t*, const __m256i Keys, const __m256i Best) { return _mm256_min_epi32(Keys, Best); }
+		UNREAL_RANGES__SIMD_AVX2 inline __m256i Better256(FMax, const std::int32_t*, const __m256i Keys, const __m256i Best) { return _mm256_max_epi32(Keys, Best); }
+		UNREAL_RANGES__SIMD_AVX2 inline __m256i Better256(FMin, const float*, const __m256i Keys, const __m256i Best) { return _mm256_castps_si256(_mm256_min_ps(_mm256_castsi256_ps(Keys), _mm256_castsi256_ps(Best))); }
+		UNREAL_RANGES__SIMD_AVX2 inline __m256i Better256(FMax, const float*, const __m256i Keys, const __m256i Best) { return _mm256_castps_si256(_mm256_max_ps(_mm256_castsi256_ps(Keys), _mm256_castsi256_ps(Best))); }
+		UNREAL_RANGES__SIMD_AVX2 inline __m256i Better256(FMin, const double*, const __m256i Keys, const __m256i Best) { return _mm256_castpd_si256(_mm256_min_pd(_mm256_castsi256_pd(Keys), _mm256_castsi256_pd(Best))); }
+		UNREAL_RANGES__SIMD_AVX2 inline __m256i Better256(FMax, const double*, const __m256i Keys, const __m256i Best) { return _mm256_castpd_si256(_mm256_max_pd(_mm256_castsi256_pd(Keys), _mm256_castsi256_pd(Best))); }
+
+		template<bool bMin, typename KeyType>
+		UNREAL_RANGES__SIMD_AVX2 KeyType Extremum256(const KeyType* Keys, const int Num)
+		{
+			constexpr int LanesNum = 32 / sizeof(KeyType);
+			__m256i Best = Splat256(ToLane(WorstKey<bMin, KeyType>()));
+
+			int Index = 0;
+			for (; Index + LanesNum <= Num; Index += LanesNum)
+			{
+				const __m256i Lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Keys + Index));
+				Best = Better256(std::integral_constant<bool, bMin>{ }, Keys, Lanes, Best);
+			}
+
+			KeyType BestLanes[LanesNum];
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(BestLanes), Best);
+
+			return ExtremumScalar<bMin>(Keys + Index, Num - Index,
+				ExtremumScalar<bMin>(BestLanes, LanesNum, WorstKey<bMin, KeyType>()));
+		}
+
+#endif //UNREAL_RANGES__SIMD
+
+		// Best (minimal or maximal) key of "[Keys, Keys + Num)" ignoring NaN keys,
+		// "WorstKey<>()" if there are no such keys
+		template<bool bMin, typename KeyType>
+		KeyType Extremum(const KeyType* Keys, const int Num)
+		{
+#if UNREAL_RANGES__SIMD
+			if (Num >= static_cast<int>(32 / sizeof(KeyType)) && HasAvx2())
+			{
+				return Extremum256<bMin>(Keys, Num);
+			}
+
+			return Extremum128<bMin>(Keys, Num);
+#else
+			return ExtremumScalar<bMin>(Keys, Num, WorstKey<bMin, KeyType>());
+#endif
+		}
+	}
+
+	// Number of keys computed and reduced at once by "IndexOfExtremumBy<>()"
+	constexpr int KeysBlockSize = 256;
+
+	template<typename ElementType, typename ProjectionType>
+	using ProjectionKeyType = std::decay_t<decltype(std::declval<const ProjectionType&>()(std::declval<const ElementType&>()))>;
+
+	// Index of the first element in "[Data, Data + Num)" with minimal (or maximal) projection
+	// key, as for sequential "Proj(Current) < Proj(Best)" selection. "Num" if "Num" is "0".
+	// Projection is called once per element: keys are computed in blocks, each block is
+	// reduced by SIMD kernel and searched for index only if it contains better key
+	template<bool bMin, typename ElementType, typename ProjectionType>
+	int IndexOfExtremumBy(const ElementType* Data, const int Num, const ProjectionType& Proj)
+	{
+		using KeyType = ProjectionKeyType<ElementType, ProjectionType>;
+		static_assert(IsReducible<KeyType>(), "Key type is not supported by SIMD kernels");
+
+		if (Num <= 0)
+		{
+			return Num;
+		}
+
+		KeyType BestKey = Proj(Data[0]);
+		int BestIndex = 0;
+
+		//NB: No key is better than NaN key of the first element
+		if (!(BestKey == BestKey))
+		{
+			return BestIndex;
+		}
+
+		KeyType Keys[KeysBlockSize];
+
+		for (int BlockBegin = 1; BlockBegin < Num; BlockBegin += KeysBlockSize)
+		{
+			const int BlockNum = std::min(KeysBlockSize, Num - BlockBegin);
+
+			for (int Index = 0; Index < BlockNum; ++Index)
+			{
+				Keys[Index] = Proj(Data[BlockBegin + Index]);
+			}
+
+			const KeyType BlockBestKey = TemplateDetails::Extremum<bMin>(Keys, BlockNum);
+			if (TemplateDetails::IsBetter<bMin>(BlockBestKey, BestKey))
+			{
+				BestKey = BlockBestKey;
+				BestIndex = BlockBegin + FindEqual(Keys, BlockNum, BlockBestKey);
+			}
+		}
+
+		return BestIndex;
+	}
+
+	// ------------------ Compaction kernels ------------------
+
+	//NB: Elements are packed by copying their bytes, so only trivially copyable
+	// elements are supported. Size limit keeps block buffers on stack small
+	template<typename ElementType>
+	constexpr bool IsCompactable()
+	{
+		return std::is_trivially_copyable<ElementType>::value && sizeof(ElementType) <= 64;
+	}
+
+	namespace TemplateDetails
+	{
+		// Branchless: every element is written to the next output slot, but the slot
+		// is advanced only for elements with set mask
+		template<typename ElementType>
+		int CompressScalar(const ElementType* Data, const std::uint8_t* Mask, const int Num, unsigned char* Out)
+		{
+			int PackedNum = 0;
+			for (int Index = 0; Index < Num; ++Index)
+			{
+				std::memcpy(Out + PackedNum * sizeof(ElementType), Data + Index, sizeof(ElementType));
+				PackedNum += Mask[Index];
+			}
+			return PackedNum;
+		}
+
+#if UNREAL_RANGES__SIMD
+
+#	if defined(_MSC_VER) && !defined(__clang__)
+#		define UNREAL_RANGES__SIMD_AVX512
+#	else
+#		define UNREAL_RANGES__SIMD_AVX512 __attribute__((target("avx512f")))
+#	endif
+
+		inline int PopCount(const unsigned int Mask)
+		{
+#	if defined(_MSC_VER) && !defined(__clang__)
+			return static_cast<int>(__popcnt(Mask));
+#	else
+			return __builtin_popcount(Mask);
+#	endif
+		}
+
+		inline bool IsAvx512Supported()
+		{
+#	if defined(_MSC_VER)
+			int CpuInfo[4];
+			__cpuid(CpuInfo, 1);
+			const bool bOsSavesZmm = (CpuInfo[2] & (1 << 27)) && ((_xgetbv(0) & 0xE6) == 0xE6);
+
+			__cpuidex(CpuInfo, 7, 0);
+			return bOsSavesZmm && (CpuInfo[1] & (1 << 16));
+#	else
+			return __builtin_cpu_supports("avx512f");
+#	endif
+		}
+
+		inline bool HasAvx512()
+		{
+			static const bool bHasAvx512 = IsAvx512Supported();
+			return bHasAvx512;
+		}
+
+		// Bits of 4 mask bytes (each is "0" or "1")
+		inline unsigned int MaskBits4(const std::uint8_t* Mask)
+		{
+			std::int32_t MaskBytes;
+			std::memcpy(&MaskBytes, Mask, sizeof(MaskBytes));
+
+			const __m128i Bytes = _mm_cvtsi32_si128(MaskBytes);
+			return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpgt_epi8(Bytes, _mm_setzero_si128()))) & 0xFu;
+		}
+
+		// Bits of 8 mask bytes (each is "0" or "1")
+		inline unsigned int MaskBits8(const std::uint8_t* Mask)
+		{
+			const __m128i Bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(Mask));
+			return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpgt_epi8(Bytes, _mm_setzero_si128()))) & 0xFFu;
+		}
+
+		// Bits of 16 mask bytes (each is "0" or "1")
+		inline unsigned int MaskBits16(const std::uint8_t* Mask)
+		{
+			const __m128i Bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Mask));
+			return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpgt_epi8(Bytes, _mm_setzero_si128())));
+		}
+
+		// Indices of 32 bit lanes for "_mm256_permutevar8x32_epi32()" that move lanes selected by
+		// mask to the beginning of register. 64 bit elements are moved as pairs of 32 bit lanes
+		struct FCompressPermutations
+		{
+			FCompressPermutations()
+			{
+				for (unsigned int Mask = 0; Mask < 256; ++Mask)
+				{
+					int PackedNum = 0;
+					for (int Lane = 0; Lane < 8; ++Lane)
+					{
+						if (Mask & (1u << Lane))
+						{
+							Lanes32[Mask][PackedNum++] = static_cast<std::uint8_t>(Lane);
+						}
+					}
+					for (; PackedNum < 8; ++PackedNum)
+					{
+						Lanes32[Mask][PackedNum] = 0;
+					}
+				}
+
+				for (unsigned int Mask = 0; Mask < 16; ++Mask)
+				{
+					int PackedNum = 0;
+					for (int Lane = 0; Lane < 4; ++Lane)
+					{
+						if (Mask & (1u << Lane))
+						{
+							Lanes64[Mask][PackedNum++] = static_cast<std::uint8_t>(Lane * 2);
+							Lanes64[Mask][PackedNum++] = static_cast<std::uint8_t>(Lane * 2 + 1);
+						}
+					}
+					for (; PackedNum < 8; ++PackedNum)
+					{
+						Lanes64[Mask][PackedNum] = 0;
+					}
+				}
+			}
+
+			std::uint8_t Lanes32[256][8];
+			std::uint8_t Lanes64[16][8];
+		};
+
+		inline const FCompressPermutations& CompressPermutations()
+		{
+			static const FCompressPermutations Permutations;
+			return Permutations;
+		}
+
+		// - - - - - AVX2 (permutation of 8 lanes)
+
+		//NB: Whole register is stored after the last packed element, so it is safe only while
+		// store doesn't cross end of the block ("PackedNum" is never bigger than "Index")
+		template<typename ElementType>
+		UNREAL_RANGES__SIMD_AVX2 int Compress256(std::integral_constant<int, 4>,
+			const ElementType* Data, const std::uint8_t* Mask, const int Num, unsigned char* Out)
+		{
+			const FCompressPermutations& Permutations = CompressPermutations();
+
+			int PackedNum = 0;
+			int Index = 0;
+			for (; Index + 8 <= Num; Index += 8)
+			{
+				const unsigned int Bits = MaskBits8(Mask + Index);
+				const __m256i Lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Data + Index));
+				const __m256i Permutation = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(Permutations.Lanes32[Bits])));
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + PackedNum * 4), _mm256_permutevar8x32_epi32(Lanes, Permutation));
+				PackedNum += PopCount(Bits);
+			}
+
+			return PackedNum + CompressScalar(Data + Index, Mask + Index, Num - Index, Out + PackedNum * 4);
+		}
+
+		template<typename ElementType>
+		UNREAL_RANGES__SIMD_AVX2 int Compress256(std::integral_constant<int, 8>,
+			const ElementType* Data, const std::uint8_t* Mask, const int Num, unsigned char* Out)
+		{
+			const FCompressPermutations& Permutations = CompressPermutations();
+
+			int PackedNum = 0;
+			int Index = 0;
+			for (; Index + 4 <= Num; Index += 4)
+			{
+				const unsigned int Bits = MaskBits4(Mask + Index);
+				const __m256i Lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(Data + Index));
+				const __m256i Permutation = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(Permutations.Lanes64[Bits])));
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Out + PackedNum * 8), _mm256_permutevar8x32_epi32(Lanes, Permutation));
+				PackedNum += PopCount(Bits);
+			}
+
+			return PackedNum + CompressScalar(Data + Index, Mask + Index, Num - Index, Out + PackedNum * 8);
+		}
+
+		// - - - - - AVX-512 (compressing store, only selected lanes are written)
+
+		template<typename ElementType>
+		UNREAL_RANGES__SIMD_AVX512 int Compress512(std::integral_constant<int, 4>,
+			const ElementType* Data, const std::uint8_t* Mask, const int Num, unsigned char* Out)
+		{
+			int PackedNum = 0;
+			int Index = 0;
+			for (; Index + 16 <= Num; Index += 16)
+			{
+				const unsigned int Bits = MaskBits16(Mask + Index);
+				const __m512i Lanes = _mm512_loadu_si512(Data + Index);
+
+				_mm512_mask_compressstoreu_epi32(Out + PackedNum * 4, static_cast<__mmask16>(Bits), Lanes);
+				PackedNum += PopCount(Bits);
+			}
+
+			return PackedNum + CompressScalar(Data + Index, Mask + Index, Num - Index, Out + PackedNum * 4);
+		}
+
+		template<typename ElementType>
+		UNREAL_RANGES__SIMD_AVX512 int Compress512(std::integral_constant<int, 8>,
+			const ElementType* Data, const std::uint8_t* Mask, const int Num, unsigned char* Out)
+		{
+			int PackedNum = 0;
+			int Index = 0;
+			for (; Index + 8 <= Num; Index += 8)
+			{
+				const unsigned int Bits = MaskBits8(Mask + Index);
+				const __m512i Lanes = _mm512_loadu_si512(Data + Index);
+
+				_mm512_mask_compressstoreu_epi64(Out + PackedNum * 8, static_cast<__mmask8>(Bits), Lanes);
+				PackedNum += PopCount(Bits);
+			}
+
+			return PackedNum + CompressScalar(Data + Index, Mask + Index, Num - Index, Out + PackedNum * 8);
+		}
+
+		// 4 and 8 byte elements are packed as lanes
+		template<typename ElementType>
+		int CompressLanes(const ElementType* Data, const std::uint8_t* Mask, const int Num, unsigned char* Out)
+		{
+			const std::integral_constant<int, static_cast<int>(sizeof(ElementType))> SizeTag{};
+
+			if (HasAvx512())
+			{
+				return Compress512(SizeTag, Data, Mask, Num, Out);
+			}
+
+			if (HasAvx2())
+			{
+				return Compress256(SizeTag, Data, Mask, Num, Out);
+			}
+
+			return CompressScalar(Data, Mask, Num, Out);
+		}
+
+#endif //UNREAL_RANGES__SIMD
+
+		template<typename ElementType>
+		int Compress(std::true_type, const ElementType* Data, const std::uint8_t* Mask, const int Num, unsigned char* Out)
+		{
+#if UNREAL_RANGES__SIMD
+			return CompressLanes(Data, Mask, Num, Out);
+#else
+			return CompressScalar(Data, Mask, Num, Out);
+#endif
+		}
+
+		template<typename ElementType>
+		int Compress(std::false_type, const ElementType* Data, const std::uint8_t* Mask, const int Num, unsigned char* Out)
+		{
+			return CompressScalar(Data, Mask, Num, Out);
+		}
+
+		// Packs elements of "[Data, Data + Num)" with set mask to the beginning of "Out".
+		// Returns number of packed elements
+		template<typename ElementType>
+		int Compress(const ElementType* Data, const std::uint8_t* Mask, const int Num, unsigned char* Out)
+		{
+			return Compress(std::integral_constant<bool, sizeof(ElementType) == 4 || sizeof(ElementType) == 8>{},
+				Data, Mask, Num, Out);
+		}
+	}
+
+	// Number of elements checked by predicate and packed at once by "CompactBy<>()"
+	constexpr int CompactBlockSize = 256;
+
+	// Calls "Append(Elements, Num)" with packed runs of elements of "[Data, Data + Num)" that
+	// satisfy "Pred", in their order. Predicate is called once per element in a tight loop that
+	// only writes mask (so simple predicates may be vectorized by compiler), then elements of
+	// each block are packed by "compressing" SIMD kernel for 4 and 8 byte elements
+	template<typename ElementType, typename PredicateType, typename AppendType>
+	void CompactBy(const ElementType* Data, const int Num, const PredicateType& Pred, const AppendType& Append)
+	{
+		static_assert(IsCompactable<ElementType>(), "Element type is not supported by compaction kernels");
+
+		std::uint8_t Mask[CompactBlockSize];
+		alignas(ElementType) unsigned char Packed[CompactBlockSize * sizeof(ElementType)];
+
+		for (int BlockBegin = 0; BlockBegin < Num; BlockBegin += CompactBlockSize)
+		{
+			const int BlockNum = std::min(CompactBlockSize, Num - BlockBegin);
+			const ElementType* Block = Data + BlockBegin;
+
+			for (int Index = 0; Index < BlockNum; ++Index)
+			{
+				Mask[Index] = static_cast<std::uint8_t>(static_cast<bool>(Pred(Block[Index])));
+			}
+
+			const int PackedNum = TemplateDetails::Compress(Block, Mask, BlockNum, Packed);
+			if (PackedNum > 0)
+			{
+				Append(reinterpret_cast<const ElementType*>(Packed), PackedNum);
+			}
+		}
+	}
+
+	// ------------------- Distance kernels -------------------
+
+	// "true" if points with coordinates of "CoordType" are supported by distance kernels
+	template<typename CoordType>
+	constexpr bool IsDistanceCoordinate()
+	{
+		return std::is_same<CoordType, float>::value || std::is_same<CoordType, double>::value;
+	}
+
+	namespace TemplateDetails
+	{
+		//NB: Indices are written branchless: index of every point is written to the next
+		// slot, but the slot is advanced only for passed points
+		template<bool bClose, typename CoordType>
+		int FilterByDistanceSquaredScalar(
+			const CoordType* X, const CoordType* Y, const CoordType* Z, const int BeginIndex, const int Num,
+			const CoordType PointX, const CoordType PointY, const CoordType PointZ, const CoordType RadiusSquared,
+			CoordType* DistancesSquared, int* PassedIndices)
+		{
+			int PassedNum = 0;
+			for (int Index = BeginIndex; Index < Num; ++Index)
+			{
+				const CoordType DX = X[Index] - PointX;
+				const CoordType DY = Y[Index] - PointY;
+				const CoordType DZ = Z[Index] - PointZ;
+				const CoordType DistanceSquared = DX * DX + DY * DY + DZ * DZ;
+
+				DistancesSquared[Index] = DistanceSquared;
+				PassedIndices[PassedNum] = Index;
+				PassedNum += static_cast<int>(bClose ? DistanceSquared < RadiusSquared : DistanceSquared > RadiusSquared);
+			}
+
+			return PassedNum;
+		}
+
+		inline int AppendPassedIndices(const unsigned int Bits, const int LanesNum, const int Index, int* PassedIndices)
+		{
+			int PassedNum = 0;
+			for (int Lane = 0; Lane < LanesNum; ++Lane)
+			{
+				PassedIndices[PassedNum] = Index + Lane;
+				PassedNum += static_cast<int>((Bits >> Lane) & 1u);
+			}
+
+			return PassedNum;
+		}
+
+#if UNREAL_RANGES__SIMD
+
+		// - - - - - SSE2 (4 floats or 2 doubles per operation)
+
+		inline __m128 LoadCoords128(const float* Coords) { return _mm_loadu_ps(Coords); }
+		inline __m128d LoadCoords128(const double* Coords) { return _mm_loadu_pd(Coords); }
+		inline void StoreCoords128(float* Coords, const __m128 Lanes) { _mm_storeu_ps(Coords, Lanes); }
+		inline void StoreCoords128(double* Coords, const __m128d Lanes) { _mm_storeu_pd(Coords, Lanes); }
+		inline __m128 SplatCoord128(const float Coord) { return _mm_set1_ps(Coord); }
+		inline __m128d SplatCoord128(const double Coord) { return _mm_set1_pd(Coord); }
+		inline __m128 Sub128(const __m128 A, const __m128 B) { return _mm_sub_ps(A, B); }
+		inline __m128d Sub128(const __m128d A, const __m128d B) { return _mm_sub_pd(A, B); }
+		inline __m128 MulAdd128(const __m128 A, const __m128 B, const __m128 C) { return _mm_add_ps(_mm_mul_ps(A, B), C); }
+		inline __m128d MulAdd128(const __m128d A, const __m128d B, const __m128d C) { return _mm_add_pd(_mm_mul_pd(A, B), C); }
+
+		//NB: Masks have one bit per lane
+		inline unsigned int LessMask128(const __m128 A, const __m128 B) { return static_cast<unsigned int>(_mm_movemask_ps(_mm_cmplt_ps(A, B))); }
+		inline unsigned int LessMask128(const __m128d A, const __m128d B) { return static_cast<unsigned int>(_mm_movemask_pd(_mm_cmplt_pd(A, B))); }
+
+		template<bool bClose, typename CoordType>
+		int FilterByDistanceSquared128(
+			const CoordType* X, const CoordType* Y, const CoordType* Z, const int Num,
+			const CoordType PointX, const CoordType PointY, const CoordType PointZ, const CoordType RadiusSquared,
+			CoordType* DistancesSquared, int* PassedIndices)
+		{
+			constexpr int LanesNum = 16 / sizeof(CoordType);
+			const auto PointXs = SplatCoord128(PointX);
+			const auto PointYs = SplatCoord128(PointY);
+			const auto PointZs = SplatCoord128(PointZ);
+			const auto RadiusesSquared = SplatCoord128(RadiusSquared);
+
+			int PassedNum = 0;
+			int Index = 0;
+			for (; Index + LanesNum <= Num; Index += LanesNum)
+			{
+				const auto DX = Sub128(LoadCoords128(X + Index), PointXs);
+				const auto DY = Sub128(LoadCoords128(Y + Index), PointYs);
+				const auto DZ = Sub128(LoadCoords128(Z + Index), PointZs);
+				const auto Distances = MulAdd128(DZ, DZ, MulAdd128(DY, DY, MulAdd128(DX, DX, SplatCoord128(CoordType(0)))));
+
+				StoreCoords128(DistancesSquared + Index, Distances);
+
+				const unsigned int Bits = bClose ? LessMask128(Distances, RadiusesSquared) : LessMask128(RadiusesSquared, Distances);
+				PassedNum += AppendPassedIndices(Bits, LanesNum, Index, PassedIndices + PassedNum);
+			}
+
+			return PassedNum + FilterByDistanceSquaredScalar<bClose>(X, Y, Z, Index, Num,
+				PointX, PointY, PointZ, RadiusSquared, DistancesSquared, PassedIndices + PassedNum);
+		}
+
+		// - - - - - AVX2 (8 floats or 4 doubles per operation)
+
+		UNREAL_RANGES__SIMD_AVX2 inline __m256 LoadCoords256(const float* Coords) { return _mm256_loadu_ps(Coords); }
+		UNREAL_RANGES__SIMD_AVX2 inline __m256d LoadCoords256(const double* Coords) { return _mm256_loadu_pd(Coords); }
+		UNREAL_RANGES__SIMD_AVX2 inline void StoreCoords256(float* Coords, const __m256 Lanes) { _mm256_storeu_ps(Coords, Lanes); }
+		UNREAL_RANGES__SIMD_AVX2 inline void StoreCoords256(double* Coords, const __m256d Lanes) { _mm256_storeu_pd(Coords, Lanes); }
+		UNREAL_RANGES__SIMD_AVX2 inline __m256 SplatCoord256(const float Coord) { return _mm256_set1_ps(Coord); }
+		UNREAL_RANGES__SIMD_AVX2 inline __m256d SplatCoord256(const double Coord) { return _mm256_set1_pd(Coord); }
+		UNREAL_RANGES__SIMD_AVX2 inline __m256 Sub256(const __m256 A, const __m256 B) { return _mm256_sub_ps(A, B); }
+		UNREAL_RANGES__SIMD_AVX2 inline __m256d Sub256(const __m256d A, const __m256d B) { return _mm256_sub_pd(A, B); }
+		UNREAL_RANGES__SIMD_AVX2 inline __m256 MulAdd256(const __m256 A, const __m256 B, const __m256 C) { return _mm256_add_ps(_mm256_mul_ps(A, B), C); }
+		UNREAL_RANGES__SIMD_AVX2 inline __m256d MulAdd256(const __m256d A, const __m256d B, const __m256d C) { return _mm256_add_pd(_mm256_mul_pd(A, B), C); }
+		UNREAL_RANGES__SIMD_AVX2 inline unsigned int LessMask256(const __m256 A, const __m256 B) { return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_cmp_ps(A, B, _CMP_LT_OQ))); }
+		UNREAL_RANGES__SIMD_AVX2 inline unsigned int LessMask256(const __m256d A, const __m256d B) { return static_cast<unsigned int>(_mm256_movemask_pd(_mm256_cmp_pd(A, B, _CMP_LT_OQ))); }
+
+		// Passed indices are got from lanes permutation table (see "CompressPermutations()")
+		UNREAL_RANGES__SIMD_AVX2 inline int AppendPassedIndices256(std::integral_constant<int, 8>,
+			const FCompressPermutations& Permutations, const unsigned int Bits, const int Index, int* PassedIndices)
+		{
+			const __m256i Lanes = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(Permutations.Lanes32[Bits])));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(PassedIndices), _mm256_add_epi32(Lanes, _mm256_set1_epi32(Index)));
+			return PopCount(Bits);
+		}
+
+		UNREAL_RANGES__SIMD_AVX2 inline int AppendPassedIndices256(std::integral_constant<int, 4>,
+			const FCompressPermutations& Permutations, const unsigned int Bits, const int Index, int* PassedIndices)
+		{
+			const __m128i Lanes = _mm_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(Permutations.Lanes32[Bits])));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(PassedIndices), _mm_add_epi32(Lanes, _mm_set1_epi32(Index)));
+			return PopCount(Bits);
+		}
+
+		//NB: Multiplication and addition are not fused, so squared distances are same as computed by scalar code
+		template<bool bClose, typename CoordType>
+		UNREAL_RANGES__SIMD_AVX2 int FilterByDistanceSquared256(
+			const CoordType* X, const CoordType* Y, const CoordType* Z, const int Num,
+			const CoordType PointX, const CoordType PointY, const CoordType PointZ, const CoordType RadiusSquared,
+			CoordType* DistancesSquared, int* PassedIndices)
+		{
+			constexpr int LanesNum = 32 / sizeof(CoordType);
+			const auto PointXs = SplatCoord256(PointX);
+			const auto PointYs = SplatCoord256(PointY);
+			const auto PointZs = SplatCoord256(PointZ);
+			const auto RadiusesSquared = SplatCoord256(RadiusSquared);
+			const FCompressPermutations& Permutations = CompressPermutations();
+
+			int PassedNum = 0;
+			int Index = 0;
+			for (; Index + LanesNum <= Num; Index += LanesNum)
+			{
+				const auto DX = Sub256(LoadCoords256(X + Index), PointXs);
+				const auto DY = Sub256(LoadCoords256(Y + Index), PointYs);
+				const auto DZ = Sub256(LoadCoords256(Z + Index), PointZs);
+				const auto Distances = MulAdd256(DZ, DZ, MulAdd256(DY, DY, MulAdd256(DX, DX, SplatCoord256(CoordType(0)))));
+
+				StoreCoords256(DistancesSquared + Index, Distances);
+
+				const unsigned int Bits = bClose ? LessMask256(Distances, RadiusesSquared) : LessMask256(RadiusesSquared, Distances);
+				PassedNum += AppendPassedIndices256(std::integral_constant<int, LanesNum>{}, Permutations, Bits, Index, PassedIndices + PassedNum);
+			}
+
+			return PassedNum + FilterByDistanceSquaredScalar<bClose>(X, Y, Z, Index, Num,
+				PointX, PointY, PointZ, RadiusSquared, DistancesSquared, PassedIndices + PassedNum);
+		}
+
+#endif //UNREAL_RANGES__SIMD
+	}
+
+	// Computes squared distances from "Point" to points "(X[Index], Y[Index], Z[Index])" to
+	// "DistancesSquared" and writes indices of points that are closer (for "bClose") or more
+	// far than radius (compared squared) to "PassedIndices" in ascending order. Returns number
+	// of passed points. Points are stored in structure-of-arrays layout, so each coordinate
+	// of several points is loaded at once
+	template<bool bClose, typename CoordType>
+	int FilterByDistanceSquared(
+		const CoordType* X, const CoordType* Y, const CoordType* Z, const int Num,
+		const CoordType PointX, const CoordType PointY, const CoordType PointZ, const CoordType RadiusSquared,
+		CoordType* DistancesSquared, int* PassedIndices)
+	{
+		static_assert(IsDistanceCoordinate<CoordType>(), "Coordinate type is not supported by distance kernels");
+
+#if UNREAL_RANGES__SIMD
+		if (TemplateDetails::HasAvx2())
+		{
+			return TemplateDetails::FilterByDistanceSquared256<bClose>(
+				X, Y, Z, Num, PointX, PointY, PointZ, RadiusSquared, DistancesSquared, PassedIndices);
+		}
+
+		return TemplateDetails::FilterByDistanceSquared128<bClose>(
+			X, Y, Z, Num, PointX, PointY, PointZ, RadiusSquared, DistancesSquared, PassedIndices);
+#else
+		return TemplateDetails::FilterByDistanceSquaredScalar<bClose>(
+			X, Y, Z, 0, Num, PointX, PointY, PointZ, RadiusSquared, DistancesSquared, PassedIndices);
+#endif
+	}
+
+	// ---------------------- Algorithms ----------------------
+
+	//NB: Available only if Range is contiguous collection of vectorizable elements of
+	// same type as "Value". Other element types may have "==" with other semantics than
+	// comparing lanes (for example, comparison of "int" elements with "double" value)
+	template<typename RangeType, typename ValueType>
+	auto Contains(const RangeType& Range, const ValueType& Value)->std::enable_if_t<
+		IsVectorizable<RangeDataElementType<RangeType>>() &&
+		std::is_same<RangeDataElementType<RangeType>, std::decay_t<ValueType>>::value, bool>
+	{
+		const int Num = UnrealRanges::Utils::RangeSize(Range);
+		return FindEqual(RangeData(Range), Num, Value) != Num;
+	}
+
+	namespace TemplateDetails
+	{
+		template<typename RangeType, typename ProjectionType>
+		constexpr auto IsReducibleBy(int)->decltype(
+			std::declval<ProjectionKeyType<RangeDataElementType<RangeType>, ProjectionType>&>(),
+			true)
+		{
+			return IsReducible<ProjectionKeyType<RangeDataElementType<RangeType>, ProjectionType>>();
+		}
+
+		template<typename RangeType, typename ProjectionType>
+		constexpr bool IsReducibleBy(...)
+		{
+			return false;
+		}
+	}
+
+	// "true" if Range is contiguous collection and keys of its elements got by projection
+	// are supported by reduction kernels (see "IndexOfExtremumBy<>()")
+	template<typename RangeType, typename ProjectionType>
+	constexpr bool IsReducibleBy()
+	{
+		return TemplateDetails::IsReducibleBy<RangeType, ProjectionType>(0);
+	}
+
+}}} //namespace UnrealRanges::Private::Simd
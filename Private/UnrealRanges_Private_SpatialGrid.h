@@ -0,0 +1,643 @@
+#pragma once
+
+#include <algorithm>//for "std::min()", "std::max()", heap of closest entries
+#include <cmath>//for "std::floor()", "std::sqrt()"
+#include <cstddef>//for "std::size_t"
+#include <cstdint>//for "std::uint64_t"
+#include <cstdlib>//for "std::abs()"
+#include <functional>//for "std::hash<>"
+#include <limits>//for "std::numeric_limits<>"
+#include <unordered_map>//for cells and elements index
+#include <utility>//for "std::move()", "std::pair<>"
+#include <vector>//for cells content
+
+// Engine independent core of spatial grids (see "TActorsSpatialGrid<>"). Elements
+// are stored with copies of their locations in cells of uniform grid, cells are
+// stored in hash map, so only occupied cells take memory
+
+namespace UnrealRanges{ namespace Private{ namespace Spatial{
+
+	// ----------------------- Points -------------------------
+
+	template<typename CoordType>
+	struct TPoint
+	{
+		CoordType X;
+		CoordType Y;
+		CoordType Z;
+	};
+
+	template<typename CoordType>
+	CoordType DistanceSquared(const TPoint<CoordType>& A, const TPoint<CoordType>& B)
+	{
+		const CoordType DX = A.X - B.X;
+		const CoordType DY = A.Y - B.Y;
+		const CoordType DZ = A.Z - B.Z;
+		return DX * DX + DY * DY + DZ * DZ;
+	}
+
+	// ----------------------- Shapes -------------------------
+
+	// Shapes are used by queries: "Contains(Point)" checks location of element,
+	// "GetBounds(Min, Max)" gives box to select cells for checking
+
+	template<typename CoordType>
+	class TSphere
+	{
+	public:
+		TSphere(const TPoint<CoordType>& InCenter, const CoordType InRadius)
+			: Center(InCenter), Radius(std::max(InRadius, static_cast<CoordType>(0))), RadiusSquared(Radius * Radius)
+		{ }
+
+		//NB: Same as "Logic::Close" distance queries - points closer than radius
+		bool Contains(const TPoint<CoordType>& Point) const
+		{
+			return DistanceSquared(Point, Center) < RadiusSquared;
+		}
+
+		void GetBounds(TPoint<CoordType>& OutMin, TPoint<CoordType>& OutMax) const
+		{
+			OutMin = { Center.X - Radius, Center.Y - Radius, Center.Z - Radius };
+			OutMax = { Center.X + Radius, Center.Y + Radius, Center.Z + Radius };
+		}
+
+	private:
+		TPoint<CoordType> Center;
+		CoordType Radius;
+		CoordType RadiusSquared;
+	};
+
+	template<typename CoordType>
+	class TBox
+	{
+	public:
+		TBox(const TPoint<CoordType>& InMin, const TPoint<CoordType>& InMax)
+			: Min(InMin), Max(InMax)
+		{ }
+
+		//NB: Borders are included
+		bool Contains(const TPoint<CoordType>& Point) const
+		{
+			return
+				Point.X >= Min.X && Point.X <= Max.X &&
+				Point.Y >= Min.Y && Point.Y <= Max.Y &&
+				Point.Z >= Min.Z && Point.Z <= Max.Z;
+		}
+
+		void GetBounds(TPoint<CoordType>& OutMin, TPoint<CoordType>& OutMax) const
+		{
+			OutMin = Min;
+			OutMax = Max;
+		}
+
+	private:
+		TPoint<CoordType> Min;
+		TPoint<CoordType> Max;
+	};
+
+	template<typename CoordType>
+	class TCone
+	{
+	public:
+		//NB: "Direction" is normalized here. Cone with zero direction contains nothing
+		TCone(const TPoint<CoordType>& InApex, const TPoint<CoordType>& Direction, const CoordType HalfAngleRadians, const CoordType InLength)
+			: Apex(InApex),
+			Length(std::max(InLength, static_cast<CoordType>(0))),
+			LengthSquared(Length * Length),
+			CosHalfAngle(static_cast<CoordType>(std::cos(HalfAngleRadians)))
+		{
+			const CoordType DirectionSize = std::sqrt(Direction.X * Direction.X + Direction.Y * Direction.Y + Direction.Z * Direction.Z);
+			bValid = DirectionSize > static_cast<CoordType>(0);
+			UnitDirection = bValid ?
+				TPoint<CoordType>{ Direction.X / DirectionSize, Direction.Y / DirectionSize, Direction.Z / DirectionSize } :
+				TPoint<CoordType>{ 0, 0, 0 };
+		}
+
+		// Point is closer to apex than length and angle between direction and
+		// "Point - Apex" is not bigger than half angle. Apex itself is included
+		bool Contains(const TPoint<CoordType>& Point) const
+		{
+			const CoordType ToPointSquared = DistanceSquared(Point, Apex);
+			if (!bValid || !(ToPointSquared <= LengthSquared))
+			{
+				return false;
+			}
+
+			const CoordType Dot =
+				(Point.X - Apex.X) * UnitDirection.X +
+				(Point.Y - Apex.Y) * UnitDirection.Y +
+				(Point.Z - Apex.Z) * UnitDirection.Z;
+
+			return Dot >= CosHalfAngle * std::sqrt(ToPointSquared);
+		}
+
+		//NB: Bounds of sphere around apex: cones are usually narrow, but the box is
+		// still conservative for any angle
+		void GetBounds(TPoint<CoordType>& OutMin, TPoint<CoordType>& OutMax) const
+		{
+			OutMin = { Apex.X - Length, Apex.Y - Length, Apex.Z - Length };
+			OutMax = { Apex.X + Length, Apex.Y + Length, Apex.Z + Length };
+		}
+
+	private:
+		TPoint<CoordType> Apex;
+		TPoint<CoordType> UnitDirection;
+		CoordType Length;
+		CoordType LengthSquared;
+		CoordType CosHalfAngle;
+		bool bValid;
+	};
+
+	// ----------------------- Cells --------------------------
+
+	struct FCell
+	{
+		int X;
+		int Y;
+		int Z;
+	};
+
+	inline bool operator==(const FCell& A, const FCell& B)
+	{
+		return A.X == B.X && A.Y == B.Y && A.Z == B.Z;
+	}
+
+	struct FCellHash
+	{
+		std::size_t operator()(const FCell& Cell) const
+		{
+			std::uint64_t Hash =
+				static_cast<std::uint64_t>(static_cast<std::uint32_t>(Cell.X)) * 0x9E3779B97F4A7C15ull ^
+				static_cast<std::uint64_t>(static_cast<std::uint32_t>(Cell.Y)) * 0xC2B2AE3D27D4EB4Full ^
+				static_cast<std::uint64_t>(static_cast<std::uint32_t>(Cell.Z)) * 0x165667B19E3779F9ull;
+			Hash ^= Hash >> 29;
+			return static_cast<std::size_t>(Hash);
+		}
+	};
+
+	// ----------------------- Queries ------------------------
+
+	// Range of grid elements with locations inside of shape. Cells to check are
+	// selected on construction, locations are checked on iteration
+	template<typename EntryType, typename ShapeType>
+	class TQueryRange
+	{
+	public:
+		using CellType = std::vector<EntryType>;
+		using ElementType = decltype(std::declval<const EntryType&>().Element);
+
+		class Iterator
+		{
+		public:
+			Iterator(const CellType* const* InCurrentCell, const CellType* const* InEndCell, const ShapeType& InShape)
+				: CurrentCell(InCurrentCell), EndCell(InEndCell), EntryIndex(0), Shape(InShape)
+			{
+				SkipNotContained();
+			}
+
+			const ElementType& operator*() const
+			{
+				return (**CurrentCell)[EntryIndex].Element;
+			}
+
+			void operator++()
+			{
+				++EntryIndex;
+				SkipNotContained();
+			}
+
+			bool operator!=(const Iterator& Other) const
+			{
+				return CurrentCell != Other.CurrentCell || EntryIndex != Other.EntryIndex;
+			}
+
+			bool operator==(const Iterator& Other) const
+			{
+				return !(*this != Other);
+			}
+
+		private:
+			void SkipNotContained()
+			{
+				for (; CurrentCell != EndCell; ++CurrentCell, EntryIndex = 0)
+				{
+					const CellType& Cell = **CurrentCell;
+					for (; EntryIndex < static_cast<int>(Cell.size()); ++EntryIndex)
+					{
+						if (Shape.Contains(Cell[EntryIndex].Location))
+						{
+							return;
+						}
+					}
+				}
+			}
+
+			const CellType* const* CurrentCell;
+			const CellType* const* EndCell;
+			int EntryIndex;
+
+			//NB: Copy - range may be moved to pipeline after iterators creation
+			ShapeType Shape;
+		};
+
+		TQueryRange(std::vector<const CellType*>&& InCells, const ShapeType& InShape)
+			: Cells(std::move(InCells)), Shape(InShape)
+		{ }
+
+		Iterator begin() const
+		{
+			return { Cells.data(), Cells.data() + Cells.size(), Shape };
+		}
+
+		Iterator end() const
+		{
+			return { Cells.data() + Cells.size(), Cells.data() + Cells.size(), Shape };
+		}
+
+		// Number of elements in selected cells (see "UnrealRanges::Utils::RangeMaxSize()")
+		int MaxSize() const
+		{
+			int Result = 0;
+			for (const CellType* Cell : Cells)
+			{
+				Result += static_cast<int>(Cell->size());
+			}
+			return Result;
+		}
+
+	private:
+		//NB: Iterators point to the storage of "Cells" that is kept on moving of range
+		std::vector<const CellType*> Cells;
+		ShapeType Shape;
+	};
+
+	// ------------------------ Grid --------------------------
+
+	// Uniform grid of "CellSize" cells. "ElementType" should be hashable (for
+	// example, pointers): elements index is used for updating and removing
+	template<typename ElementType, typename CoordType>
+	class THashGrid
+	{
+	public:
+		using PointType = TPoint<CoordType>;
+
+		struct FEntry
+		{
+			ElementType Element;
+			PointType Location;
+		};
+
+		using CellType = std::vector<FEntry>;
+
+		explicit THashGrid(const CoordType InCellSize)
+			: CellSize(InCellSize > static_cast<CoordType>(0) ? InCellSize : static_cast<CoordType>(1))
+		{ }
+
+		CoordType GetCellSize() const
+		{
+			return CellSize;
+		}
+
+		int Num() const
+		{
+			return static_cast<int>(ElementCells.size());
+		}
+
+		// Adds element or updates its location if it's already added
+		void Add(const ElementType& Element, const PointType& Location)
+		{
+			if (!Update(Element, Location))
+			{
+				const FCell Cell = CellOf(Location);
+				Cells[Cell].push_back({ Element, Location });
+				ElementCells.emplace(Element, Cell);
+			}
+		}
+
+		// Updates location of added element. Element is moved between cells only if its
+		// cell is changed. Returns "false" if element is not added
+		bool Update(const ElementType& Element, const PointType& Location)
+		{
+			const auto Found = ElementCells.find(Element);
+			if (Found == ElementCells.end())
+			{
+				return false;
+			}
+
+			const FCell NewCell = CellOf(Location);
+			if (NewCell == Found->second)
+			{
+				FindEntry(Cells[NewCell], Element)->Location = Location;
+				return true;
+			}
+
+			RemoveFromCell(Found->second, Element);
+			Cells[NewCell].push_back({ Element, Location });
+			Found->second = NewCell;
+			return true;
+		}
+
+		bool Remove(const ElementType& Element)
+		{
+			const auto Found = ElementCells.find(Element);
+			if (Found == ElementCells.end())
+			{
+				return false;
+			}
+
+			RemoveFromCell(Found->second, Element);
+			ElementCells.erase(Found);
+			return true;
+		}
+
+		void Reset()
+		{
+			Cells.clear();
+			ElementCells.clear();
+		}
+
+		// Calls "Func(Element, Location)" for each element
+		template<typename FuncType>
+		void ForEach(const FuncType& Func) const
+		{
+			for (const auto& Cell : Cells)
+			{
+				for (const FEntry& Entry : Cell.second)
+				{
+					Func(Entry.Element, Entry.Location);
+				}
+			}
+		}
+
+		template<typename ShapeType>
+		TQueryRange<FEntry, ShapeType> Query(const ShapeType& Shape) const
+		{
+			PointType Min;
+			PointType Max;
+			Shape.GetBounds(Min, Max);
+
+			std::vector<const CellType*> SelectedCells;
+
+			const FCell MinCell = CellOf(Min);
+			const FCell MaxCell = CellOf(Max);
+			const double BoundsCellsNum =
+				(static_cast<double>(MaxCell.X) - MinCell.X + 1) *
+				(static_cast<double>(MaxCell.Y) - MinCell.Y + 1) *
+				(static_cast<double>(MaxCell.Z) - MinCell.Z + 1);
+
+			//NB: For bounds bigger than number of occupied cells it's cheaper to check all of them
+			if (BoundsCellsNum > static_cast<double>(Cells.size()))
+			{
+				for (const auto& Cell : Cells)
+				{
+					if (IsInBounds(Cell.first, MinCell, MaxCell))
+					{
+						SelectedCells.push_back(&Cell.second);
+					}
+				}
+			}
+			else
+			{
+				for (int X = MinCell.X; X <= MaxCell.X; ++X)
+				{
+					for (int Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+					{
+						for (int Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+						{
+							AddIfOccupied(FCell{ X, Y, Z }, SelectedCells);
+						}
+					}
+				}
+			}
+
+			return { std::move(SelectedCells), Shape };
+		}
+
+		// Closest to "Point" entry with distance less than "MaxDistance", "nullptr" if
+		// there is no such entry
+		const FEntry* FindClosest(const PointType& Point, const CoordType MaxDistance, CoordType& OutDistanceSquared) const
+		{
+			const FEntry* Best = nullptr;
+			CoordType BestDistanceSquared = std::numeric_limits<CoordType>::max();
+
+			if (MaxDistance < static_cast<CoordType>(0))
+			{
+				return nullptr;
+			}
+
+			const CoordType MaxDistanceSquared = MaxDistance * MaxDistance;
+
+			ForEachCellByRings(Point,
+				[&]()
+				{
+					return Best ? BestDistanceSquared : MaxDistanceSquared;
+				},
+				[&](const CellType& Cell)
+				{
+					for (const FEntry& Entry : Cell)
+					{
+						const CoordType EntryDistanceSquared = DistanceSquared(Point, Entry.Location);
+						if (EntryDistanceSquared < BestDistanceSquared && EntryDistanceSquared < MaxDistanceSquared)
+						{
+							BestDistanceSquared = EntryDistanceSquared;
+							Best = &Entry;
+						}
+					}
+				});
+
+			OutDistanceSquared = BestDistanceSquared;
+			return Best;
+		}
+
+		// Up to "Num" closest to "Point" entries with distances less than "MaxDistance" as
+		// pairs "{DistanceSquared, Entry}" sorted from the closest one. Candidates are kept in
+		// heap with the most far of them on top, so cells are checked until no unchecked cell
+		// may contain entry closer than the top one
+		void FindClosestNum(const PointType& Point, const int Num, const CoordType MaxDistance,
+			std::vector<std::pair<CoordType, const FEntry*>>& OutClosest) const
+		{
+			OutClosest.clear();
+
+			if (Num <= 0 || MaxDistance < static_cast<CoordType>(0))
+			{
+				return;
+			}
+
+			const CoordType MaxDistanceSquared = MaxDistance * MaxDistance;
+			const auto IsCloser = [](const std::pair<CoordType, const FEntry*>& A, const std::pair<CoordType, const FEntry*>& B)
+			{
+				return A.first < B.first;
+			};
+
+			ForEachCellByRings(Point,
+				[&]()
+				{
+					return static_cast<int>(OutClosest.size()) == Num ?
+						std::min(OutClosest.front().first, MaxDistanceSquared) : MaxDistanceSquared;
+				},
+				[&](const CellType& Cell)
+				{
+					for (const FEntry& Entry : Cell)
+					{
+						const CoordType EntryDistanceSquared = DistanceSquared(Point, Entry.Location);
+						if (!(EntryDistanceSquared < MaxDistanceSquared))
+						{
+							continue;
+						}
+
+						if (static_cast<int>(OutClosest.size()) < Num)
+						{
+							OutClosest.emplace_back(EntryDistanceSquared, &Entry);
+							std::push_heap(OutClosest.begin(), OutClosest.end(), IsCloser);
+						}
+						else if (EntryDistanceSquared < OutClosest.front().first)
+						{
+							std::pop_heap(OutClosest.begin(), OutClosest.end(), IsCloser);
+							OutClosest.back() = { EntryDistanceSquared, &Entry };
+							std::push_heap(OutClosest.begin(), OutClosest.end(), IsCloser);
+						}
+					}
+				});
+
+			std::sort_heap(OutClosest.begin(), OutClosest.end(), IsCloser);
+		}
+
+	private:
+		FCell CellOf(const PointType& Location) const
+		{
+			return { ToCellIndex(Location.X), ToCellIndex(Location.Y), ToCellIndex(Location.Z) };
+		}
+
+		int ToCellIndex(const CoordType Coord) const
+		{
+			//NB: Clamped for huge and NaN coordinates
+			const double Index = std::floor(static_cast<double>(Coord) / static_cast<double>(CellSize));
+			const double Limit = static_cast<double>(std::numeric_limits<int>::max() / 2);
+			return Index >= -Limit && Index <= Limit ? static_cast<int>(Index) : (Index > 0 ? static_cast<int>(Limit) : -static_cast<int>(Limit));
+		}
+
+		static bool IsInBounds(const FCell& Cell, const FCell& Min, const FCell& Max)
+		{
+			return
+				Cell.X >= Min.X && Cell.X <= Max.X &&
+				Cell.Y >= Min.Y && Cell.Y <= Max.Y &&
+				Cell.Z >= Min.Z && Cell.Z <= Max.Z;
+		}
+
+		static int ChebyshevDistance(const FCell& A, const FCell& B)
+		{
+			return std::max(std::abs(A.X - B.X), std::max(std::abs(A.Y - B.Y), std::abs(A.Z - B.Z)));
+		}
+
+		// Calls "CheckCell(Cell)" for occupied cells by rings of growing size around cell of
+		// "Point" until no unchecked cell may contain entry closer than "GetBoundSquared()"
+		// (squared distance that is updated by checks)
+		template<typename GetBoundSquaredType, typename CheckCellType>
+		void ForEachCellByRings(const PointType& Point, const GetBoundSquaredType& GetBoundSquared, const CheckCellType& CheckCell) const
+		{
+			if (Cells.empty())
+			{
+				return;
+			}
+
+			const FCell Center = CellOf(Point);
+
+			for (int Ring = 0; ; ++Ring)
+			{
+				//NB: Cells of this and next rings are not closer than "(Ring - 1) * CellSize" to "Point"
+				const CoordType RingDistance = static_cast<CoordType>(std::max(Ring - 1, 0)) * CellSize;
+				if (RingDistance * RingDistance >= GetBoundSquared())
+				{
+					break;
+				}
+
+				const double RingCellsNum = 6.0 * (2.0 * Ring + 1.0) * (2.0 * Ring + 1.0);
+				if (RingCellsNum > static_cast<double>(Cells.size()))
+				{
+					// Ring is bigger than number of occupied cells: remaining cells are checked directly
+					for (const auto& Cell : Cells)
+					{
+						if (ChebyshevDistance(Cell.first, Center) >= Ring)
+						{
+							CheckCell(Cell.second);
+						}
+					}
+					break;
+				}
+
+				ForEachRingCell(Center, Ring, [&](const FCell& RingCell)
+				{
+					const auto Found = Cells.find(RingCell);
+					if (Found != Cells.end())
+					{
+						CheckCell(Found->second);
+					}
+				});
+			}
+		}
+
+		// Calls "Func(Cell)" for cells with Chebyshev distance "Ring" from "Center"
+		template<typename FuncType>
+		static void ForEachRingCell(const FCell& Center, const int Ring, const FuncType& Func)
+		{
+			for (int DX = -Ring; DX <= Ring; ++DX)
+			{
+				for (int DY = -Ring; DY <= Ring; ++DY)
+				{
+					const bool bOnSide = DX == -Ring || DX == Ring || DY == -Ring || DY == Ring;
+					const int DZStep = bOnSide || Ring == 0 ? 1 : 2 * Ring;
+
+					for (int DZ = -Ring; DZ <= Ring; DZ += DZStep)
+					{
+						Func(FCell{ Center.X + DX, Center.Y + DY, Center.Z + DZ });
+					}
+				}
+			}
+		}
+
+		void AddIfOccupied(const FCell& Cell, std::vector<const CellType*>& SelectedCells) const
+		{
+			const auto Found = Cells.find(Cell);
+			if (Found != Cells.end())
+			{
+				SelectedCells.push_back(&Found->second);
+			}
+		}
+
+		static FEntry* FindEntry(CellType& Cell, const ElementType& Element)
+		{
+			for (FEntry& Entry : Cell)
+			{
+				if (Entry.Element == Element)
+				{
+					return &Entry;
+				}
+			}
+			return nullptr;
+		}
+
+		//NB: Order of elements in cell is not kept - removed entry is replaced by the last one
+		void RemoveFromCell(const FCell& Cell, const ElementType& Element)
+		{
+			const auto Found = Cells.find(Cell);
+			CellType& Entries = Found->second;
+
+			FEntry* Entry = FindEntry(Entries, Element);
+			if (Entry != &Entries.back())
+			{
+				*Entry = std::move(Entries.back());
+			}
+			Entries.pop_back();
+
+			if (Entries.empty())
+			{
+				Cells.erase(Found);
+			}
+		}
+
+		CoordType CellSize;
+		std::unordered_map<FCell, CellType, FCellHash> Cells;
+		std::unordered_map<ElementType, FCell> ElementCells;
+	};
+
+}}} //namespace UnrealRanges::Private::Spatial
@@ -4,21 +4,33 @@
 
 #include <type_traits>//for "std::decay_t<>"
 #include <utility>//for "std::declval<>()"
-#include <memory>//for "std::shared_ptr<>()"
+#include <algorithm>//for "std::min<>()"
+#include <cstdint>//for "std::uint32_t" of index permutation
+#include <cstring>//for "std::memcpy()" of "ForceCopy()"
+#include <new>//for placement new
 
 namespace UnrealRanges{ namespace Private{ namespace Utils{
 
 	// =================================| Useful templates |=================================
 
+	//NB: Constness of "RangeType" is kept - iterator for non-const
+	// range allows mutating of range elements
 	template<typename RangeType>
 	using RangeIteratorType = std::decay_t<
 		decltype(
 			UnrealRanges::Utils::RangeBegin(
-				std::declval<const RangeType>()
+				std::declval<RangeType&>()
 			)
 		)
 	>;
-	
+
+	//Exact type of iterator dereferencing result (reference for
+	// iterators of collections, value for "on-fly" generated elements)
+	template<typename IteratorType>
+	using IteratorReferenceType = decltype(
+		*std::declval<const IteratorType&>()
+	);
+
 	template<typename Type>
 	using DereferencedType = std::decay_t<
 		decltype(
@@ -49,49 +61,15 @@ namespace UnrealRanges{ namespace Private{ namespace Utils{
 		TValueCapture_Ref(ValueType& InValueRef) : Ref(InValueRef) { }
 		TValueCapture_Ref(TValueCapture_Ref&&) = default; //Moving is ordinary use case
 		
-		//Copy is okay too - because "TValueCapture_Ref" is "shared" version for itself
-		// (See comments for "ConvertIntoShared()" for details)
+		//Copy is okay too - copies refer to the same value
 		TValueCapture_Ref(const TValueCapture_Ref&) = default;
 
 		ValueType& Get() const { return Ref; }
 
-		//NB: As "TValueCapture_Ref" is "reference wrapper" by it's nature,
-		// it may be used as shared version of itself, no need to perform
-		// full scale sharing.
-		// Because of referencing nature of the "TValueCapture_Ref",
-		// this method may be called for any referencing form of
-		// the "TValueCapture_Ref": for value, rvalues and lvalues.
-		TValueCapture_Ref ConvertIntoShared() const { return *this; }
-
 	private:
 		ValueType& Ref;
 	};	
 
-	template<typename ValueType>
-	class TValueCapture_SharedCopy
-	{
-	public:
-		//Shared Capture may be copy or moved, it is
-		// main purpose of this kind of Captures
-		TValueCapture_SharedCopy(TValueCapture_SharedCopy&&) = default;
-		TValueCapture_SharedCopy(const TValueCapture_SharedCopy&) = default;
-
-		const ValueType& Get() const { return *SharedPtr; }
-
-		//NB: "ConvertIntoShared()" should be never called because SharedCopy
-		// is always created ONLY from TValueCapture_Copy
-		//TValueCapture_Ref ConvertIntoShared() const
-
-	private:
-		//NB: May be created only from "TValueCapture_Copy"
-		template<typename ValueType_> friend class TValueCapture_Copy;
-		
-		TValueCapture_SharedCopy(ValueType&& InValue) :
-			SharedPtr(std::make_shared<ValueType>(std::move(InValue))) { }
-
-		std::shared_ptr<ValueType> SharedPtr;
-	};
-
 	template<typename ValueType>
 	class TValueCapture_Copy
 	{
@@ -102,9 +80,6 @@ namespace UnrealRanges{ namespace Private{ namespace Utils{
 
 			const ValueType& Get() const { return Copy; }
 
-			//May be called onlty
-			TValueCapture_SharedCopy<ValueType> ConvertIntoShared() && { return std::move(Copy); }
-
 		private:
 			ValueType Copy;
 	};
@@ -129,15 +104,29 @@ namespace UnrealRanges{ namespace Private{ namespace Utils{
 	{
 		namespace CapturedValueType
 		{
-			template<typename NotValueCapture> struct _                           {                  };
-			template<typename Type>            struct _<TValueCapture_Ref<Type>>  { using __ = Type; };
-			template<typename Type>            struct _<TValueCapture_Copy<Type>> { using __ = Type; };
+			template<typename NotValueCapture> struct _                                 {                  };
+			template<typename Type>            struct _<TValueCapture_Ref<Type>>        { using __ = Type; };
+			template<typename Type>            struct _<TValueCapture_Copy<Type>>       { using __ = Type; };
 		}
 	}
 
 	template<typename MaybeValueCapture>
 	using CapturedValueType = typename TemplateDetails::CapturedValueType::_<std::decay_t<MaybeValueCapture>>::__;
 
+	//Type of value as it is accessed through the capture: non-const for
+	// "TValueCapture_Ref" to non-const lvalue, const for owning captures
+	template<typename ValueCaptureType>
+	using CapturedAccessType = std::remove_reference_t<
+		decltype(
+			std::declval<const std::decay_t<ValueCaptureType>&>().Get()
+		)
+	>;
+
+	//Owning capture of one of the parts of splittable range (see "RangeSplit<>()")
+	template<typename RangeType>
+	using RangePartCaptureType = decltype(Capture(std::declval<
+		typename decltype(UnrealRanges::Utils::RangeSplit(std::declval<const RangeType&>(), 0))::value_type>()));
+
 	// =================| Optional for types without default cosntructor |===============
 
 	template<typename ValueType>
@@ -152,12 +141,39 @@ namespace UnrealRanges{ namespace Private{ namespace Utils{
 			Reset(std::forward<ConstructorArgTypes>(ConstructorArgs) ...);
 		}
 
+		//NB: Explicit copy/move constructors - to prevent catching of copying/moving
+		// by template constructor above
+		TOpaqueOptional(const TOpaqueOptional& Other)
+		{
+			if (Other.IsSet())
+			{
+				Reset(*Other);
+			}
+		}
+
+		TOpaqueOptional(TOpaqueOptional& Other)
+			: TOpaqueOptional(static_cast<const TOpaqueOptional&>(Other)) { }
+
+		TOpaqueOptional(TOpaqueOptional&& Other)
+		{
+			if (Other.IsSet())
+			{
+				Reset(std::move(*Other));
+			}
+		}
+
 		TOpaqueOptional& operator=(const TOpaqueOptional& Other) = delete;
 		TOpaqueOptional& operator=(TOpaqueOptional&& Other) = delete;
 
 		template<typename ... ConstructorArgTypes>
 		void Reset(ConstructorArgTypes&& ... ConstructorArgs)
 		{
+			if (ValueType* ValuePtrTmp = ObjectPtr())
+			{
+				ValuePtrTmp->~ValueType();
+				ValuePtr = nullptr;
+			}
+
 			ValuePtr = new (ValueMemoryPtr())ValueType{ std::forward<ConstructorArgTypes>(ConstructorArgs) ... };
 		}
 
@@ -220,6 +236,72 @@ namespace UnrealRanges{ namespace Private{ namespace Utils{
 		ValueType* ValuePtr = nullptr;
 	};
 
+	// ==================| Assignable holder for copy constructible types |==================
+
+	//NB: Lambdas are copy constructible but not assignable. Holder assigns value by
+	// destroying it and constructing a copy in place, so objects that store lambdas
+	// (like iterators of Ranges) may be assigned without bitwise copying
+	template<typename ValueType>
+	class TAssignableValue
+	{
+	public:
+		explicit TAssignableValue(const ValueType& InValue)
+		{
+			new (ValueMemory)ValueType(InValue);
+		}
+
+		TAssignableValue(const TAssignableValue& Other)
+			: TAssignableValue(Other.Get()) { }
+
+		TAssignableValue(TAssignableValue&& Other)
+		{
+			new (ValueMemory)ValueType(std::move(Other.Get()));
+		}
+
+		//NB: Copy is made before destroying of the current value - value is kept if
+		// copying throws
+		TAssignableValue& operator=(const TAssignableValue& Other)
+		{
+			if (this != &Other)
+			{
+				ValueType Copy{ Other.Get() };
+				Get().~ValueType();
+				new (ValueMemory)ValueType(std::move(Copy));
+			}
+
+			return *this;
+		}
+
+		TAssignableValue& operator=(TAssignableValue&& Other)
+		{
+			if (this != &Other)
+			{
+				Get().~ValueType();
+				new (ValueMemory)ValueType(std::move(Other.Get()));
+			}
+
+			return *this;
+		}
+
+		~TAssignableValue()
+		{
+			Get().~ValueType();
+		}
+
+		const ValueType& Get() const
+		{
+			return *reinterpret_cast<const ValueType*>(ValueMemory);
+		}
+
+		ValueType& Get()
+		{
+			return *reinterpret_cast<ValueType*>(ValueMemory);
+		}
+
+	private:
+		alignas(ValueType) unsigned char ValueMemory[sizeof(ValueType)];
+	};
+
 	// =======================================| ForceCopy |========================================
 
 	namespace TemplateDetails
@@ -242,7 +324,7 @@ namespace UnrealRanges{ namespace Private{ namespace Utils{
 			template<typename ValueType>
 			void _(ValueType& ValueTo, const ValueType& ValueFrom, ...)
 			{
-				memcpy(&ValueTo, &ValueFrom, sizeof(ValueType));
+				std::memcpy(&ValueTo, &ValueFrom, sizeof(ValueType));
 			}
 		}
 	}
@@ -292,6 +374,167 @@ namespace UnrealRanges{ namespace Private{ namespace Utils{
 		return TemplatesImpl::IsComparable::_<TypeA, TypeB>(0);
 	}
 
+	namespace TemplatesImpl
+	{
+		namespace IsRandomAccessIterator
+		{
+			template<typename IteratorType>
+			constexpr auto _(int)->decltype(
+				std::declval<IteratorType&>() += 1,
+				std::declval<IteratorType&>() -= 1,
+				std::declval<const IteratorType&>() - std::declval<const IteratorType&>(),
+				true)
+			{
+				return true;
+			}
+
+			template<typename IteratorType>
+			constexpr auto _(...)->decltype(false)
+			{
+				return false;
+			}
+		}
+	}
+
+	//NB: Only operations used by this library are checked: "+=", "-=" and difference
+	template<typename IteratorType>
+	constexpr bool IsRandomAccessIterator()
+	{
+		return TemplatesImpl::IsRandomAccessIterator::_<IteratorType>(0);
+	}
+
+	// =================================| Iterator advancing |==================================
+
+	namespace TemplateDetails
+	{
+		namespace AdvanceIterator
+		{
+			template<typename IteratorType>
+			auto _(IteratorType& Current, const IteratorType& End, const int Num, int)->
+				decltype(Current += Num, static_cast<int>(End - Current))
+			{
+				const int Advanced = std::min(Num, static_cast<int>(End - Current));
+				Current += Advanced;
+				return Advanced;
+			}
+
+			template<typename IteratorType>
+			int _(IteratorType& Current, const IteratorType& End, const int Num, ...)
+			{
+				int Advanced = 0;
+				for (; Advanced < Num && Current != End; ++Current, ++Advanced);
+				return Advanced;
+			}
+		}
+	}
+
+	//Moves "Current" forward by "Num" elements, but not further then "End". Constant time
+	// for random access iterators. Returns number of elements "Current" was moved by
+	template<typename IteratorType>
+	int AdvanceIterator(IteratorType& Current, const IteratorType& End, const int Num)
+	{
+		return TemplateDetails::AdvanceIterator::_(Current, End, Num, 0);
+	}
+
+	// ================================| Distance queries |=====================================
+
+	// "true" if squared distance passes distance query condition. "DistanceToCheck" is
+	// clamped to be non-negative, so comparing of squared values is same as comparing
+	// of distances
+	template<UnrealRanges::Utils::Logic::EDistanceQueryPredicate DistanceQueryPredicate, typename DistanceType>
+	bool IsPassedByDistanceSquared(const DistanceType DistanceSquared, const DistanceType DistanceToCheckSquared)
+	{
+		static_assert(
+			DistanceQueryPredicate == UnrealRanges::Utils::Logic::Close || DistanceQueryPredicate == UnrealRanges::Utils::Logic::Far,
+			"Invalid DistanceQueryPredicate template argument value passed");
+
+		return DistanceQueryPredicate == UnrealRanges::Utils::Logic::Close ?
+			DistanceSquared < DistanceToCheckSquared :
+			DistanceSquared > DistanceToCheckSquared;
+	}
+
+	template<typename DistanceType>
+	DistanceType ClampedDistanceSquared(const DistanceType Distance)
+	{
+		const DistanceType ClampedDistance = std::max(Distance, static_cast<DistanceType>(0));
+		return ClampedDistance * ClampedDistance;
+	}
+
+	// ================================| Index permutation |=====================================
+
+	// Pseudo-random bijection of "[0, Num)" indices got by seed. Balanced Feistel network
+	// permutes indices of power of four sized domain that is not bigger than "4 * Num",
+	// indices out of "[0, Num)" are permuted again ("cycle walking") until they get in it.
+	// No memory depends on "Num", each index is mapped in constant expected time
+	class FIndexPermutation
+	{
+	public:
+		FIndexPermutation(const int InNum, const std::uint32_t Seed)
+			: Num(std::max(InNum, 0)), HalfBits(1)
+		{
+			while (HalfBits < 16 && (std::uint64_t{ 1 } << (2 * HalfBits)) < static_cast<std::uint64_t>(Num))
+			{
+				++HalfBits;
+			}
+			HalfMask = (std::uint32_t{ 1 } << HalfBits) - 1;
+
+			std::uint32_t State = Seed;
+			for (std::uint32_t& Key : Keys)
+			{
+				State += 0x9E3779B9u;
+				Key = Mix(State);
+			}
+		}
+
+		int GetNum() const
+		{
+			return Num;
+		}
+
+		int operator()(const int Index) const
+		{
+			std::uint32_t Permuted = static_cast<std::uint32_t>(Index);
+			do
+			{
+				Permuted = Permute(Permuted);
+			}
+			while (Permuted >= static_cast<std::uint32_t>(Num));
+
+			return static_cast<int>(Permuted);
+		}
+
+	private:
+		static std::uint32_t Mix(std::uint32_t Value)
+		{
+			Value ^= Value >> 16;
+			Value *= 0x85EBCA6Bu;
+			Value ^= Value >> 13;
+			Value *= 0xC2B2AE35u;
+			Value ^= Value >> 16;
+			return Value;
+		}
+
+		std::uint32_t Permute(const std::uint32_t Value) const
+		{
+			std::uint32_t Left = Value >> HalfBits;
+			std::uint32_t Right = Value & HalfMask;
+
+			for (const std::uint32_t Key : Keys)
+			{
+				const std::uint32_t NewRight = Left ^ (Mix(Right ^ Key) & HalfMask);
+				Left = Right;
+				Right = NewRight;
+			}
+
+			return (Left << HalfBits) | Right;
+		}
+
+		int Num;
+		int HalfBits;
+		std::uint32_t HalfMask;
+		std::uint32_t Keys[4];
+	};
+
 	// =============================| Common compile time checks |==============================
 
 	template<typename TypeFF, typename Type>
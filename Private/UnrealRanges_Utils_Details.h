@@ -1,3 +1,9 @@
+#include <algorithm>//for "std::min()"
+#include <cstddef>//for "std::size_t"
+#include <utility>//for "std::declval<>()"
+#include <type_traits>//for "std::remove_cv_t<>"
+#include <vector>//for "std::vector<>"
+
 
 // =================== Universal Begin/End =====================
 
@@ -8,13 +14,13 @@ namespace UnrealRanges{ namespace Utils{
 		namespace RangeBegin
 		{
 			template<typename RangeType>
-			auto _(const RangeType& Range, int)->decltype(Range.begin())
+			auto _(RangeType& Range, int)->decltype(Range.begin())
 			{
 				return Range.begin();
 			}
 
 			template<typename RangeType>
-			auto _(const RangeType& Range, ...)->decltype(begin(Range))
+			auto _(RangeType& Range, ...)->decltype(begin(Range))
 			{
 				return begin(Range);
 			}
@@ -23,18 +29,281 @@ namespace UnrealRanges{ namespace Utils{
 		namespace RangeEnd
 		{
 			template<typename RangeType>
-			auto _(const RangeType& Range, int)->decltype(Range.end())
+			auto _(RangeType& Range, int)->decltype(Range.end())
 			{
 				return Range.end();
 			}
 
 			template<typename RangeType>
-			auto _(const RangeType& Range, ...)->decltype(end(Range))
+			auto _(RangeType& Range, ...)->decltype(end(Range))
 			{
 				return end(Range);
 			}
 		}
 
+		// =================== Universal Size =====================
+
+		namespace RangeSizeOfCollection
+		{
+			//Std collections
+			template<typename RangeType>
+			auto _(const RangeType& Range, int)->decltype(static_cast<int>(Range.size()))
+			{
+				return static_cast<int>(Range.size());
+			}
+
+			//Unreal collections
+			template<typename RangeType>
+			auto _(const RangeType& Range, ...)->decltype(static_cast<int>(Range.Num()))
+			{
+				return static_cast<int>(Range.Num());
+			}
+		}
+
+		namespace RangeSize
+		{
+			//Ranges of this library that know their size
+			template<typename RangeType>
+			auto _(const RangeType& Range, int)->decltype(static_cast<int>(Range.Size()))
+			{
+				return static_cast<int>(Range.Size());
+			}
+
+			template<typename ElementType, decltype(sizeof(int)) ElementsNum>
+			int _(const ElementType(&Range)[ElementsNum], int)
+			{
+				return static_cast<int>(ElementsNum);
+			}
+
+			template<typename RangeType>
+			auto _(const RangeType& Range, ...)->decltype(RangeSizeOfCollection::_(Range, 0))
+			{
+				return RangeSizeOfCollection::_(Range, 0);
+			}
+		}
+
+		namespace RangeMaxSize
+		{
+			//NB: Exact size is prefered as the most precise upper bound
+			template<typename RangeType>
+			auto _(const RangeType& Range, int)->decltype(RangeSize::_(Range, 0))
+			{
+				return RangeSize::_(Range, 0);
+			}
+
+			template<typename RangeType>
+			auto _(const RangeType& Range, ...)->decltype(static_cast<int>(Range.MaxSize()))
+			{
+				return static_cast<int>(Range.MaxSize());
+			}
+		}
+
+		// =================== Range splitting =====================
+
+		namespace RangeSplit
+		{
+			template<typename RangeType>
+			using IteratorType = decltype(RangeBegin::_(std::declval<const RangeType&>(), 0));
+
+			// Iterates elements of hash container buckets "[Bucket, EndBucket)"
+			template<typename ContainerType>
+			class TBucketsIterator
+			{
+			public:
+				using LocalIteratorType = decltype(std::declval<const ContainerType&>().begin(std::size_t{ }));
+
+				TBucketsIterator(const ContainerType& InContainer, const std::size_t InBucket, const std::size_t InEndBucket)
+					:
+					Container(&InContainer), Bucket(InBucket), EndBucket(InEndBucket), Current()
+				{
+					if (Bucket < EndBucket)
+					{
+						Current = Container->begin(Bucket);
+						SkipEmptyBuckets();
+					}
+				}
+
+				decltype(auto) operator*() const
+				{
+					return *Current;
+				}
+
+				void operator++()
+				{
+					++Current;
+					SkipEmptyBuckets();
+				}
+
+				bool operator!=(const TBucketsIterator& Other) const
+				{
+					return Bucket != Other.Bucket || (Bucket < EndBucket && Current != Other.Current);
+				}
+
+			private:
+				void SkipEmptyBuckets()
+				{
+					while (!(Current != Container->end(Bucket)))
+					{
+						if (++Bucket == EndBucket)
+						{
+							return;
+						}
+
+						Current = Container->begin(Bucket);
+					}
+				}
+
+				const ContainerType* Container;
+				std::size_t Bucket;
+				std::size_t EndBucket;
+				LocalIteratorType Current;
+			};
+
+			//Ranges that split themselves (see "Split()" methods of ranges in "UnrealRanges_Basics.h")
+			template<typename RangeType>
+			auto _(const RangeType& Range, int PartsNum, int, int)->decltype(Range.Split(PartsNum))
+			{
+				return Range.Split(PartsNum);
+			}
+
+			//Sized ranges with random access iterators: parts are got in constant time
+			template<typename RangeType>
+			auto _(const RangeType& Range, int PartsNum, int, ...)->decltype(
+				RangeSize::_(Range, 0),
+				void(std::declval<IteratorType<RangeType>&>() += 1),
+				void(std::declval<IteratorType<RangeType>>() - std::declval<IteratorType<RangeType>>()),
+				std::vector<TRangePart<IteratorType<RangeType>>>{ })
+			{
+				const long long ElementsNum = RangeSize::_(Range, 0);
+				const int ResultPartsNum = static_cast<int>(std::min<long long>(std::max(PartsNum, 1), ElementsNum));
+
+				std::vector<TRangePart<IteratorType<RangeType>>> Parts;
+				Parts.reserve(ResultPartsNum);
+
+				for (int PartIndex = 0; PartIndex < ResultPartsNum; ++PartIndex)
+				{
+					IteratorType<RangeType> PartBegin = RangeBegin::_(Range, 0);
+					PartBegin += static_cast<int>(ElementsNum * PartIndex / ResultPartsNum);
+
+					IteratorType<RangeType> PartEnd = RangeBegin::_(Range, 0);
+					PartEnd += static_cast<int>(ElementsNum * (PartIndex + 1) / ResultPartsNum);
+
+					Parts.emplace_back(std::move(PartBegin), std::move(PartEnd));
+				}
+
+				return Parts;
+			}
+
+			//Hash containers with buckets interface (like "std::unordered_map"): parts are
+			// groups of neighbour buckets
+			template<typename RangeType>
+			auto _(const RangeType& Range, int PartsNum, ...)->decltype(
+				Range.begin(Range.bucket_count()),
+				std::vector<TRangePart<TBucketsIterator<RangeType>>>{ })
+			{
+				const std::size_t BucketsNum = Range.empty() ? 0 : Range.bucket_count();
+				const std::size_t ResultPartsNum = std::min(static_cast<std::size_t>(std::max(PartsNum, 1)), BucketsNum);
+
+				std::vector<TRangePart<TBucketsIterator<RangeType>>> Parts;
+				Parts.reserve(ResultPartsNum);
+
+				for (std::size_t PartIndex = 0; PartIndex < ResultPartsNum; ++PartIndex)
+				{
+					const std::size_t PartBeginBucket = BucketsNum * PartIndex / ResultPartsNum;
+					const std::size_t PartEndBucket = BucketsNum * (PartIndex + 1) / ResultPartsNum;
+
+					Parts.emplace_back(
+						TBucketsIterator<RangeType>{ Range, PartBeginBucket, PartEndBucket },
+						TBucketsIterator<RangeType>{ Range, PartEndBucket, PartEndBucket });
+				}
+
+				return Parts;
+			}
+		}
+
+		namespace IsOrderedSplitRange
+		{
+			template<typename RangeType>
+			using PartType = typename decltype(RangeSplit::_(std::declval<const RangeType&>(), 1, 0, 0))::value_type;
+
+			//Parts of Ranges with custom "Split()" are expected to follow Range order
+			constexpr bool IsOrderedPart(const void*, ...)
+			{
+				return true;
+			}
+
+			//Groups of hash container buckets
+			template<typename ContainerType>
+			constexpr bool IsOrderedPart(const TRangePart<RangeSplit::TBucketsIterator<ContainerType>>*, int)
+			{
+				return false;
+			}
+
+			//Ranges of this library split their Parent Range, so they are ordered as its parts
+			template<typename RangePartType>
+			constexpr auto IsOrderedPart(const RangePartType*, int)->decltype(
+				std::declval<typename RangePartType::ParentRangeType*>(), true)
+			{
+				return IsOrderedPart(static_cast<const std::remove_cv_t<typename RangePartType::ParentRangeType>*>(nullptr), 0);
+			}
+
+			template<typename RangeType>
+			constexpr auto _(int)->decltype(std::declval<PartType<RangeType>*>(), true)
+			{
+				return IsOrderedPart(static_cast<const PartType<RangeType>*>(nullptr), 0);
+			}
+
+			template<typename RangeType>
+			constexpr bool _(...)
+			{
+				return false;
+			}
+		}
+
+		// =================== Range visiting =====================
+
+		namespace RangeVisit
+		{
+			//Ranges that choose used range in runtime (see "Visit()" of "ConditionalRange()")
+			template<typename RangeType, typename FuncType>
+			auto _(RangeType& Range, FuncType& Func, int)->decltype(Range.Visit(Func))
+			{
+				return Range.Visit(Func);
+			}
+
+			template<typename RangeType, typename FuncType>
+			decltype(auto) _(RangeType& Range, FuncType& Func, ...)
+			{
+				return Func(Range);
+			}
+		}
+
+		// =================== Range internal iteration =====================
+
+		namespace RangeForEachWhile
+		{
+			//Ranges that push elements themselves (see "ForEachWhile()" of "TBasicRange<>")
+			template<typename RangeType, typename FuncType>
+			auto _(const RangeType& Range, const FuncType& Func, int)->decltype(static_cast<bool>(Range.ForEachWhile(Func)))
+			{
+				return Range.ForEachWhile(Func);
+			}
+
+			template<typename RangeType, typename FuncType>
+			bool _(const RangeType& Range, const FuncType& Func, ...)
+			{
+				for (auto&& Element : Range)
+				{
+					if (!Func(std::forward<decltype(Element)>(Element)))
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+		}
+
 	}
 
 }} //namespace UnrealRanges::Utils
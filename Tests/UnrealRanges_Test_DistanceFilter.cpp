@@ -0,0 +1,147 @@
+// Checks batched distance filtering ("ForEachByDistance<>()" and its SIMD kernel
+// "FilterByDistanceSquared<>()") against scalar computation
+
+#include "UnrealRanges_Test_StandIn.h"
+#include "../UnrealRanges_CommonNoUsing.h"
+
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	int FailuresNum = 0;
+
+	void Check(const bool bCondition, const char* Description)
+	{
+		if (!bCondition)
+		{
+			std::printf("FAILED: %s\n", Description);
+			++FailuresNum;
+		}
+	}
+
+	template<typename CoordType>
+	CoordType DistanceSquared(const CoordType X, const CoordType Y, const CoordType Z,
+		const CoordType PointX, const CoordType PointY, const CoordType PointZ)
+	{
+		const CoordType DX = X - PointX;
+		const CoordType DY = Y - PointY;
+		const CoordType DZ = Z - PointZ;
+		return DX * DX + DY * DY + DZ * DZ;
+	}
+
+	// Numbers of points are chosen to check tails that are not multiple of SIMD lanes
+	template<bool bClose, typename CoordType>
+	void CheckKernel(std::mt19937& Random)
+	{
+		std::uniform_real_distribution<CoordType> Coordinate{ CoordType(-100), CoordType(100) };
+
+		for (const int Num : { 0, 1, 3, 4, 7, 8, 9, 15, 16, 17, 100, 256 })
+		{
+			std::vector<CoordType> X(Num), Y(Num), Z(Num);
+			for (int Index = 0; Index < Num; ++Index)
+			{
+				X[Index] = Coordinate(Random);
+				Y[Index] = Coordinate(Random);
+				Z[Index] = Coordinate(Random);
+			}
+
+			const CoordType PointX = Coordinate(Random);
+			const CoordType PointY = Coordinate(Random);
+			const CoordType PointZ = Coordinate(Random);
+			const CoordType RadiusSquared = CoordType(100 * 100);
+
+			std::vector<CoordType> DistancesSquared(Num);
+			std::vector<int> PassedIndices(Num);
+			const int PassedNum = UnrealRanges::Private::Simd::FilterByDistanceSquared<bClose>(
+				X.data(), Y.data(), Z.data(), Num, PointX, PointY, PointZ, RadiusSquared,
+				DistancesSquared.data(), PassedIndices.data());
+
+			std::vector<int> ExpectedIndices;
+			bool bDistancesEqual = true;
+			for (int Index = 0; Index < Num; ++Index)
+			{
+				const CoordType Expected = DistanceSquared(X[Index], Y[Index], Z[Index], PointX, PointY, PointZ);
+				bDistancesEqual = bDistancesEqual && DistancesSquared[Index] == Expected;
+
+				if (bClose ? Expected < RadiusSquared : Expected > RadiusSquared)
+				{
+					ExpectedIndices.push_back(Index);
+				}
+			}
+
+			Check(bDistancesEqual, "Kernel squared distances are same as scalar ones");
+			Check(std::vector<int>(PassedIndices.begin(), PassedIndices.begin() + PassedNum) == ExpectedIndices,
+				"Kernel passed indices are same as scalar ones");
+		}
+	}
+
+	template<UnrealRanges::Utils::Logic::EDistanceQueryPredicate DistanceQueryPredicate>
+	void CheckForEachByDistance(const std::vector<AActor>& Actors, const FVector& Point, const double Distance)
+	{
+		constexpr bool bClose = DistanceQueryPredicate == UnrealRanges::Utils::Logic::Close;
+
+		std::vector<const AActor*> ActorPointers;
+		for (const AActor& Actor : Actors)
+		{
+			ActorPointers.push_back(&Actor);
+		}
+
+		std::vector<std::pair<const AActor*, double>> Passed;
+		UnrealRanges::Algorithm::ForEachByDistance<DistanceQueryPredicate>(ActorPointers, Point, Distance,
+			[](const AActor* Actor)
+			{
+				return Actor->GetActorLocation();
+			},
+			[&Passed](const AActor* Actor, const double ActorDistanceSquared)
+			{
+				Passed.emplace_back(Actor, ActorDistanceSquared);
+			});
+
+		std::vector<std::pair<const AActor*, double>> Expected;
+		for (const AActor* Actor : ActorPointers)
+		{
+			const FVector Location = Actor->GetActorLocation();
+			const double ActorDistanceSquared = DistanceSquared(Location.X, Location.Y, Location.Z, Point.X, Point.Y, Point.Z);
+
+			if (bClose ? ActorDistanceSquared < Distance * Distance : ActorDistanceSquared > Distance * Distance)
+			{
+				Expected.emplace_back(Actor, ActorDistanceSquared);
+			}
+		}
+
+		Check(Passed == Expected, "ForEachByDistance passes same Actors in same order as scalar filtering");
+	}
+}
+
+int main()
+{
+	std::mt19937 Random{ 42 };
+
+	CheckKernel<true, float>(Random);
+	CheckKernel<false, float>(Random);
+	CheckKernel<true, double>(Random);
+	CheckKernel<false, double>(Random);
+
+	//NB: More Actors than one block of "ForEachByDistance<>()"
+	std::uniform_real_distribution<double> Coordinate{ -1000.0, 1000.0 };
+	std::vector<AActor> Actors;
+	for (int Index = 0; Index < 1000; ++Index)
+	{
+		Actors.emplace_back(FVector{ Coordinate(Random), Coordinate(Random), Coordinate(Random) });
+	}
+
+	const FVector Point{ 10.0, -20.0, 30.0 };
+	CheckForEachByDistance<UnrealRanges::Utils::Logic::Close>(Actors, Point, 700.0);
+	CheckForEachByDistance<UnrealRanges::Utils::Logic::Far>(Actors, Point, 700.0);
+	CheckForEachByDistance<UnrealRanges::Utils::Logic::Close>(Actors, Point, -1.0);
+
+	if (FailuresNum == 0)
+	{
+		std::printf("OK\n");
+	}
+
+	return FailuresNum == 0 ? 0 : 1;
+}
@@ -0,0 +1,133 @@
+// Benchmark of functor calls per element for "FilteredAndTransformedRange()": functor is
+// called once for each Parent Range element whichever way the Range is iterated (iterators
+// with repeated dereferencing, internal iteration of algorithms, nested pipelines)
+
+#include "UnrealRanges_Test_StandIn.h"
+#include "../UnrealRanges_CommonNoUsing.h"
+
+#include <cstdio>
+#include <list>
+#include <vector>
+
+namespace
+{
+	int FailuresNum = 0;
+
+	void Check(const bool bCondition, const char* Description)
+	{
+		if (!bCondition)
+		{
+			std::printf("FAILED: %s\n", Description);
+			++FailuresNum;
+		}
+	}
+
+	int CallsNum = 0;
+
+	// Passes even values and halves them
+	UnrealRanges::Utils::TUnrealRanges_Optional<int> HalfOfEven(const int Value)
+	{
+		++CallsNum;
+		return UnrealRanges::Utils::MakeOptional(Value % 2 == 0, Value / 2);
+	}
+
+	template<typename IterateType>
+	int CountCalls(const IterateType& Iterate)
+	{
+		CallsNum = 0;
+		Iterate();
+		return CallsNum;
+	}
+
+	void Report(const char* Case, const int ElementsNum, const int FunctorCallsNum)
+	{
+		std::printf("%-40s calls per element: %.2f\n", Case, static_cast<float>(FunctorCallsNum) / ElementsNum);
+	}
+
+	constexpr int ElementsNum = 1000;
+}
+
+int main()
+{
+	std::vector<int> Values;
+	for (int Index = 0; Index < ElementsNum; ++Index)
+	{
+		Values.push_back(Index);
+	}
+
+	const std::list<int> ValuesList{ Values.begin(), Values.end() };
+
+	// Iterators with repeated dereferencing of each element
+	{
+		int Sum = 0;
+		const int Calls = CountCalls([&Values, &Sum]()
+			{
+				auto Range = Values | UnrealRanges::FilteredAndTransformedRange(&HalfOfEven);
+				for (auto It = UnrealRanges::Utils::RangeBegin(Range); It != UnrealRanges::Utils::RangeEnd(Range); ++It)
+				{
+					Sum += *It;
+					Sum += *It;
+				}
+			});
+
+		Report("iterators, dereferenced twice", ElementsNum, Calls);
+		Check(Calls == ElementsNum, "Functor is called once per element by iterators");
+
+		int ExpectedSum = 0;
+		for (const int Value : Values)
+		{
+			ExpectedSum += Value % 2 == 0 ? 2 * (Value / 2) : 0;
+		}
+
+		Check(Sum == ExpectedSum, "Elements are transformed");
+	}
+
+	// Internal iteration of algorithms
+	{
+		const int Calls = CountCalls([&ValuesList]()
+			{
+				const std::vector<int> Result = UnrealRanges::Algorithm::RangeToVector(
+					ValuesList | UnrealRanges::FilteredAndTransformedRange(&HalfOfEven));
+				Check(static_cast<int>(Result.size()) == ElementsNum / 2, "Passed elements are collected");
+			});
+
+		Report("RangeToVector", ElementsNum, Calls);
+		Check(Calls == ElementsNum, "Functor is called once per element by algorithms");
+	}
+
+	{
+		const int Calls = CountCalls([&Values]()
+			{
+				UnrealRanges::Algorithm::Contains(Values | UnrealRanges::FilteredAndTransformedRange(&HalfOfEven), -1);
+			});
+
+		Report("Contains (not found)", ElementsNum, Calls);
+		Check(Calls == ElementsNum, "Functor is called once per element by search");
+	}
+
+	// Nested pipeline: elements of inner Range are transformed again
+	{
+		auto Twice = [](const int Value) { return Value * 2; };
+
+		const int Calls = CountCalls([&Values, &Twice]()
+			{
+				int Num = 0;
+				for (const int Value : Values | UnrealRanges::FilteredAndTransformedRange(&HalfOfEven) | UnrealRanges::TransformedRange(Twice))
+				{
+					Num += Value >= 0 ? 1 : 0;
+				}
+
+				Check(Num == ElementsNum / 2, "Nested pipeline passes all elements");
+			});
+
+		Report("FilteredAndTransformed | Transformed", ElementsNum, Calls);
+		Check(Calls == ElementsNum, "Functor is called once per element in nested pipeline");
+	}
+
+	if (FailuresNum == 0)
+	{
+		std::printf("OK\n");
+	}
+
+	return FailuresNum == 0 ? 0 : 1;
+}
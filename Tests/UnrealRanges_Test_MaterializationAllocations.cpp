@@ -0,0 +1,339 @@
+// Benchmark of allocations per materialization ("RangeToVector<>()", "RangeToCollection<>()")
+// compared with filling collections by "push_back()"/"insert()" loop. Allocations are counted
+// by allocator of the collections, copies - by element type. Results are printed and expected
+// numbers of allocations for sized Ranges are checked
+
+#include "UnrealRanges_Test_StandIn.h"
+#include "../UnrealRanges_CommonNoUsing.h"
+
+#include <cstddef>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+	int FailuresNum = 0;
+
+	void Check(const bool bCondition, const char* Description)
+	{
+		if (!bCondition)
+		{
+			std::printf("FAILED: %s\n", Description);
+			++FailuresNum;
+		}
+	}
+
+	int AllocationsNum = 0;
+
+	template<typename ValueType>
+	struct TCountingAllocator
+	{
+		using value_type = ValueType;
+
+		TCountingAllocator() = default;
+
+		template<typename OtherValueType>
+		TCountingAllocator(const TCountingAllocator<OtherValueType>&) { }
+
+		ValueType* allocate(const std::size_t Num)
+		{
+			++AllocationsNum;
+			return std::allocator<ValueType>{ }.allocate(Num);
+		}
+
+		void deallocate(ValueType* Pointer, const std::size_t Num)
+		{
+			std::allocator<ValueType>{ }.deallocate(Pointer, Num);
+		}
+
+		template<typename OtherValueType>
+		bool operator==(const TCountingAllocator<OtherValueType>&) const { return true; }
+
+		template<typename OtherValueType>
+		bool operator!=(const TCountingAllocator<OtherValueType>&) const { return false; }
+	};
+
+	int CopiesNum = 0;
+
+	struct FTracked
+	{
+		explicit FTracked(const int InValue) : Value(InValue) { }
+
+		FTracked(const FTracked& Other) : Value(Other.Value) { ++CopiesNum; }
+		FTracked(FTracked&& Other) noexcept : Value(Other.Value) { }
+
+		FTracked& operator=(const FTracked& Other) { Value = Other.Value; ++CopiesNum; return *this; }
+		FTracked& operator=(FTracked&& Other) noexcept { Value = Other.Value; return *this; }
+
+		int Value = 0;
+	};
+
+	template<typename FillType>
+	int CountAllocations(const FillType& Fill)
+	{
+		AllocationsNum = 0;
+		Fill();
+		return AllocationsNum;
+	}
+
+	void Report(const char* Case, const int LoopAllocationsNum, const int RangeAllocationsNum)
+	{
+		std::printf("%-40s loop: %5d   range: %5d\n", Case, LoopAllocationsNum, RangeAllocationsNum);
+	}
+
+	template<typename ValueType>
+	using TCountedVector = std::vector<ValueType, TCountingAllocator<ValueType>>;
+
+	template<typename ValueType>
+	using TCountedDeque = std::deque<ValueType, TCountingAllocator<ValueType>>;
+
+	template<typename ValueType>
+	using TCountedSet = std::unordered_set<ValueType, std::hash<ValueType>, std::equal_to<ValueType>,
+		TCountingAllocator<ValueType>>;
+
+	constexpr int ElementsNum = 1000;
+}
+
+int main()
+{
+	std::vector<int> Values;
+	for (int Index = 0; Index < ElementsNum; ++Index)
+	{
+		Values.push_back(Index);
+	}
+
+	const std::list<int> ValuesList{ Values.begin(), Values.end() };
+
+	auto IsEven = [](const int Value) { return Value % 2 == 0; };
+	auto MakeTracked = [](const int Value) { return FTracked{ Value }; };
+
+	// Sized Range: single allocation of exact size
+	{
+		const int LoopNum = CountAllocations([&Values]()
+			{
+				TCountedVector<int> Result;
+				for (const int Value : Values)
+				{
+					Result.push_back(Value);
+				}
+			});
+
+		const int RangeNum = CountAllocations([&Values]()
+			{
+				const auto Result = UnrealRanges::Algorithm::RangeToVector<TCountingAllocator<int>>(Values);
+				Check(static_cast<int>(Result.size()) == ElementsNum, "Vector from vector has all elements");
+			});
+
+		Report("vector <- vector", LoopNum, RangeNum);
+		Check(RangeNum == 1, "Vector from sized Range is allocated once");
+	}
+
+	// Not random access sized Range
+	{
+		const int LoopNum = CountAllocations([&ValuesList]()
+			{
+				TCountedVector<int> Result;
+				for (const int Value : ValuesList)
+				{
+					Result.push_back(Value);
+				}
+			});
+
+		const int RangeNum = CountAllocations([&ValuesList]()
+			{
+				UnrealRanges::Algorithm::RangeToVector<TCountingAllocator<int>>(ValuesList);
+			});
+
+		Report("vector <- list", LoopNum, RangeNum);
+		Check(RangeNum == 1, "Vector from list is allocated once");
+	}
+
+	// Filtered Range: single allocation of upper bound of size
+	{
+		const int LoopNum = CountAllocations([&Values, &IsEven]()
+			{
+				TCountedVector<int> Result;
+				for (const int Value : Values)
+				{
+					if (IsEven(Value))
+					{
+						Result.push_back(Value);
+					}
+				}
+			});
+
+		const int RangeNum = CountAllocations([&Values, &IsEven]()
+			{
+				const auto Result = UnrealRanges::Algorithm::RangeToVector<TCountingAllocator<int>>(
+					Values | UnrealRanges::FilteredRange(IsEven));
+				Check(static_cast<int>(Result.size()) == ElementsNum / 2, "Vector from filtered Range has passed elements");
+			});
+
+		Report("vector <- vector | Filtered", LoopNum, RangeNum);
+		Check(RangeNum == 1, "Vector from filtered Range is allocated once");
+	}
+
+	// Range of unknown size: collection grows as for the loop
+	{
+		const std::vector<std::vector<int>> Groups(ElementsNum / 10, std::vector<int>(10, 0));
+		auto GetGroup = [](const std::vector<int>& Group) -> const std::vector<int>& { return Group; };
+
+		const int LoopNum = CountAllocations([&Groups]()
+			{
+				TCountedVector<int> Result;
+				for (const std::vector<int>& Group : Groups)
+				{
+					for (const int Value : Group)
+					{
+						Result.push_back(Value);
+					}
+				}
+			});
+
+		const int RangeNum = CountAllocations([&Groups, &GetGroup]()
+			{
+				UnrealRanges::Algorithm::RangeToVector<TCountingAllocator<int>>(
+					Groups | UnrealRanges::StepIntoRange(GetGroup));
+			});
+
+		Report("vector <- vector | StepInto", LoopNum, RangeNum);
+		Check(RangeNum <= LoopNum, "Vector from Range of unknown size is not allocated more than by loop");
+	}
+
+	// Elements returned by value are moved
+	{
+		const int LoopNum = CountAllocations([&Values, &MakeTracked]()
+			{
+				TCountedVector<FTracked> Result;
+				for (const int Value : Values)
+				{
+					Result.push_back(MakeTracked(Value));
+				}
+			});
+
+		CopiesNum = 0;
+		const int RangeNum = CountAllocations([&Values, &MakeTracked]()
+			{
+				UnrealRanges::Algorithm::RangeToVector<TCountingAllocator<FTracked>>(
+					Values | UnrealRanges::TransformedRange(MakeTracked));
+			});
+
+		Report("vector <- vector | Transformed", LoopNum, RangeNum);
+		std::printf("%-40s copies: %d\n", "vector <- vector | Transformed", CopiesNum);
+		Check(RangeNum == 1, "Vector from transformed Range is allocated once");
+		Check(CopiesNum == 0, "Elements returned by value are not copied");
+	}
+
+	// Repeated adding of few elements: collection grows geometrically, as for the loop
+	{
+		const std::vector<int> Group(10, 0);
+
+		const int LoopNum = CountAllocations([&Group]()
+			{
+				TCountedVector<int> Result;
+				for (int GroupIndex = 0; GroupIndex < ElementsNum / 10; ++GroupIndex)
+				{
+					for (const int Value : Group)
+					{
+						Result.push_back(Value);
+					}
+				}
+			});
+
+		const int RangeNum = CountAllocations([&Group]()
+			{
+				TCountedVector<int> Result;
+				for (int GroupIndex = 0; GroupIndex < ElementsNum / 10; ++GroupIndex)
+				{
+					UnrealRanges::Algorithm::AddAllFromRange(Result, Group);
+				}
+				Check(static_cast<int>(Result.size()) == ElementsNum, "Vector has all added elements");
+			});
+
+		Report("vector += vector (repeated)", LoopNum, RangeNum);
+		Check(RangeNum <= LoopNum, "Repeated adding to vector is not allocated more than by loop");
+	}
+
+	{
+		const int LoopNum = CountAllocations([&Values]()
+			{
+				TCountedSet<int> Result;
+				for (const int Value : Values)
+				{
+					Result.insert(Value);
+				}
+			});
+
+		std::vector<std::vector<int>> Groups;
+		for (int GroupBegin = 0; GroupBegin < ElementsNum; GroupBegin += 10)
+		{
+			Groups.emplace_back(Values.begin() + GroupBegin, Values.begin() + GroupBegin + 10);
+		}
+
+		const int RangeNum = CountAllocations([&Groups]()
+			{
+				TCountedSet<int> Result;
+				for (const std::vector<int>& Group : Groups)
+				{
+					UnrealRanges::Algorithm::AddAllFromRange(Result, Group);
+				}
+				Check(static_cast<int>(Result.size()) == ElementsNum, "Set has all added elements");
+			});
+
+		Report("unordered_set += vector (repeated)", LoopNum, RangeNum);
+		//NB: Buckets are reserved for first added elements, then set grows by itself
+		Check(RangeNum <= LoopNum + 1, "Repeated adding to unordered set is not allocated more than by loop");
+	}
+
+	// Node based collections: buckets are allocated once
+	{
+		const int LoopNum = CountAllocations([&Values]()
+			{
+				TCountedSet<int> Result;
+				for (const int Value : Values)
+				{
+					Result.insert(Value);
+				}
+			});
+
+		const int RangeNum = CountAllocations([&Values]()
+			{
+				UnrealRanges::Algorithm::RangeToCollection<TCountedSet<int>>(Values);
+			});
+
+		Report("unordered_set <- vector", LoopNum, RangeNum);
+		Check(RangeNum <= ElementsNum + 1, "Buckets of unordered set are allocated once");
+	}
+
+	// Deque: blocks are allocated while elements are added, as for the loop
+	{
+		const int LoopNum = CountAllocations([&Values]()
+			{
+				TCountedDeque<int> Result;
+				for (const int Value : Values)
+				{
+					Result.push_back(Value);
+				}
+			});
+
+		const int RangeNum = CountAllocations([&Values]()
+			{
+				UnrealRanges::Algorithm::RangeToCollection<TCountedDeque<int>>(Values);
+			});
+
+		Report("deque <- vector", LoopNum, RangeNum);
+		Check(RangeNum <= LoopNum, "Deque from Range is not allocated more than by loop");
+	}
+
+	if (FailuresNum == 0)
+	{
+		std::printf("OK\n");
+	}
+
+	return FailuresNum == 0 ? 0 : 1;
+}
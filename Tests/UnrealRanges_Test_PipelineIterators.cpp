@@ -0,0 +1,125 @@
+// Checks Ranges that copy and assign iterators of Parent Range ("ReverseRange()",
+// "ShuffledRange()") over pipelines whose functors capture owning state (iterators of
+// such pipelines hold copies of the functors). Run under sanitizers to catch bitwise
+// copying of the functors
+
+#include "UnrealRanges_Test_StandIn.h"
+#include "../UnrealRanges_CommonNoUsing.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace
+{
+	int FailuresNum = 0;
+
+	void Check(const bool bCondition, const char* Description)
+	{
+		if (!bCondition)
+		{
+			std::printf("FAILED: %s\n", Description);
+			++FailuresNum;
+		}
+	}
+
+	std::vector<int> MakeValues(const int Num)
+	{
+		std::vector<int> Values;
+		for (int Index = 0; Index < Num; ++Index)
+		{
+			Values.push_back(Index);
+		}
+
+		return Values;
+	}
+
+	//NB: Captured string is long enough to be allocated on heap
+	auto MakeCapturingTransform()
+	{
+		const std::string Prefix = "element with long enough prefix #";
+		return [Prefix](const int Value) { return Prefix + std::to_string(Value); };
+	}
+
+	void CheckReverse()
+	{
+		const std::vector<int> Values = MakeValues(100);
+		auto ToString = MakeCapturingTransform();
+
+		std::vector<std::string> Expected;
+		for (auto It = Values.rbegin(); It != Values.rend(); ++It)
+		{
+			Expected.push_back(ToString(*It));
+		}
+
+		std::vector<std::string> Reversed;
+		for (const std::string& Element : Values | UnrealRanges::TransformedRange(ToString) | UnrealRanges::ReverseRange())
+		{
+			Reversed.push_back(Element);
+		}
+
+		Check(Reversed == Expected, "Reversed capturing transform gives elements in reverse order");
+
+		auto Range = Values | UnrealRanges::TransformedRange(ToString) | UnrealRanges::ReverseRange();
+		auto It = UnrealRanges::Utils::RangeBegin(Range);
+		auto Other = It + 10;
+		It = Other;
+		Check(*It == Expected[10], "Iterator of reversed capturing transform is assignable");
+
+		Check(UnrealRanges::Algorithm::RangeToVector(
+			Values | UnrealRanges::TransformedRange(ToString) | UnrealRanges::ReverseRange()) == Expected,
+			"Reversed capturing transform is collected in reverse order");
+	}
+
+	void CheckShuffled()
+	{
+		const std::vector<int> Values = MakeValues(100);
+		auto ToString = MakeCapturingTransform();
+
+		std::vector<std::string> Expected;
+		std::vector<std::string> Shuffled;
+		for (const int Index : Values | UnrealRanges::ShuffledRange(7))
+		{
+			Expected.push_back(ToString(Index));
+		}
+
+		for (const std::string& Element : Values | UnrealRanges::TransformedRange(ToString) | UnrealRanges::ShuffledRange(7))
+		{
+			Shuffled.push_back(Element);
+		}
+
+		Check(Shuffled == Expected, "Shuffled capturing transform has same order as shuffled Parent Range");
+
+		std::vector<std::string> SortedShuffled = Shuffled;
+		std::vector<std::string> SortedAll;
+		for (const int Value : Values)
+		{
+			SortedAll.push_back(ToString(Value));
+		}
+
+		std::sort(SortedShuffled.begin(), SortedShuffled.end());
+		std::sort(SortedAll.begin(), SortedAll.end());
+		Check(SortedShuffled == SortedAll, "Shuffled capturing transform has each element once");
+
+		auto Range = Values | UnrealRanges::TransformedRange(ToString) | UnrealRanges::ShuffledRange(7);
+		auto It = UnrealRanges::Utils::RangeBegin(Range);
+		It += 50;
+		auto Other = It - 20;
+		It = Other;
+		Check(*It == Expected[30], "Iterator of shuffled capturing transform is movable and assignable");
+	}
+}
+
+int main()
+{
+	CheckReverse();
+	CheckShuffled();
+
+	if (FailuresNum == 0)
+	{
+		std::printf("OK\n");
+	}
+
+	return FailuresNum == 0 ? 0 : 1;
+}
@@ -0,0 +1,185 @@
+// Benchmark of projection calls and element copies of "MinElementBy()"/"MaxElementBy()": projection
+// is called once per element, Ranges indexable in constant time copy only the result, other Ranges
+// copy element only when better one is found. Results are printed and checked against
+// "std::min_element()"/"std::max_element()"
+
+#include "UnrealRanges_Test_StandIn.h"
+#include "../UnrealRanges_CommonNoUsing.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <list>
+#include <random>
+#include <vector>
+
+namespace
+{
+	int FailuresNum = 0;
+
+	void Check(const bool bCondition, const char* Description)
+	{
+		if (!bCondition)
+		{
+			std::printf("FAILED: %s\n", Description);
+			++FailuresNum;
+		}
+	}
+
+	int CopiesNum = 0;
+	int ProjectionsNum = 0;
+
+	struct FUnit
+	{
+		FUnit() = default;
+		explicit FUnit(const int InHealth) : Health(InHealth) { }
+
+		FUnit(const FUnit& Other) : Health(Other.Health) { ++CopiesNum; }
+		FUnit(FUnit&& Other) noexcept : Health(Other.Health) { }
+
+		FUnit& operator=(const FUnit& Other) { Health = Other.Health; ++CopiesNum; return *this; }
+		FUnit& operator=(FUnit&& Other) noexcept { Health = Other.Health; return *this; }
+
+		int Health = 0;
+	};
+
+	int GetHealth(const FUnit& Unit)
+	{
+		++ProjectionsNum;
+		return Unit.Health;
+	}
+
+	bool IsAlive(const FUnit& Unit)
+	{
+		return Unit.Health > 0;
+	}
+
+	void Report(const char* Case, const int ElementsNum)
+	{
+		std::printf("%-36s projections per element: %.2f   copies: %d\n",
+			Case, static_cast<float>(ProjectionsNum) / ElementsNum, CopiesNum);
+	}
+
+	// Number of elements that are better than all previous ones (each of them is copied by
+	// Ranges that are not indexable in constant time)
+	template<typename IsBetterType>
+	int CountImprovements(const std::vector<int>& Healths, const IsBetterType& IsBetter)
+	{
+		int ImprovementsNum = 0;
+		for (std::size_t Index = 0; Index < Healths.size(); ++Index)
+		{
+			if (Index == 0 || IsBetter(Healths[Index], *std::min_element(Healths.begin(), Healths.begin() + Index, IsBetter)))
+			{
+				++ImprovementsNum;
+			}
+		}
+
+		return ImprovementsNum;
+	}
+
+	template<typename FindType>
+	int Find(const FindType& FindBest)
+	{
+		CopiesNum = 0;
+		ProjectionsNum = 0;
+
+		const auto Best = FindBest();
+		Check(UnrealRanges::Utils::IsOptionalSet(Best), "Best element is found");
+
+		return UnrealRanges::Utils::IsOptionalSet(Best) ? UnrealRanges::Utils::GetOptionalValue(Best).Health : -1;
+	}
+
+	void CheckSelection(const char* Name, const std::vector<int>& Healths)
+	{
+		const int Num = static_cast<int>(Healths.size());
+		const int ExpectedMin = *std::min_element(Healths.begin(), Healths.end());
+		const int ExpectedMax = *std::max_element(Healths.begin(), Healths.end());
+		const int MinImprovementsNum = CountImprovements(Healths, [](const int A, const int B) { return A < B; });
+		const int MaxImprovementsNum = CountImprovements(Healths, [](const int A, const int B) { return A > B; });
+
+		std::vector<FUnit> Units;
+		for (const int Health : Healths)
+		{
+			Units.emplace_back(Health);
+		}
+
+		const std::list<FUnit> UnitsList{ Units.begin(), Units.end() };
+
+		std::printf("%s:\n", Name);
+
+		// Indexable Range: only result is copied
+		{
+			Check(Find([&Units]() { return UnrealRanges::Algorithm::MinElementBy(Units, &GetHealth); }) == ExpectedMin,
+				"MinElementBy() of vector");
+			Report("  MinElementBy, vector", Num);
+			Check(ProjectionsNum == Num, "MinElementBy() of vector projects each element once");
+			Check(CopiesNum <= 1, "MinElementBy() of vector copies only result");
+
+			Check(Find([&Units]() { return UnrealRanges::Algorithm::MaxElementBy(Units, &GetHealth); }) == ExpectedMax,
+				"MaxElementBy() of vector");
+			Report("  MaxElementBy, vector", Num);
+			Check(ProjectionsNum == Num, "MaxElementBy() of vector projects each element once");
+			Check(CopiesNum <= 1, "MaxElementBy() of vector copies only result");
+		}
+
+		// Not indexable Ranges: best element is copied when it is found
+		{
+			Check(Find([&UnitsList]() { return UnrealRanges::Algorithm::MinElementBy(UnitsList, &GetHealth); }) == ExpectedMin,
+				"MinElementBy() of list");
+			Report("  MinElementBy, list", Num);
+			Check(ProjectionsNum == Num, "MinElementBy() of list projects each element once");
+			Check(CopiesNum <= MinImprovementsNum + 1, "MinElementBy() of list copies only better elements");
+
+			Check(Find([&UnitsList]() { return UnrealRanges::Algorithm::MaxElementBy(UnitsList, &GetHealth); }) == ExpectedMax,
+				"MaxElementBy() of list");
+			Report("  MaxElementBy, list", Num);
+			Check(ProjectionsNum == Num, "MaxElementBy() of list projects each element once");
+			Check(CopiesNum <= MaxImprovementsNum + 1, "MaxElementBy() of list copies only better elements");
+		}
+
+		//NB: All healths are positive, so filter passes all elements
+		{
+			Check(Find([&Units]() { return UnrealRanges::Algorithm::MinElementBy(Units | UnrealRanges::FilteredRange(&IsAlive), &GetHealth); }) == ExpectedMin,
+				"MinElementBy() of filtered vector");
+			Report("  MinElementBy, vector | Filtered", Num);
+			Check(ProjectionsNum == Num, "MinElementBy() of filtered vector projects each element once");
+			Check(CopiesNum <= MinImprovementsNum + 1, "MinElementBy() of filtered vector copies only better elements");
+
+			Check(Find([&Units]() { return UnrealRanges::Algorithm::MaxElementBy(Units | UnrealRanges::FilteredRange(&IsAlive), &GetHealth); }) == ExpectedMax,
+				"MaxElementBy() of filtered vector");
+			Report("  MaxElementBy, vector | Filtered", Num);
+			Check(ProjectionsNum == Num, "MaxElementBy() of filtered vector projects each element once");
+			Check(CopiesNum <= MaxImprovementsNum + 1, "MaxElementBy() of filtered vector copies only better elements");
+		}
+	}
+
+	constexpr int ElementsNum = 1000;
+}
+
+int main()
+{
+	std::vector<int> Ascending;
+	for (int Index = 0; Index < ElementsNum; ++Index)
+	{
+		Ascending.push_back(Index + 1);
+	}
+
+	std::vector<int> Descending{ Ascending.rbegin(), Ascending.rend() };
+
+	std::vector<int> Shuffled = Ascending;
+	std::shuffle(Shuffled.begin(), Shuffled.end(), std::mt19937{ 42 });
+
+	//NB: Equal keys - first of best elements is selected, so elements are not copied again
+	const std::vector<int> Equal(ElementsNum, 7);
+
+	CheckSelection("ascending", Ascending);
+	CheckSelection("descending", Descending);
+	CheckSelection("shuffled", Shuffled);
+	CheckSelection("equal", Equal);
+
+	if (FailuresNum == 0)
+	{
+		std::printf("OK\n");
+	}
+
+	return FailuresNum == 0 ? 0 : 1;
+}
@@ -0,0 +1,133 @@
+// Checks "SetOperationRange<>()" of all algorithms against "std::set_*()" algorithms,
+// including Ranges which are filtering and transforming pipelines (iterators of such
+// Ranges hold their functors and are not assignable)
+
+#include "UnrealRanges_Test_StandIn.h"
+#include "../UnrealRanges_CommonNoUsing.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+	int FailuresNum = 0;
+
+	void Check(const bool bCondition, const char* Description)
+	{
+		if (!bCondition)
+		{
+			std::printf("FAILED: %s\n", Description);
+			++FailuresNum;
+		}
+	}
+
+	template<int Operation>
+	std::vector<int> Expected(const std::vector<int>& A, const std::vector<int>& B)
+	{
+		std::vector<int> Result;
+
+		if ((Operation & UnrealRanges::Utils::SetOperation::A_B) != 0)
+		{
+			std::set_difference(A.begin(), A.end(), B.begin(), B.end(), std::back_inserter(Result));
+		}
+
+		if ((Operation & UnrealRanges::Utils::SetOperation::B_A) != 0)
+		{
+			std::set_difference(B.begin(), B.end(), A.begin(), A.end(), std::back_inserter(Result));
+		}
+
+		if ((Operation & UnrealRanges::Utils::SetOperation::AnB) != 0)
+		{
+			std::set_intersection(A.begin(), A.end(), B.begin(), B.end(), std::back_inserter(Result));
+		}
+
+		std::sort(Result.begin(), Result.end());
+		return Result;
+	}
+
+	template<typename RangeType>
+	std::vector<int> SortedElements(const RangeType& Range)
+	{
+		std::vector<int> Result;
+		for (const int Value : Range)
+		{
+			Result.push_back(Value);
+		}
+
+		std::sort(Result.begin(), Result.end());
+		return Result;
+	}
+
+	template<int Operation>
+	void CheckOperation(const std::vector<int>& SourceA, const std::vector<int>& B)
+	{
+		using namespace UnrealRanges::Utils::SetOperation;
+
+		//NB: Captured state makes functors (and iterators holding them) not assignable
+		const std::string Tag = "odd";
+		auto IsOdd = [Tag](const int Value) { return !Tag.empty() && Value % 2 != 0; };
+		auto Identity = [Tag](const int Value) { return Tag.empty() ? 0 : Value; };
+
+		std::vector<int> A;
+		std::copy_if(SourceA.begin(), SourceA.end(), std::back_inserter(A), IsOdd);
+		const std::vector<int> ExpectedResult = Expected<Operation>(A, B);
+
+		auto FilteredA = SourceA | UnrealRanges::FilteredRange(IsOdd);
+		auto TransformedB = B | UnrealRanges::TransformedRange(Identity);
+
+		Check(SortedElements(UnrealRanges::SetOperationRange<Operation, Scan>(FilteredA, TransformedB)) == ExpectedResult,
+			"Scan set operation over pipelines");
+		Check(SortedElements(UnrealRanges::SetOperationRange<Operation, Hashed>(FilteredA, TransformedB)) == ExpectedResult,
+			"Hashed set operation over pipelines");
+		Check(SortedElements(UnrealRanges::SetOperationRange<Operation, Sorted>(FilteredA, TransformedB)) == ExpectedResult,
+			"Sorted set operation over pipelines");
+		Check(SortedElements(UnrealRanges::SetOperationRange<Operation, Sorted>(A, B)) == ExpectedResult,
+			"Sorted set operation over vectors");
+	}
+
+	std::vector<int> MakeSortedUnique(std::mt19937& Random, const int Num, const int MaxValue)
+	{
+		std::set<int> Values;
+		for (int Index = 0; Index < Num; ++Index)
+		{
+			Values.insert(static_cast<int>(Random() % MaxValue));
+		}
+
+		return { Values.begin(), Values.end() };
+	}
+}
+
+int main()
+{
+	using namespace UnrealRanges::Utils::SetOperation;
+
+	std::mt19937 Random{ 42 };
+
+	//NB: Sizes include empty Ranges and Ranges that end before other one, so rest of
+	// other Range is skipped
+	for (int Iteration = 0; Iteration < 200; ++Iteration)
+	{
+		const std::vector<int> A = MakeSortedUnique(Random, Random() % 30, 50);
+		const std::vector<int> B = MakeSortedUnique(Random, Random() % 30, 50);
+
+		CheckOperation<A_B>(A, B);
+		CheckOperation<B_A>(A, B);
+		CheckOperation<AnB>(A, B);
+		CheckOperation<A_B | B_A>(A, B);
+		CheckOperation<A_B | AnB>(A, B);
+		CheckOperation<B_A | AnB>(A, B);
+		CheckOperation<A_B | B_A | AnB>(A, B);
+	}
+
+	if (FailuresNum == 0)
+	{
+		std::printf("OK\n");
+	}
+
+	return FailuresNum == 0 ? 0 : 1;
+}
@@ -0,0 +1,247 @@
+// Checks and benchmark of SIMD search ("Contains()", "EqualsToSome()", "FilterExclude()") over
+// contiguous Ranges. Results are checked against scalar "std::find()"/"std::copy_if()" for all
+// vectorizable element types and sizes with tails that are not multiple of vector width. Timings
+// of the library and of scalar loop are printed for 1k-1M elements (build with optimizations to
+// get meaningful numbers), they are not checked
+
+#include "UnrealRanges_Test_StandIn.h"
+#include "../UnrealRanges_CommonNoUsing.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+namespace
+{
+	int FailuresNum = 0;
+
+	void Check(const bool bCondition, const char* Description)
+	{
+		if (!bCondition)
+		{
+			std::printf("FAILED: %s\n", Description);
+			++FailuresNum;
+		}
+	}
+
+	enum class EColor : std::uint16_t
+	{
+		Red,
+		Green,
+		Blue
+	};
+
+	template<typename ElementType>
+	struct TElements
+	{
+		static ElementType Make(const int Index) { return static_cast<ElementType>(Index % 100); }
+		static ElementType Missing() { return static_cast<ElementType>(100); }
+	};
+
+	template<>
+	struct TElements<EColor>
+	{
+		static EColor Make(const int Index) { return Index % 2 == 0 ? EColor::Red : EColor::Green; }
+		static EColor Missing() { return EColor::Blue; }
+	};
+
+	int PointedValues[101] = { };
+
+	template<>
+	struct TElements<const int*>
+	{
+		static const int* Make(const int Index) { return &PointedValues[Index % 100]; }
+		static const int* Missing() { return &PointedValues[100]; }
+	};
+
+	template<typename ElementType>
+	void CheckSearch(const int Num)
+	{
+		using FElements = TElements<ElementType>;
+
+		std::vector<ElementType> Values;
+		for (int Index = 0; Index < Num; ++Index)
+		{
+			Values.push_back(FElements::Make(Index));
+		}
+
+		//NB: Searched values are placed at each position to cover vector blocks and tails
+		for (int Position = 0; Position <= Num; ++Position)
+		{
+			std::vector<ElementType> Searched = Values;
+			if (Position < Num)
+			{
+				Searched[Position] = FElements::Missing();
+			}
+
+			const bool bExpected = std::find(Searched.begin(), Searched.end(), FElements::Missing()) != Searched.end();
+
+			Check(UnrealRanges::Algorithm::Contains(Searched, FElements::Missing()) == bExpected,
+				"Contains() is same as std::find()");
+			Check(UnrealRanges::Algorithm::EqualsToSome(FElements::Missing(), Searched) == bExpected,
+				"EqualsToSome(Value, Range) is same as std::find()");
+		}
+
+		const ElementType Excluded = FElements::Make(0);
+
+		std::vector<ElementType> Expected;
+		std::copy_if(Values.begin(), Values.end(), std::back_inserter(Expected),
+			[&Excluded](const ElementType& Value) { return !(Value == Excluded); });
+
+		Check(UnrealRanges::Algorithm::RangeToVector(Values | UnrealRanges::FilterExclude(Excluded)) == Expected,
+			"FilterExclude() is same as std::copy_if()");
+
+		std::vector<ElementType> Iterated;
+		for (const ElementType& Value : Values | UnrealRanges::FilterExclude(Excluded))
+		{
+			Iterated.push_back(Value);
+		}
+
+		Check(Iterated == Expected, "Iterating FilterExclude() is same as std::copy_if()");
+	}
+
+	template<typename ElementType>
+	void CheckSearchAllSizes()
+	{
+		for (int Num = 0; Num <= 80; ++Num)
+		{
+			CheckSearch<ElementType>(Num);
+		}
+
+		CheckSearch<ElementType>(1000);
+	}
+
+	void CheckFloatingPoint()
+	{
+		const float NaN = std::numeric_limits<float>::quiet_NaN();
+		const std::vector<float> Values(37, NaN);
+		Check(!UnrealRanges::Algorithm::Contains(Values, NaN), "NaN is not equal to NaN");
+
+		std::vector<double> Zeros(37, 0.0);
+		Zeros[36] = -0.0;
+		Check(UnrealRanges::Algorithm::Contains(Zeros, -0.0), "Positive zero is equal to negative zero");
+		Check(UnrealRanges::Algorithm::RangeToVector(Zeros | UnrealRanges::FilterExclude(-0.0)).empty(),
+			"Zeros of both signs are excluded");
+	}
+
+	void CheckInitializerList()
+	{
+		Check(UnrealRanges::Algorithm::EqualsToSome(5, { 1, 2, 3, 4, 5, 6, 7, 8, 9 }), "Found in initializer list");
+		Check(!UnrealRanges::Algorithm::EqualsToSome(10, { 1, 2, 3, 4, 5, 6, 7, 8, 9 }), "Not found in initializer list");
+		Check(UnrealRanges::Algorithm::EqualsToSome(EColor::Blue, { EColor::Red, EColor::Blue }), "Enum found in initializer list");
+	}
+
+	// -------------------- Benchmark ------------------------
+
+	volatile int ResultsSink = 0;
+
+	template<typename BodyType>
+	double MeasureNanosecondsPerElement(const int Num, const BodyType& Body)
+	{
+		const int RepeatsNum = std::max(1, 10000000 / Num);
+
+		const auto Start = std::chrono::steady_clock::now();
+		for (int Repeat = 0; Repeat < RepeatsNum; ++Repeat)
+		{
+			ResultsSink = ResultsSink + Body();
+		}
+		const auto Finish = std::chrono::steady_clock::now();
+
+		return std::chrono::duration<double, std::nano>(Finish - Start).count() / (static_cast<double>(RepeatsNum) * Num);
+	}
+
+	template<typename ElementType>
+	void Benchmark(const char* TypeName, const int Num)
+	{
+		using FElements = TElements<ElementType>;
+
+		std::vector<ElementType> Values;
+		for (int Index = 0; Index < Num; ++Index)
+		{
+			Values.push_back(FElements::Make(Index));
+		}
+
+		//NB: Searched value is missing, so whole Range is scanned
+		const ElementType Missing = FElements::Missing();
+
+		const double ScalarContains = MeasureNanosecondsPerElement(Num, [&Values, &Missing]()
+			{
+				return std::find(Values.begin(), Values.end(), Missing) != Values.end() ? 1 : 0;
+			});
+
+		const double RangeContains = MeasureNanosecondsPerElement(Num, [&Values, &Missing]()
+			{
+				return UnrealRanges::Algorithm::Contains(Values, Missing) ? 1 : 0;
+			});
+
+		//NB: Each 100th element is excluded (sequences of excluded elements are short)
+		const ElementType Excluded = FElements::Make(0);
+		std::vector<ElementType> Output;
+		Output.reserve(Num);
+
+		const double ScalarExclude = MeasureNanosecondsPerElement(Num, [&Values, &Excluded, &Output]()
+			{
+				Output.clear();
+				for (const ElementType& Value : Values)
+				{
+					if (!(Value == Excluded))
+					{
+						Output.push_back(Value);
+					}
+				}
+
+				return static_cast<int>(Output.size());
+			});
+
+		const double RangeExclude = MeasureNanosecondsPerElement(Num, [&Values, &Excluded, &Output]()
+			{
+				Output.clear();
+				UnrealRanges::Algorithm::AddAllFromRange(Output, Values | UnrealRanges::FilterExclude(Excluded));
+				return static_cast<int>(Output.size());
+			});
+
+		std::printf("%-8s %8d   Contains  scalar: %6.3f  range: %6.3f ns/elem   FilterExclude  scalar: %6.3f  range: %6.3f ns/elem\n",
+			TypeName, Num, ScalarContains, RangeContains, ScalarExclude, RangeExclude);
+	}
+
+	template<typename ElementType>
+	void BenchmarkAllSizes(const char* TypeName)
+	{
+		for (const int Num : { 1000, 10000, 100000, 1000000 })
+		{
+			Benchmark<ElementType>(TypeName, Num);
+		}
+	}
+}
+
+int main()
+{
+	CheckSearchAllSizes<std::int8_t>();
+	CheckSearchAllSizes<std::uint8_t>();
+	CheckSearchAllSizes<std::int16_t>();
+	CheckSearchAllSizes<std::int32_t>();
+	CheckSearchAllSizes<std::int64_t>();
+	CheckSearchAllSizes<float>();
+	CheckSearchAllSizes<double>();
+	CheckSearchAllSizes<EColor>();
+	CheckSearchAllSizes<const int*>();
+	CheckFloatingPoint();
+	CheckInitializerList();
+
+	BenchmarkAllSizes<std::int8_t>("int8");
+	BenchmarkAllSizes<std::int32_t>("int32");
+	BenchmarkAllSizes<std::int64_t>("int64");
+	BenchmarkAllSizes<float>("float");
+
+	if (FailuresNum == 0)
+	{
+		std::printf("OK\n");
+	}
+
+	return FailuresNum == 0 ? 0 : 1;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+// Minimal stand-in for Unreal types used by tests of Unreal independent parts of
+// the library on platforms without Unreal (like Linux CI)
+
+#include <type_traits>//for "std::remove_reference_t<>"
+
+// "Forward()" of "Templates/UnrealTemplate.h"
+template<typename T>
+constexpr T&& Forward(std::remove_reference_t<T>& Value) noexcept
+{
+	return static_cast<T&&>(Value);
+}
+
+template<typename T>
+constexpr T&& Forward(std::remove_reference_t<T>&& Value) noexcept
+{
+	return static_cast<T&&>(Value);
+}
+
+// "Math/Vector.h" (double precision, as in UE5)
+struct FVector
+{
+	double X = 0.0;
+	double Y = 0.0;
+	double Z = 0.0;
+};
+
+// "GameFramework/Actor.h"
+class AActor
+{
+public:
+	explicit AActor(const FVector& InLocation)
+		: Location(InLocation)
+	{ }
+
+	FVector GetActorLocation() const
+	{
+		return Location;
+	}
+
+private:
+	FVector Location;
+};
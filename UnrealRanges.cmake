@@ -3,6 +3,7 @@ set(UnrealRanges ${UnrealRanges}
    ${CMAKE_CURRENT_LIST_DIR}/UnrealRanges_CommonNoUsing.h
    ${CMAKE_CURRENT_LIST_DIR}/UnrealRanges_Common.h
    ${CMAKE_CURRENT_LIST_DIR}/UnrealRanges_Common_Algorithm.h
+   ${CMAKE_CURRENT_LIST_DIR}/UnrealRanges_Common_BitSet.h
    ${CMAKE_CURRENT_LIST_DIR}/UnrealRanges_Common_Injection.h
    ${CMAKE_CURRENT_LIST_DIR}/UnrealRanges_Common_Ranges.h
    ${CMAKE_CURRENT_LIST_DIR}/UnrealRanges_Utils_UCast.h
@@ -14,17 +15,23 @@ set(UnrealRanges ${UnrealRanges}
    ${CMAKE_CURRENT_LIST_DIR}/UnrealRanges_Unreal_Algorithm.h
    ${CMAKE_CURRENT_LIST_DIR}/UnrealRanges_Unreal_Injection.h
    ${CMAKE_CURRENT_LIST_DIR}/UnrealRanges_Unreal_Ranges.h
+   ${CMAKE_CURRENT_LIST_DIR}/UnrealRanges_Unreal_Spatial.h
    ${CMAKE_CURRENT_LIST_DIR}/UnrealRanges_Unreal_Utils.h
    ${CMAKE_CURRENT_LIST_DIR}/Private/UnrealRanges_Impl_Basics.inl
    ${CMAKE_CURRENT_LIST_DIR}/Private/UnrealRanges_Impl_Common_Algorithm.inl
+   ${CMAKE_CURRENT_LIST_DIR}/Private/UnrealRanges_Impl_Common_BitSet.inl
    ${CMAKE_CURRENT_LIST_DIR}/Private/UnrealRanges_Impl_Common_Ranges.inl
    ${CMAKE_CURRENT_LIST_DIR}/Private/UnrealRanges_Impl_Unreal_Algorithm.inl
    ${CMAKE_CURRENT_LIST_DIR}/Private/UnrealRanges_Impl_Unreal_Ranges.inl
+   ${CMAKE_CURRENT_LIST_DIR}/Private/UnrealRanges_Impl_Unreal_Spatial.inl
    ${CMAKE_CURRENT_LIST_DIR}/Private/UnrealRanges_Impl_Unreal_Utils.inl
    ${CMAKE_CURRENT_LIST_DIR}/Private/UnrealRanges_Impl_Utils.inl
    ${CMAKE_CURRENT_LIST_DIR}/Private/UnrealRanges_Impl_Utils_Injected.h
    ${CMAKE_CURRENT_LIST_DIR}/Private/UnrealRanges_Impl_Utils_Injected.inl
    ${CMAKE_CURRENT_LIST_DIR}/Private/UnrealRanges_Impl_Utils_UCast.inl
+   ${CMAKE_CURRENT_LIST_DIR}/Private/UnrealRanges_Private_Parallel.h
+   ${CMAKE_CURRENT_LIST_DIR}/Private/UnrealRanges_Private_Simd.h
+   ${CMAKE_CURRENT_LIST_DIR}/Private/UnrealRanges_Private_SpatialGrid.h
    ${CMAKE_CURRENT_LIST_DIR}/Private/UnrealRanges_Private_UnrealSpecific.h
    ${CMAKE_CURRENT_LIST_DIR}/Private/UnrealRanges_Private_Utils.h
    ${CMAKE_CURRENT_LIST_DIR}/Private/UnrealRanges_Utils_Details.h
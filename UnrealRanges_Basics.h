@@ -10,12 +10,15 @@ namespace UnrealRanges{
 
 
 	// ****************** !!! NB !!! ******************
-	// Current Range implementation does not support iteration
-	// over mutable values. Changing of elements got during
-	// iterations from Ranges may cause Undefined Behaviour
-	// 
-	// Mutating of Range elements will be supported in next
-	// Range implementation version
+	// Ranges that don't transform elements (filtered, reversed,
+	// stepped into, conditional and set operation ranges) give
+	// access to elements by reference to the source collection
+	// elements, without copying.
+	// 
+	// Elements may be mutated during iteration only if source
+	// collection is passed to the Range as non-const lvalue.
+	// Collections passed as rvalues are owned by Range and
+	// their elements are accessed as const
 	// ****************** !!! NB !!! ******************
 
 
@@ -100,6 +103,16 @@ namespace UnrealRanges{
 	//      // Other timers will be filtered out because they are expired
 	//  }
 	// 
+	//  //.[Example #3]
+	//  // Mutating of filtered elements: "TimerDatas" is non-const lvalue,
+	//  // so elements are accessed by reference to "TimerDatas" elements
+	//
+	//  for (FTimerData& Timer : TimerDatas | FilteredRange<Not>(IsTimerExpired))
+	//  {
+	//      Timer.LeftTime -= DeltaTime;
+	//      // "TimerDatas[1].LeftTime" is changed
+	//  }
+	// 
 	// [Overloading #1]
 	template<Utils::Logic::ELogicInvertion LogicInversion, typename PassOnTrueFilterPredicateType>
 	auto FilteredRange(PassOnTrueFilterPredicateType&& PassOnTrueFilter);
@@ -119,6 +132,12 @@ namespace UnrealRanges{
 	//         Range-Part that performs actions described below...
 	// 
 	// Form transformed Range from values returned by "TransformFunc"
+	//
+	// Range keeps size of sized Parent Range (see "UnrealRanges::Utils::RangeSize()")
+	//
+	// ! NB: If "TransformFunc" returns reference, it is passed through only
+	// when Parent Range elements are accessed by reference too. Otherwise
+	// returned value is copied (reference may point to temporary element)
 	// 
 	// ~~~~ Example ~~~~
 	//
@@ -162,6 +181,10 @@ namespace UnrealRanges{
 	// If returned "TUnrealRanges_Optional<...>" value is set, it value is passed for formed Range
 	// (using "TUnrealRanges_Optional<...>::GetValue()").
 	// Otherwise, Parent Range element is filtered out
+	//
+	// ! NB: "PassOnTrueFilterAndTransform" is called exactly once for each Parent
+	//  Range element: returned optional is stored in the iterator and reused
+	//  when getting element value
 	// 
 	// ~~~~ Example ~~~~
 	//
@@ -209,7 +232,11 @@ namespace UnrealRanges{
 	// Reversed range. Iterating it you will get elements of original range in
 	// reverse order
 	// 
-	// !NB: Parent Range should support "--" operator call
+	// !NB: Parent Range should support "--" operator call. Ranges with Logic that
+	// doesn't skip elements (like "TransformedRange") support it if their Parent
+	// Range supports it
+	//
+	// Iterators of the Range are random access if iterators of Parent Range are
 	// 
 	// ~~~~ Example ~~~~
 	//
@@ -226,6 +253,84 @@ namespace UnrealRanges{
 	//
 	auto ReverseRange();
 
+	// ---------------------- SlicedRange<...>(StartIndex, Num) -----------------------
+	//
+	// IN:
+	//    (1) StartIndex
+	//       Index of Parent Range element that will be first Range element
+	//
+	//    (2) Num
+	//       Max number of Range elements
+	//
+	// OUT:
+	//    {ret}
+	//         Range-Part that performs actions described below...
+	//
+	// Range of "Num" Parent Range elements starting from element with
+	// "StartIndex" index. Range contains less elements if Parent Range
+	// has not enough elements
+	//
+	// Skipping of first "StartIndex" elements is performed in constant time
+	// if Parent Range iterators are random access (for "std::vector" and
+	// Ranges over it that don't skip elements - like "TransformedRange").
+	// Range iterators are random access in this case too
+	//
+	// ~~~~ Example ~~~~
+	//
+	// std::vector<int> Range{ 1, 2, 3, 4, 5 };
+	// 
+	// for (int32 Element : Range | SlicedRange(1, 3))
+	// {
+	//     // "Element" during iterations will be equals to
+	//     // "2", "3", "4"
+	// }
+	//
+	auto SlicedRange(const int StartIndex, const int Num);
+
+	// ---------------------- ShuffledRange<...>([Seed]) -----------------------
+	//
+	// IN:
+	//    (1) Seed
+	//       Seed of elements order. If not passed, random seed is got on call
+	//
+	// OUT:
+	//    {ret}
+	//         Range-Part that performs actions described below...
+	//
+	// Range of all Parent Range elements in pseudo-random order. Parent Range is not
+	// copied or changed: indices of its elements are mapped by pseudo-random bijection
+	// (Feistel network with "cycle walking"), so memory used by the Range doesn't depend
+	// on number of elements and iteration may be stopped at any moment without any work
+	// done for elements that were not visited. Order is defined by the Seed, so same
+	// Range is iterated in same order each time
+	//
+	// !NB: Parent Range iterators should be random access (like for "std::vector" and
+	// Ranges over it that don't skip elements - like "TransformedRange"). Iterators of
+	// the Range are random access too
+	//
+	// Order is good for gameplay randomization, but it's not uniform random permutation
+	// in strict sense (it's one of permutations got by the Seed)
+	//
+	// ~~~~ Example ~~~~
+	//
+	// std::vector<FSpawnPoint> SpawnPoints = GetSpawnPoints();
+	//
+	// // First free spawn point in random order, rest points are not checked
+	// for (const FSpawnPoint& SpawnPoint : SpawnPoints | ShuffledRange())
+	// {
+	//     if (SpawnPoint.IsFree())
+	//     {
+	//         Spawn(SpawnPoint);
+	//         break;
+	//     }
+	// }
+	//
+	// [Overloading #1]
+	auto ShuffledRange();
+
+	// [Overloading #2]
+	auto ShuffledRange(const unsigned int Seed);
+
 	// --------------- RecursiveRange<...>(RootValue, StepTransformFunc) ------------------
 	//
 	// IN:
@@ -397,6 +502,8 @@ namespace UnrealRanges{
 	// 
 	// ! NB: Range NOT include "EndValue"
 	//
+	// Range is sized: number of elements is got by "EnumValuesNum<EnumType>(...)"
+	//
 	// ~~~~ Example ~~~~
 	//
 	//  // Iterate over Enum values starting from specified
@@ -434,6 +541,21 @@ namespace UnrealRanges{
 	//
 	// Switches effect of TargetRange by flag in runtime
 	//
+	// Parent Range is not copied and not allocated: TargetRange is applied to
+	// Parent Range kept by the Conditional Range. Iterators check the flag on
+	// each step, but algorithms of this library check it once and iterate used
+	// Range directly (see "UnrealRanges::Utils::RangeVisit()")
+	//
+	// NB: Checking of the flag by iterators is deliberate limitation: iterators
+	// of Parent and Target Ranges have different types, so "for" loop can't
+	// choose one of them once. Use "ForEach()" (or "RangeForEachWhile()" for
+	// stopping early) in hot loops - it iterates used Range without the checks
+	// (see [Example #2])
+	//
+	// NB: Not temporary TargetRange is referenced. Temporary TargetRange is
+	// copied when not temporary Conditional Range is applied to Parent Range
+	// (like "Range | SomeConditionalRange"), so it should be copyable in such case
+	//
 	// ~~~~ Examples ~~~~
 	//
 	//  //.[Common example types & variables]
@@ -469,10 +591,23 @@ namespace UnrealRanges{
 	//      }
 	//  }
 	//
+	//  //.[Example #2]
+	//  // Same iterating without checking of the flag on each step
+	//
+	//  void TraceWayFast(const EDirection Direction)
+	//  {
+	//      ForEach(
+	//          WayPoints | ConditionalRange(ReverseRange(), Direction == EDirection::Backward),
+	//          [](const std::string& Point)
+	//          {
+	//              // Same "Point" values as for [Example #1]
+	//          });
+	//  }
+	//
 	template<typename TargetRangeType>
 	auto ConditionalRange(TargetRangeType&& TargetRange, bool bUseTarget);
 
-	// --------- SetOperationRange<Operation, ...>(RangeA, RangeB) ---------
+	// --------- SetOperationRange<Operation, Algorithm, ...>(RangeA, RangeB, [KeyProj], [KeyLess]) ---------
 	//
 	// IN:
 	//    <Operation>
@@ -490,12 +625,38 @@ namespace UnrealRanges{
 	//       several desribed values in one time to get appropriate "concatinated"
 	//       subsets in rather more optimized way then "concating" them using 
 	// 
+	//    <Algorithm>
+	//       Algorithm used for checking if element of one Range is presented
+	//       in other Range, value of "UnrealRanges::Utils::SetOperation::EAlgorithm":
+	//        - "Scan" (default): other Range is iterated for each checked
+	//           element. Complexity is O(N*M), no allocations
+	//        - "Hashed": hash index of other Range is built once, on first
+	//           "begin()" of the result Range, and is probed for each checked
+	//           element. Complexity is O(N+M). For intersection ("AnB" only)
+	//           smaller Range is indexed if sizes of both Ranges are known
+	//           (elements of not indexed Range are passed to the result Range)
+	//        - "Sorted": Ranges are merged in one pass without allocations.
+	//           Complexity is O(N+M). Both Ranges should be sorted in
+	//           ascending order (by "<" or by KeyLess). Result Range is
+	//           sorted too
+	//
 	//    (1) RangeA
 	//       Range that is used as "Set A" for the Operation
 	//
 	//	  (2) RangeB
 	//       Range that is used as "Set B" for the Operation
 	// 
+	//    (3) KeyProj [Function #2, #3]
+	//       Callable that takes Range element and returns its key. Elements
+	//       are considered same if their keys are same. Supported only for
+	//       the "Hashed" and "Sorted" Algorithms
+	//
+	//    (4) KeyLess [Function #3]
+	//       Callable that takes two keys and returns "true" if first one
+	//       should be placed before second one. Keys are considered same if
+	//       none of them is less than other. Supported only for the "Sorted"
+	//       Algorithm
+	//
 	// OUT:
 	//    {ret}
 	//         Range that contains elements got by applaying Operation to the
@@ -503,7 +664,13 @@ namespace UnrealRanges{
 	//         
 	// NB 1: Currently ranges should have same element types
 	//
-	// NB 2: Range elements should support "{Element} == {Element}" operation
+	// NB 2: For the "Scan" Algorithm Range elements should support
+	//  "{Element} == {Element}" operation. For the "Hashed" Algorithm
+	//  elements (or keys got by KeyProj) should be hashable by the
+	//  HashSet Injection ("std::hash<>" for common and "GetTypeHash()"
+	//  for Unreal) and support "==" operation
+	//  For the "Sorted" Algorithm elements (or keys) should support "<"
+	//  operation if KeyLess is not passed
 	//
 	// NB 3: It is assumed that passed Ranges does not contains repeats.
 	//  For Ranges with repeats using "SetOperationRange<>()" may cause
@@ -515,7 +682,9 @@ namespace UnrealRanges{
 	//  "{ 1 }". Be aware and remember this issue when using this API 
 	//
 	// NB 4: When passing several Operations order of elements in the result
-	//  Range is not defined
+	//  Range is not defined. Exception is the "Sorted" Algorithm: elements
+	//  of the result Range are always sorted, for same elements presented in
+	//  both Ranges element from RangeA is used
 	// 
 	// ~~~~ Examples ~~~~
 	// 
@@ -564,9 +733,44 @@ namespace UnrealRanges{
 	//      // Subsets are returned
 	//  }
 	//
-	template<int Operation, typename RangeAType, typename RangeBType>
+	//  //[5]
+	//  struct FUnit { int Id; int Health; };
+	//  std::vector<FUnit> Units{ { 1, 10 }, { 2, 20 }, { 3, 30 } };
+	//  std::vector<FUnit> SelectedUnits{ { 3, 30 }, { 1, 10 } };
+	//
+	//  const auto GetId = [](const FUnit& Unit) { return Unit.Id; };
+	//
+	//  for (const FUnit& Unit : SetOperationRange<A_B, Hashed>(Units, SelectedUnits, GetId))
+	//  {
+	//      // "Unit" during iterations will be equals to:
+	//      // "{ 2, 20 }"
+	//      // Units are compared by "Id" using hash index of
+	//      // "SelectedUnits" built once
+	//  }
+	//
+	//  //[6]
+	//  std::vector<int> SortedA{ 1, 3, 5, 7 };
+	//  std::vector<int> SortedB{ 2, 3, 4, 7 };
+	//
+	//  for (const int Value : SetOperationRange<A_B | B_A, Sorted>(SortedA, SortedB))
+	//  {
+	//      // "Value" during iterations will be equals to:
+	//      // "1", "2", "4", "5"
+	//      // Ranges are merged in one pass, result is sorted
+	//  }
+	//
+	// [Function #1]
+	template<int Operation, Utils::SetOperation::EAlgorithm Algorithm = Utils::SetOperation::Scan, typename RangeAType, typename RangeBType>
 	auto SetOperationRange(RangeAType&& RangeA, RangeBType&& RangeB);
 
+	// [Function #2]
+	template<int Operation, Utils::SetOperation::EAlgorithm Algorithm, typename RangeAType, typename RangeBType, typename ProjectionType>
+	auto SetOperationRange(RangeAType&& RangeA, RangeBType&& RangeB, ProjectionType&& KeyProj);
+
+	// [Function #3]
+	template<int Operation, Utils::SetOperation::EAlgorithm Algorithm, typename RangeAType, typename RangeBType, typename ProjectionType, typename LessType>
+	auto SetOperationRange(RangeAType&& RangeA, RangeBType&& RangeB, ProjectionType&& KeyProj, LessType&& KeyLess);
+
 	// ===============================| Pipe operator |========================================
 
 	// --------- operator|<...>(ParentRange, ChildRangeDummy) ---------
@@ -610,7 +814,7 @@ namespace UnrealRanges{
 	// 
 	template<typename ParentRangeType, typename DummyChildRangeType>
 	auto operator | (ParentRangeType&& ParentRange, DummyChildRangeType&& ChildRangeDummy)->
-		decltype(ChildRangeDummy.Next(Private::Utils::Capture(std::forward<ParentRangeType>(ParentRange))));
+		decltype(std::forward<DummyChildRangeType>(ChildRangeDummy).Next(Private::Utils::Capture(std::forward<ParentRangeType>(ParentRange))));
 
 } // namespace UnrealRanges
 
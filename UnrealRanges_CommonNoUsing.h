@@ -7,3 +7,4 @@
 #include "UnrealRanges_Basics.h"
 #include "UnrealRanges_Common_Ranges.h"
 #include "UnrealRanges_Common_Algorithm.h"
+#include "UnrealRanges_Common_BitSet.h"
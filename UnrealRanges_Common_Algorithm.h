@@ -2,16 +2,21 @@
 
 #include <initializer_list> //for EqualsToSome<...>(...)
 
+#include "UnrealRanges_Utils_Types.h" //for "Execution::EPolicy"
+
 namespace UnrealRanges{ namespace Algorithm{
 
 
 	// ****************** !!! NB !!! ******************
-	// Current Range implementation does not support iteration
-	// over mutable values. Changing of elements got during
-	// iterations from Ranges may cause Undefined Behaviour
-	// 
-	// Mutating of Range elements will be supported in next
-	// Range implementation version
+	// Ranges that don't transform elements (filtered, reversed,
+	// stepped into, conditional and set operation ranges) give
+	// access to elements by reference to the source collection
+	// elements, without copying.
+	// 
+	// Elements may be mutated during iteration only if source
+	// collection is passed to the Range as non-const lvalue.
+	// Collections passed as rvalues are owned by Range and
+	// their elements are accessed as const
 	// ****************** !!! NB !!! ******************
 
 	
@@ -55,6 +60,12 @@ namespace UnrealRanges{ namespace Algorithm{
 	// 
 	// Check containing of Value using comparation
 	// "{RangeElement} == Value"
+	//
+	// NB: For contiguous collections ("std::vector", "TArray", C++ arrays,
+	// "std::initializer_list") of arithmetic values, enums or pointers
+	// elements are compared by SIMD instructions, 16-32 bytes at once, if
+	// "Value" has same type as elements (see "UNREAL_RANGES__SIMD" in
+	// "Private/UnrealRanges_Private_Simd.h")
 	// 
 	// ~~~~ Example ~~~~
 	//
@@ -302,6 +313,15 @@ namespace UnrealRanges{ namespace Algorithm{
 	// ...for [Function #1] - element "Proj({RangeElement}) < {Best}"
 	// ...for [Function #2] - element "Proj({RangeElement}) > {Best}"
 	//
+	// NB: Projection is called once per element, key of the best element is
+	// cached. Ranges indexable in constant time (like "std::vector" or
+	// "TArray") keep index of the best element and copy it once, other ranges
+	// copy element when better one is found.
+	// For contiguous collections ("std::vector", "TArray", C++ arrays)
+	// with projections to "int32", "float" or "double" keys are computed in
+	// blocks and reduced by SIMD instructions. Result is same as for
+	// comparisons described above (including NaN keys that are never better)
+	//
 	// ~~~~ Example ~~~~
 	//
 	//  //.[Example #1]
@@ -377,6 +397,49 @@ namespace UnrealRanges{ namespace Algorithm{
 	template <typename RangeType, typename ProjectionType>
 	auto MaxElementBy(RangeType&& Range, ProjectionType&& Proj);
 
+	// --------- MinElementsBy<...>(Range, Num, Proj) & ---------
+	//             MaxElementsBy<...>(Range, Num, Proj)
+	//
+	// IN:
+	//    (1) Range
+	//      Range to select elements from
+	//
+	//    (2) Num
+	//      Maximum number of elements to select
+	//
+	//    (3) Proj
+	//      Projection of Range (1) that is used for getting value
+	//      by wich elements are compared
+	//
+	// OUT:
+	//    {ret}
+	//        "std::vector<...>" with "Num" (or less if Range is smaller) elements...
+	//        ...for [Function #1] - with the least keys "Proj({RangeElement})"
+	//        ...for [Function #2] - with the biggest keys "Proj({RangeElement})"
+	//        Elements are sorted by keys from the best one, elements with equal
+	//        keys are kept in Range order
+	//
+	// Generalization of "MinElementBy<...>(Range, Proj)" for several elements: keys
+	// of selected elements are kept in heap of "Num" size, so Range is not copied
+	// and sorted. Projection is called once per element
+	//
+	// ~~~~ Example ~~~~
+	//
+	//  // Three Units closest to the Point
+	//  std::vector<FUnit*> ClosestUnits = MinElementsBy(Units, 3,
+	//      [&Point](const FUnit* Unit)
+	//      {
+	//          return DistanceSquared(Unit->Location, Point);
+	//      });
+	//
+	// [Function #1]
+	template <typename RangeType, typename ProjectionType>
+	auto MinElementsBy(RangeType&& Range, const int Num, ProjectionType&& Proj);
+
+	// [Function #2]
+	template <typename RangeType, typename ProjectionType>
+	auto MaxElementsBy(RangeType&& Range, const int Num, ProjectionType&& Proj);
+
 	// --------------- FindByPredicate<...>(Range, Pred) & ------------------------
 	//                   IndexByPredicate<...>(Range, Pred) 
 	//
@@ -525,6 +588,10 @@ namespace UnrealRanges{ namespace Algorithm{
 	//        unfilled "TUnrealRanges_Optional<{RangeElementType}>" if the
 	//        Range (1) has not enough elements to be accessed by the Index (2)
 	//
+	// Element is accessed in constant time if Range (1) is sized and has
+	// random access iterators (like "std::vector" or "std::vector" with
+	// "TransformedRange" applied), otherwise Range (1) is iterated
+	//
 	// ! NB: Recommended for Common Overloading. Read about Common
 	//   Overloadings at the end of "UnrealRanges_Common_Algorithm.h"
 	// 
@@ -579,11 +646,11 @@ namespace UnrealRanges{ namespace Algorithm{
 	// // taking element by index "3" requires "4" elements 
 	// 
 	// [Function #1]
-	template <typename RangeType, typename ValueType>
+	template <typename RangeType>
 	auto GetByIndex(RangeType&& Range, const unsigned int Index);
 
 	// [Function #2]
-	template <typename RangeType, typename ValueType>
+	template <typename RangeType>
 	auto GetByIndexSafe(RangeType&& Range, const unsigned int Index);
 
 	// --------- GetRangeCount<...>(Range) ---------
@@ -595,6 +662,9 @@ namespace UnrealRanges{ namespace Algorithm{
 	// OUT:
 	//    {ret}
 	//         Elements count in Range
+	//
+	// Count is got in constant time for sized ranges (see
+	// "UnrealRanges::Utils::RangeSize()"), other ranges are iterated
 	// 
 	// ~~~~ Example ~~~~
 	//
@@ -616,6 +686,11 @@ namespace UnrealRanges{ namespace Algorithm{
 	//  // Range "OddsFilteredRange" contains next elements: "1, 3, 5",
 	//  // so "PositiveOddsFilteredRangeCount" is equals to "3" 
 	//
+	//  const int SquaresCount = GetRangeCount(
+	//      InitialRange | TransformedRange([](int Number){ return Number * Number; }));
+	//  // "SquaresCount" is equals to "8", got without iteration because
+	//  // transforming keeps size of sized "InitialRange"
+	//
 	template <typename RangeType>
 	int GetRangeCount(const RangeType& Range);
 
@@ -628,6 +703,10 @@ namespace UnrealRanges{ namespace Algorithm{
 	// OUT:
 	//    {ret}
 	//         Random element of Range
+	//
+	// Sized ranges (see "UnrealRanges::Utils::RangeSize()") get element by random
+	// index, other ranges (like filtered ones) are iterated once with reservoir
+	// sampling (see "SampleK<...>(Range, Num)"), so count of elements is not needed
 	// 
 	// ! NB: Recommended for Common Overloading. Read about Common
 	//   Overloadings at the end of "UnrealRanges_Common_Algorithm.h"
@@ -643,6 +722,110 @@ namespace UnrealRanges{ namespace Algorithm{
 	template <typename RangeType>
 	auto GetRandomRangeElement(const RangeType& Range);
 
+	// --------- SampleK<...>(Range, Num) ---------
+	//
+	// IN:
+	//    (1) Range
+	//       Range to get random elements from
+	//
+	//    (2) Num
+	//       Number of elements to get
+	//
+	// OUT:
+	//    {ret}
+	//         "std::vector<...>" with "Num" random elements of Range (all
+	//         elements if Range is smaller). Each element is taken once, order
+	//         of elements is not specified
+	//
+	// Single pass reservoir sampling (Li's "Algorithm L"): number of elements to skip
+	// before next replacement in reservoir is random, so random numbers are generated
+	// only for replacements - about "Num * log({RangeCount} / Num)" times. For random
+	// access ranges skipped elements are not iterated at all
+	//
+	// ~~~~ Example ~~~~
+	//
+	//  // Three random alive Units for bonus
+	//  std::vector<FUnit*> BonusUnits = SampleK(Units | FilteredRange(IsAlive), 3);
+	//
+	template <typename RangeType>
+	auto SampleK(const RangeType& Range, const int Num);
+
+	// --------- WeightedSampleK<...>(Range, Num, WeightProj) ---------
+	//
+	// IN:
+	//    (1) Range
+	//       Range to get random elements from
+	//
+	//    (2) Num
+	//       Number of elements to get
+	//
+	//    (3) WeightProj
+	//       Projection of Range (1) element to its weight (arithmetic value)
+	//
+	// OUT:
+	//    {ret}
+	//         "std::vector<...>" with "Num" random elements of Range (less if Range
+	//         has less elements with positive weights). Each element is taken once.
+	//         Elements are ordered as if they were taken one by one, each with
+	//         probability proportional to its weight among not taken elements
+	//
+	// Single pass weighted sampling without replacement (Efraimidis-Spirakis "A-Res"):
+	// each element gets random key "log(U) / Weight", elements with "Num" biggest keys
+	// are kept in heap. Elements with not positive weights are never taken
+	//
+	// ~~~~ Example ~~~~
+	//
+	//  // Two loot items, rare items are taken less often
+	//  std::vector<FLootItem> Loot = WeightedSampleK(LootTable, 2,
+	//      [](const FLootItem& Item) { return Item.DropChance; });
+	//
+	template <typename RangeType, typename WeightProjectionType>
+	auto WeightedSampleK(const RangeType& Range, const int Num, const WeightProjectionType& WeightProj);
+
+	// --------- Shuffle<...>(Range, [Num], [RandomEngine]) ---------
+	//
+	// IN/OUT:
+	//    (1) Range
+	//       Range to shuffle. Should have random access iterators to mutable elements
+	//       (like "std::vector" or "TArray")
+	//
+	// IN:
+	//    (2) Num
+	//       Number of first elements to shuffle. If not passed, all elements are shuffled
+	//
+	//    (3) RandomEngine
+	//       Callable that returns "std::uint64_t" with 64 random bits. If not passed,
+	//       default "FRandomEngine" is used
+	//
+	// Partial Fisher-Yates shuffle: after call first "Num" elements of Range are
+	// random elements of whole Range in random order, other elements are in not
+	// specified order. Only "Num" swaps are performed, so shuffling of few elements
+	// of big Range is cheap. Elements are swapped by "swap()" (moved)
+	//
+	// Random indices are got from 32 bit parts of engine results by multiplication
+	// without division (with rare rejection to keep distribution uniform), so each
+	// engine call gives two indices
+	//
+	// ~~~~ Example ~~~~
+	//
+	//  std::vector<FCard> Deck = MakeDeck();
+	//
+	//  // Hand of five random cards - only five cards are touched
+	//  Shuffle(Deck, 5);
+	//  std::vector<FCard> Hand{ Deck.begin(), Deck.begin() + 5 };
+	//
+	// [Overloading #1]
+	template <typename RangeType>
+	void Shuffle(RangeType&& Range);
+
+	// [Overloading #2]
+	template <typename RangeType>
+	void Shuffle(RangeType&& Range, const int Num);
+
+	// [Overloading #3]
+	template <typename RangeType, typename RandomEngineType>
+	void Shuffle(RangeType&& Range, const int Num, RandomEngineType&& RandomEngine);
+
 	// ------------- RangeHasElements<...>(Range) -------------
 	//
 	// IN:
@@ -697,6 +880,9 @@ namespace UnrealRanges{ namespace Algorithm{
 	//        first (for [Function #1]) / last (for [Function #1]) Range element
 	//        or not set "TUnrealRanges_Optional<{RangeElementType}>" if "Range" is empty
 	//
+	// Last element is got in constant time if "Range" is sized and has random
+	// access iterators (see "GetByIndexSafe<...>(Range, Index)")
+	//
 	// ! NB: Recommended for Common Overloading. Read about Common
 	//   Overloadings at the end of "UnrealRanges_Common_Algorithm.h"
 	// 
@@ -773,6 +959,9 @@ namespace UnrealRanges{ namespace Algorithm{
 	// [Overloading #2] is usefull for short inline checkes of containing some value in
 	// group of specified possible values in form:
 	// "EqualsToSome(Value, { Variants_to_check , ... })"
+	//
+	// NB: Values are compared by SIMD instructions in same cases as for
+	// "Contains<...>(Range, Value)"
 	// See [Example #2] for details
 	//  
 	// ~~~~ Examples ~~~~
@@ -804,6 +993,384 @@ namespace UnrealRanges{ namespace Algorithm{
 	template<typename ValueType>
 	bool EqualsToSome(const ValueType& Value, const std::initializer_list<ValueType>& ValuesToCompare);
 
+	// ----------------- AddAllFromRange<...>(Collection, SourceRange) --------------
+	//
+	// IN/OUT:
+	//    (1) Collection
+	//       Collection to fill from Range elements
+	//
+	// IN
+	//    (1) SourceRange
+	//       Range to fill "Collection" from
+	//
+	// Fills "Collection" by elements of "SourceRange". Useful for using Ranges with
+	// old-style copy-to-collections programming. Elements are added by first
+	// available way:
+	//  - "Collection.emplace_back({RangeElement})" - for "std::vector<>", "std::deque<>"
+	//  - "Collection.insert({RangeElement})" - for "std::unordered_set<>", "std::map<>", ...
+	//  - "Collection.Add({RangeElement})" - for "TArray<>", "TSet<>", "TMap<>", ...
+	//
+	// Elements produced by the Range as temporaries (like results of
+	// "TransformedRange(...)") are moved into "Collection", elements referenced
+	// by the Range are copied
+	//
+	// For sized "SourceRange" (see "UnrealRanges::Utils::RangeSize()") memory
+	// for added elements is reserved once before adding (by "reserve()" or
+	// "Reserve()", if "Collection" has one of them). Memory is reserved only if
+	// capacity of "Collection" is not enough, and at least twice of it, so
+	// repeated adding of few elements to same collection grows it as for
+	// adding elements one by one
+	//
+	// NB: If "SourceRange" is filtered contiguous collection of trivially copyable
+	// elements, passed elements are packed by SIMD instructions and appended by
+	// blocks (by "Collection.Append(Elements, Num)" or "Collection.insert(End, ...)",
+	// if possible; see "RangeToVector<...>(Range)")
+	//  
+	// ~~~~ Example ~~~~
+	//
+	//  // Copying Range elements to set for passing to existing API function
+	// 
+	//  // Some existing API from other Module that cannot be changed
+	//  extern void SetupUnitsFromDLCSettings(const std::unordered_set<FUnit*>& Units);
+	//  
+	//  auto NeedDLCSetup = [](FUnit* Unit)
+	//	{
+	//      return Unit->IsNeedDLCSetup();
+	//	};
+	// 
+	//  std::unordered_set<FUnit*> SetForCall;
+	//  AddAllFromRange(SetForCall, Units | FilteredRange(NeedDLCSetup));
+	// 
+	//  SetupUnitsFromDLCSettings(SetForCall);
+	//
+	template<typename CollectionToFill, typename SourceRangeType>
+	void AddAllFromRange(CollectionToFill& Collection, const SourceRangeType& SourceRange);
+
+	// ------ RangeToCollection<CollectionType, ...>(Range, CollectionArgs...) ------
+	//
+	// IN:
+	//    <1> CollectionType
+	//       Type of collection to construct, with its allocator (if needed)
+	//
+	//    (1) Range
+	//       Range to copy elements from
+	//
+	//    (2...) CollectionArgs
+	//       Arguments for "CollectionType" constructor (for example, instance of
+	//       stateful allocator)
+	//
+	// OUT
+	//    {ret}
+	//         Resulting collection with elements of the Range
+	//
+	// Constructs collection of any type supported by "AddAllFromRange<...>()" and
+	// fills it from the "Range"
+	//
+	// Memory for elements is reserved once if size or upper bound of size of
+	// the "Range" is known (see "UnrealRanges::Utils::RangeMaxSize()"). For
+	// filtered ranges this may reserve more memory than actually used
+	//  
+	// ~~~~ Example ~~~~
+	//
+	//  auto NamesRange = Units | TransformedRange(&FUnit::GetName);
+	//
+	//  // Names returned by value are moved into collections
+	//  auto NamesQueue = RangeToCollection<std::deque<std::string>>(NamesRange);
+	//  auto UniqueNames = RangeToCollection<std::unordered_set<std::string>>(NamesRange);
+	//
+	//  // Stateful allocator is passed to "std::vector<>" constructor
+	//  FFrameArena Arena{ FrameMemory };
+	//  auto FrameNames = RangeToCollection<std::vector<std::string, TFrameAllocator<std::string>>>(
+	//      NamesRange, TFrameAllocator<std::string>{ Arena });
+	//
+	template<typename CollectionType, typename RangeType, typename... CollectionArgTypes>
+	CollectionType RangeToCollection(const RangeType& Range, CollectionArgTypes&&... CollectionArgs);
+
+	// ----------------------- RangeToVector<...>(Range) & -------------------------
+	//     RangeToVector<AllocatorType, ...>(Range)
+	//
+	// IN:
+	//    <1>? AllocatorType = std::allocator<...>
+	//       Optional allocator type to be passed for "std::vector<...>" that is
+	//       constructing inside function
+	// 
+	//    (1) Range
+	//       Range to copy elements from
+	//
+	// OUT
+	//    {ret}
+	//         Resulting "std::vector<...>" with elements of the Range
+	//
+	// STL analogue of "RangeToArray<...>(Range)": constructs and returns
+	// "std::vector<...>" with elements added from range passed as "Range" argument
+	// (see "RangeToCollection<...>(Range)")
+	//
+	// Memory for elements is reserved once if size or upper bound of size of
+	// the "Range" is known (see "UnrealRanges::Utils::RangeMaxSize()")
+	//
+	// NB: If "Range" is filtered contiguous collection of trivially copyable
+	// elements (like "std::vector<int> | FilteredRange(...)"), predicate is
+	// evaluated for blocks of elements and passed elements are packed by SIMD
+	// instructions and appended by blocks instead of one by one
+	//  
+	// ~~~~ Example ~~~~
+	//
+	//  std::vector<int> Damages = GetHitsDamages();
+	//
+	//  auto IsCritical = [](const int Damage) { return Damage > 100; };
+	//  std::vector<int> CriticalDamages = RangeToVector(Damages | FilteredRange(IsCritical));
+	//
+	//[Overloading #1]
+	template<typename RangeType>
+	auto RangeToVector(const RangeType& Range);
+
+	//[Overloading #2]
+	template<typename AllocatorType, typename RangeType>
+	auto RangeToVector(const RangeType& Range);
+
+	// ------ Exclude<Algorithm, ...>(VectorToExcludeFrom, RangeToExclude) & -------
+	//    ExcludeSwap<Algorithm, ...>(VectorToExcludeFrom, RangeToExclude)
+	//
+	// IN:
+	//    <1> Algorithm (optional)
+	//       Way to check if element should be excluded:
+	//        - "Scan": "RangeToExclude" is iterated for each element, no allocations.
+	//           Good for few excluded elements
+	//        - "Hashed": hash set of "RangeToExclude" elements is built once (see
+	//           "HashSet" injection). Elements should be hashable
+	//        - "Sorted": elements of "RangeToExclude" are copied and sorted once,
+	//           elements are checked by binary search. Elements should support "<"
+	//       If not passed - "Hashed" for hashable elements (see "Utils::IsHashSetKey<>()"),
+	//       "Scan" otherwise
+	//
+	// IN/OUT:
+	//    (1) VectorToExcludeFrom
+	//       "std::vector<...>" from which values of "RangeToExclude" should be excluded
+	//
+	// IN:
+	//    (2) RangeToExclude
+	//       Range with elements that should be excluded from "VectorToExcludeFrom"
+	//
+	// All elements equal to some element of "RangeToExclude" are removed. Vector is
+	// compacted in single pass - each kept element is moved at most once...
+	// ...for [Function #1] - order of kept elements is not changed
+	// ...for [Function #2] - each excluded element is replaced by the last kept one, so
+	//    only excluded elements are moved over, but order of kept elements is changed
+	//
+	// ~~~~ Example ~~~~
+	//
+	//  std::vector<FUnit*> Targets = GetTargets();
+	//  Exclude(Targets, Teammates);
+	//
+	//  // Order is not needed, small number of excluded elements
+	//  ExcludeSwap<Utils::SetOperation::Scan>(Targets, std::vector<FUnit*>{ Self });
+	//
+	// [Function #1]
+	template<Utils::SetOperation::EAlgorithm Algorithm,
+		typename ValueType, typename AllocatorType, typename RangeToExcludeType>
+	void Exclude(std::vector<ValueType, AllocatorType>& VectorToExcludeFrom, const RangeToExcludeType& RangeToExclude);
+
+	template<typename ValueType, typename AllocatorType, typename RangeToExcludeType>
+	void Exclude(std::vector<ValueType, AllocatorType>& VectorToExcludeFrom, const RangeToExcludeType& RangeToExclude);
+
+	// [Function #2]
+	template<Utils::SetOperation::EAlgorithm Algorithm,
+		typename ValueType, typename AllocatorType, typename RangeToExcludeType>
+	void ExcludeSwap(std::vector<ValueType, AllocatorType>& VectorToExcludeFrom, const RangeToExcludeType& RangeToExclude);
+
+	template<typename ValueType, typename AllocatorType, typename RangeToExcludeType>
+	void ExcludeSwap(std::vector<ValueType, AllocatorType>& VectorToExcludeFrom, const RangeToExcludeType& RangeToExclude);
+
+	// --------- ForEach<...>(Range, Func) ---------
+	//
+	// IN:
+	//    (1) Range
+	//       Range to iterate
+	//
+	//    (2) Func
+	//       Callable called as "Func({Element})" for each element in Range order
+	//
+	// Same as "for" loop over Range, but chains of filtering and transforming
+	// Ranges push elements to "Func" directly instead of iterating by nested
+	// iterators of each stage (see "UnrealRanges::Utils::RangeForEachWhile()").
+	// So chain is performed as single loop over the source collection that may
+	// be optimized (and vectorized) by compiler as hand-written loop
+	//
+	// Use "UnrealRanges::Utils::RangeForEachWhile()" to stop iterating early
+	//
+	// ~~~~ Example ~~~~
+	//
+	//  std::vector<FUnit> Units = GetUnits();
+	//
+	//  float TotalDamage = 0.f;
+	//  ForEach(Units |
+	//      FilteredRange([](const FUnit& Unit) { return Unit.bAlive; }) |
+	//      TransformedRange([](const FUnit& Unit) { return Unit.Damage * Unit.Multiplier; }),
+	//      [&TotalDamage](const float Damage)
+	//      {
+	//          TotalDamage += Damage;
+	//      });
+	//
+	template<typename RangeType, typename FuncType>
+	void ForEach(const RangeType& Range, FuncType&& Func);
+
+	// --- ForEachByDistance<DistanceQueryPredicate, ...>(Range, Point, Distance, LocationProj, Func) ---
+	//
+	// IN:
+	//    <1> DistanceQueryPredicate
+	//       Query condition, type "Logic::EDistanceQueryPredicate": "Logic::Close" to pass
+	//       elements closer than "Distance", "Logic::Far" to pass elements more far than "Distance"
+	//
+	//    (1) Range
+	//       Range to check elements of
+	//
+	//    (2) Point
+	//       Point to compute distances from. Any type with "X", "Y", "Z" fields of
+	//       same "float" or "double" type (like "FVector")
+	//
+	//    (3) Distance
+	//       Distance to compare with. Negative distance is clamped to "0"
+	//
+	//    (4) LocationProj
+	//       Callable that returns location of element as type with "X", "Y", "Z" fields
+	//
+	//    (5) Func
+	//       Callable called as "Func({Element}, {DistanceSquared})" for each passed
+	//       element in Range order
+	//
+	// Batched distance query: locations of elements are gathered by blocks into
+	// structure-of-arrays buffer and squared distances are compared by SIMD instructions.
+	// No square root is computed - use "sqrt({DistanceSquared})" in "Func" if distance
+	// is needed (so it will be computed only for passed elements)
+	//
+	// NB: Elements are copied to block buffer, so it's designed for ranges of pointers
+	// (like Actors). "Func" is called for passed elements of block after all locations of
+	// the block are got
+	//
+	// ~~~~ Example ~~~~
+	//
+	//  std::vector<FUnit*> Units = GetUnits();
+	//
+	//  ForEachByDistance<Logic::Close>(Units, ExplosionPoint, ExplosionRadius,
+	//      [](const FUnit* Unit) { return Unit->Location; },
+	//      [](FUnit* Unit, const float DistanceSquared)
+	//      {
+	//          Unit->ApplyDamage(100.f / (1.f + std::sqrt(DistanceSquared)));
+	//      });
+	//
+	template<Utils::Logic::EDistanceQueryPredicate DistanceQueryPredicate, typename RangeType,
+		typename PointType, typename DistanceType, typename LocationProjectionType, typename FuncType>
+	void ForEachByDistance(const RangeType& Range, const PointType& Point, const DistanceType Distance,
+		const LocationProjectionType& LocationProj, const FuncType& Func);
+
+	// ========================================================================
+	// ========================= Parallel execution ===========================
+	// ========================================================================
+
+	// --------- {Algorithm}<Policy, ...>(...) ---------
+	//
+	// IN:
+	//    <Policy>
+	//       Execution policy, value of "UnrealRanges::Utils::Execution::EPolicy":
+	//       "Sequenced", "Parallel" or "ParallelUnsequenced"
+	//
+	//    (...)
+	//       Same arguments as for the algorithm called without policy
+	// 
+	// OUT:
+	//    {ret}
+	//         Same result as for the algorithm called without policy. For
+	//         "ParallelUnsequenced" "FindByPredicate<>()" may return any
+	//         found element, not the first one, and collecting algorithms
+	//         may add elements in different order
+	//
+	// Overloadings of algorithms that may be performed on several threads
+	// using "Parallel" Injection (see "UnrealRanges_Common_Injection.h").
+	// Range is split to chunks processed in parallel. Searching algorithms
+	// stop processing of chunks when result is found.
+	//
+	// Parallel execution is used if:
+	//  - Range may be split without iterating (see "RangeSplit<>()" in
+	//    "UnrealRanges_Utils.h"): collections like "std::vector", "TArray"
+	//    and "std::unordered_map", and Ranges built on top of them, like
+	//    "TransformedRange()", "FilteredRange()" or "StepIntoRange()"
+	//  - Range has enough elements. Each chunk should have at least
+	//    "UNREAL_RANGES__PARALLEL_MIN_CHUNK_NUM" elements (may be defined
+	//    before including Unreal Ranges, "4096" by default). For ranges of
+	//    unknown size upper bound of size is used if it is known
+	// Otherwise algorithm is performed sequentially on calling thread
+	//
+	// Range is split to "UNREAL_RANGES__PARALLEL_PARTS_PER_WORKER" chunks
+	// per worker ("4" by default), so workers that finished their chunks
+	// earlier (for example, chunks with less elements passed filter) take
+	// remaining chunks. "GetRangeCount<>()" counts ranges of unknown size
+	// by chunks in parallel
+	//
+	// Collecting algorithms ("AddAllFromRange<>()", "RangeToCollection<>()",
+	// "RangeToVector<>()", "RangeToArray<>()") collect chunks to local buffers
+	// in parallel. Buffers are moved to the result collection in chunks order,
+	// after single reservation for exact number of collected elements. For
+	// "ParallelUnsequenced" each buffer is moved to the result under lock as
+	// soon as its chunk is collected, without waiting for previous chunks
+	//
+	// ! NB: Callables passed to the algorithms (predicates, projections)
+	//   and Range elements accessing should be safe for concurrent calls
+	// 
+	// ~~~~ Example ~~~~
+	//
+	//  std::vector<FUnitData> Units = GetAllUnits();
+	//
+	//  using namespace Execution;
+	//
+	//  const bool bHasDead = ContainsByPredicate<Parallel>(Units,
+	//      [](const FUnitData& Unit) { return Unit.Health <= 0; });
+	//
+	//  const TUnrealRanges_Optional<FUnitData> Weakest = MinElementBy<Parallel>(Units,
+	//      [](const FUnitData& Unit) { return Unit.Health; });
+	//
+	//  std::vector<FUnitData> Wounded = RangeToVector<Parallel>(Units |
+	//      FilteredRange([](const FUnitData& Unit) { return Unit.Health < Unit.MaxHealth; }));
+	//
+	// [Function #1]
+	template<Utils::Execution::EPolicy Policy, typename RangeType, typename ValueType>
+	bool Contains(RangeType&& Range, ValueType&& Value);
+
+	// [Function #2]
+	template<Utils::Execution::EPolicy Policy, typename RangeType, typename PredicateType>
+	bool ContainsByPredicate(RangeType&& Range, PredicateType&& Pred);
+
+	// [Function #3]
+	template<Utils::Execution::EPolicy Policy, typename RangeType, typename PredicateType>
+	auto FindByPredicate(RangeType&& Range, PredicateType&& Pred);
+
+	// [Function #4]
+	template<Utils::Execution::EPolicy Policy, typename RangeType, typename ProjectionType>
+	auto MinElementBy(RangeType&& Range, ProjectionType&& Proj);
+
+	// [Function #5]
+	template<Utils::Execution::EPolicy Policy, typename RangeType, typename ProjectionType>
+	auto MaxElementBy(RangeType&& Range, ProjectionType&& Proj);
+
+	// [Function #6]
+	template<Utils::Execution::EPolicy Policy, typename RangeType>
+	int GetRangeCount(const RangeType& Range);
+
+	// [Function #7]
+	template<Utils::Execution::EPolicy Policy, typename ValueType, typename RangeType>
+	bool EqualsToSome(const ValueType& Value, const RangeType& Range);
+
+	// [Function #8]
+	template<Utils::Execution::EPolicy Policy, typename CollectionToFill, typename SourceRangeType>
+	void AddAllFromRange(CollectionToFill& Collection, const SourceRangeType& SourceRange);
+
+	// [Function #9]
+	template<Utils::Execution::EPolicy Policy, typename CollectionType, typename RangeType, typename... CollectionArgTypes>
+	CollectionType RangeToCollection(const RangeType& Range, CollectionArgTypes&&... CollectionArgs);
+
+	// [Function #10]
+	template<Utils::Execution::EPolicy Policy, typename RangeType>
+	auto RangeToVector(const RangeType& Range);
+
 	// ========================================================================
 	// ======================== Common overloadings ===========================
 	// ========================================================================
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "UnrealRanges_Utils.h"
+#include "UnrealRanges_Basics.h"//for "SetOperationRange<>()" native operations
+
+namespace UnrealRanges{ namespace Utils{
+
+	// ****************** !!! NB !!! ******************
+	// Bit sets store enum values or integer IDs as bits. Set
+	// operations on them ("SetOperationRange<Operation>(A, B)")
+	// are performed word-at-a-time ("AND", "AND NOT", "OR")
+	// instead of elements comparison, and counting of elements
+	// ("Num()", "RangeSize()") uses popcount.
+	//
+	// Both bit set types are Ranges: they iterate stored elements
+	// in ascending order of their numeric values
+	// ****************** !!! NB !!! ******************
+
+	// --------- TFixedBitSet<ElementType, BitsNum> ---------
+	//
+	// IN:
+	//    <ElementType>
+	//       Enum or integer type of the elements
+	//
+	//    <BitsNum>
+	//       Size of the elements domain. Numeric values of the stored
+	//       elements should be in "[0, BitsNum)"
+	//
+	// Bit set with storage of fixed size, without allocations.
+	// Intended for small domains: enums and small integer IDs
+	//
+	// API:
+	//  - "TFixedBitSet()", "TFixedBitSet(std::initializer_list<ElementType>)"
+	//  - "void Add(ElementType)", "void Remove(ElementType)", "void Reset()"
+	//  - "bool Contains(ElementType) const"
+	//  - "int Num() const", "bool IsEmpty() const"
+	//  - "begin()", "end()"
+	//
+	// ~~~~ Example ~~~~
+	//
+	//  enum class EAbility : uint8 { Fly, Swim, Dig, Climb, Count };
+	//  using FAbilities = TFixedBitSet<EAbility, static_cast<int>(EAbility::Count)>;
+	//
+	//  const FAbilities Required{ EAbility::Fly, EAbility::Dig };
+	//  const FAbilities Unit{ EAbility::Dig, EAbility::Climb };
+	//
+	//  using namespace SetOperation;
+	//
+	//  for (const EAbility Missing : SetOperationRange<A_B>(Required, Unit))
+	//  {
+	//      // "Missing" during iterations will be equals to:
+	//      // "EAbility::Fly"
+	//      // Result is computed as "Required AND NOT Unit"
+	//  }
+	//
+	template<typename ElementType, int BitsNum>
+	class TFixedBitSet;
+
+	// --------- TSparseBitSet<ElementType> ---------
+	//
+	// IN:
+	//    <ElementType>
+	//       Enum or integer type of the elements. Numeric values of the
+	//       elements are treated as unsigned 32 bit integers
+	//
+	// Compressed bit set for big sparse domains (Roaring-like layout).
+	// Elements are grouped by high 16 bits of their values, each group
+	// stores low 16 bits as sorted array while group is small and as
+	// bitmap (8 KB) when array becomes bigger than bitmap
+	//
+	// API: same as for "TFixedBitSet<...>"
+	//
+	// ~~~~ Example ~~~~
+	//
+	//  TSparseBitSet<int> Visible{ 10, 70000, 1000000 };
+	//  TSparseBitSet<int> Hostile{ 70000, 5 };
+	//
+	//  using namespace SetOperation;
+	//
+	//  const int VisibleHostilesNum = RangeSize(SetOperationRange<AnB>(Visible, Hostile));
+	//  // "VisibleHostilesNum" is equals to "1"
+	//
+	template<typename ElementType>
+	class TSparseBitSet;
+
+	// --------- RangeToBitSet<BitSetType, ...>(Range) ---------
+	//
+	// IN:
+	//    <BitSetType>
+	//       "TFixedBitSet<...>" or "TSparseBitSet<...>" type that should be
+	//       filled by elements of Range
+	//
+	//    (1) Range
+	//       Range of enum values or integer IDs
+	//
+	// OUT:
+	//    {ret}
+	//         Bit set that contains all elements of Range
+	//
+	// ~~~~ Example ~~~~
+	//
+	//  enum class EAbility : uint8 { Fly, Swim, Dig, Climb, Count };
+	//  using FAbilities = TFixedBitSet<EAbility, static_cast<int>(EAbility::Count)>;
+	//
+	//  const FAbilities All = RangeToBitSet<FAbilities>(EnumValuesRange(EAbility::Fly, EAbility::Count));
+	//
+	template<typename BitSetType, typename RangeType>
+	BitSetType RangeToBitSet(const RangeType& Range);
+
+}}//namespace UnrealRanges::Utils
+
+#include "Private/UnrealRanges_Impl_Common_BitSet.inl"
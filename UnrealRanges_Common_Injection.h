@@ -1,5 +1,28 @@
 #pragma once
 
+// ---------------------- Contract -------------------------
+//
+// All parts of the Injection described below are required: they
+// are called by wrappers in "UnrealRanges::Utils" namespace (see
+// "UnrealRanges_Utils_Injected.h") that are compiled on including
+// of the library, even if algorithms using some part are never
+// called. Names of Injection are resolved when wrappers are
+// defined, so it is not changed by making wrappers templates
+//
+// NB: This is breaking change for Injections written for earlier
+// versions of the library (that had only "Optional", "Rand()" and
+// "Check()" parts). Such Injections should add:
+//  - "HashSet" part (used by hashed set operations and "Exclude()")
+//  - "Parallel" part (used by algorithms with parallel execution
+//    policies)
+//  - "RandFraction()" of "Random" part (used by random sampling)
+// Parts that are not needed by the project may be implemented by
+// trivial fallbacks. For example, "ParallelFor()" calling "InBody"
+// sequentially with "ParallelWorkersNum()" returning "1", and
+// "TUnrealRanges_HashSet<>" with "IsHashSetKey<>(int)" always
+// returning "false" (so hashed algorithms are never selected by
+// default; its other functions are still required to compile)
+//
 // ---------------------- Optional -------------------------
 //
 // "Optional" injection should containe functionality needed
@@ -51,12 +74,86 @@
 //      "const ValueType& GetOptionalValue(const Impl<ValueType>& InOptional)"
 //  - - - - - - - - - - - - - - - - - - - 
 //  Function [1] return the value of the optional
+//
+// ---------------------- HashSet -------------------------
+//
+// "HashSet" injection should contain functionality needed for
+// building hash indices of Range elements (keys). It is used
+// by algorithms that test element presence many times (for
+// example, "SetOperationRange<Operation, Hashed>()")
+//
+// HashSet Injection should satisfy next conditions:
+//
+// 1. Should have class: "template<typename KeyType> TUnrealRanges_HashSet"
+//  Class template (or type alias template) that stores unique keys
+//  and is default constructible
+//
+// 2. API (functions in the Injection namespace):
+//
+//  ______________________________________
+//     ~ [1] "template<typename KeyType> void HashSetReserve(
+//          TUnrealRanges_HashSet<KeyType>& InSet, int InNum)"
+//     ~ [2] "template<typename KeyType> void HashSetAdd(
+//          TUnrealRanges_HashSet<KeyType>& InSet, const KeyType& InKey)"
+//     ~ [3] "template<typename KeyType> bool HashSetContains(
+//          const TUnrealRanges_HashSet<KeyType>& InSet, const KeyType& InKey)"
+//     ~ [4] "template<typename KeyType> constexpr bool IsHashSetKey(int)"
+//  - - - - - - - - - - - - - - - - - - - 
+//  Function [1] prepares set for adding "InNum" keys
+//  Function [2] adds key to the set (does nothing if key is already added)
+//  Function [3] returns "true" if key is presented in the set
+//  Function [4] returns "true" if keys of "KeyType" may be stored in the set
+//  (are hashable). It is called with "0", so it may be overloaded for SFINAE
+//  with fallback "(...)" overload returning "false"
+//
+// ---------------------- Parallel -------------------------
+//
+// "Parallel" injection should contain functionality needed for
+// running parts of algorithms on several threads. It is used
+// by algorithms called with parallel execution policies (see
+// "UnrealRanges::Utils::Execution::EPolicy"). Usually it is an
+// adapter to the thread pool (job system) of the project
+//
+// Parallel Injection should satisfy next conditions:
+//
+//  ______________________________________
+//     ~ [1] "template<typename FunctionType> void ParallelFor(
+//          int InNum, const FunctionType& InBody)"
+//     ~ [2] "int ParallelWorkersNum()"
+//  - - - - - - - - - - - - - - - - - - - 
+//  Function [1] calls "InBody(Index)" for each "Index" in "[0, InNum)",
+//  calls may be performed concurrently. Function should return only
+//  after all calls are finished
+//  Function [2] returns number of threads that may perform "InBody"
+//  calls concurrently (including calling thread)
+//
+// ---------------------- Random -------------------------
+//
+// "Random" injection should contain random numbers generation. It
+// is used by random algorithms (like "GetRandomRangeElement()")
+//
+// Random Injection should satisfy next conditions:
+//
+//  ______________________________________
+//     ~ [1] "int Rand(int Start, int End)"
+//     ~ [2] "float RandFraction()"
+//  - - - - - - - - - - - - - - - - - - - 
+//  Function [1] returns random value in "[Start, End]" range
+//  Function [2] returns random value in "[0, 1)" range
 
 #ifndef UnrealRanges_Injection
 
 #include <cstdlib> //for "std::rand()"
+#include <cmath> //for "std::nextafter()"
+#include <algorithm> //for "std::min()"
+#include <atomic> //for "std::atomic<>"
 #include <stdexcept> //for "std::runtime_error"
 #include <type_traits> //for "std::decay_t<>"
+#include <functional> //for "std::hash<>"
+#include <unordered_set> //for "std::unordered_set<>"
+#include <utility> //for "std::declval<>()"
+#include <thread> //for "std::thread"
+#include <vector> //for "std::vector<>"
 
 namespace UnrealRanges{ namespace Injection{ namespace Default{
 
@@ -97,6 +194,85 @@ namespace UnrealRanges{ namespace Injection{ namespace Default{
 		return InOptional.Value;
 	}
 
+	// ================ HashSet ==================
+
+	template<typename KeyType>
+	using TUnrealRanges_HashSet = std::unordered_set<KeyType>;
+
+	template<typename KeyType>
+	void HashSetReserve(TUnrealRanges_HashSet<KeyType>& InSet, int InNum)
+	{
+		InSet.reserve(static_cast<size_t>(InNum));
+	}
+
+	template<typename KeyType>
+	void HashSetAdd(TUnrealRanges_HashSet<KeyType>& InSet, const KeyType& InKey)
+	{
+		InSet.insert(InKey);
+	}
+
+	template<typename KeyType>
+	bool HashSetContains(const TUnrealRanges_HashSet<KeyType>& InSet, const KeyType& InKey)
+	{
+		return InSet.find(InKey) != InSet.end();
+	}
+
+	//NB: "std::hash<>" of not hashable type is disabled (has no call operator)
+	template<typename KeyType>
+	constexpr auto IsHashSetKey(int)->decltype(std::hash<KeyType>{ }(std::declval<const KeyType&>()), bool())
+	{
+		return true;
+	}
+
+	template<typename KeyType>
+	constexpr bool IsHashSetKey(...)
+	{
+		return false;
+	}
+
+	// ================ Parallel ==================
+
+	inline int ParallelWorkersNum()
+	{
+		const unsigned int ThreadsNum = std::thread::hardware_concurrency();
+		return ThreadsNum > 0 ? static_cast<int>(ThreadsNum) : 1;
+	}
+
+	//NB: Simple fork-join without thread pool. Inject "ParallelFor()" of the
+	// project thread pool if algorithms are called in parallel frequently.
+	// Threads take indices one by one, so threads that finished their calls
+	// earlier take remaining indices
+	template<typename FunctionType>
+	void ParallelFor(int InNum, const FunctionType& InBody)
+	{
+		std::atomic<int> NextIndex{ 0 };
+
+		const auto Worker = [&InBody, &NextIndex, InNum]()
+		{
+			for (int Index = NextIndex++; Index < InNum; Index = NextIndex++)
+			{
+				InBody(Index);
+			}
+		};
+
+		const int ThreadsNum = std::min(InNum, ParallelWorkersNum());
+
+		std::vector<std::thread> Threads;
+		Threads.reserve(ThreadsNum > 1 ? static_cast<size_t>(ThreadsNum - 1) : 0);
+
+		for (int ThreadIndex = 1; ThreadIndex < ThreadsNum; ++ThreadIndex)
+		{
+			Threads.emplace_back(Worker);
+		}
+
+		Worker();
+
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+	}
+
 	// =================== Random =====================
 
 	inline int Rand(int Start, int End)
@@ -107,6 +283,13 @@ namespace UnrealRanges{ namespace Injection{ namespace Default{
 			Start;
 	}
 
+	inline float RandFraction()
+	{
+		//NB: Clamped - rounding to "float" may give "1.f" for big "RAND_MAX"
+		const float Fraction = static_cast<float>(std::rand() / (static_cast<double>(RAND_MAX) + 1.0));
+		return std::min(Fraction, std::nextafter(1.f, 0.f));
+	}
+
 	// =================== Check =====================
 
 	inline void Check(const bool bCondition)
@@ -6,12 +6,15 @@ namespace UnrealRanges{
 
 
 	// ****************** !!! NB !!! ******************
-	// Current Range implementation does not support iteration
-	// over mutable values. Changing of elements got during
-	// iterations from Ranges may cause Undefined Behaviour
+	// Ranges that don't transform elements (filtered, reversed,
+	// stepped into, conditional and set operation ranges) give
+	// access to elements by reference to the source collection
+	// elements, without copying.
 	// 
-	// Mutating of Range elements will be supported in next
-	// Range implementation version
+	// Elements may be mutated during iteration only if source
+	// collection is passed to the Range as non-const lvalue.
+	// Collections passed as rvalues are owned by Range and
+	// their elements are accessed as const
 	// ****************** !!! NB !!! ******************
 
 
@@ -213,6 +216,13 @@ namespace UnrealRanges{
 	// Form filtered range without elements that are equals to
 	// "ElementToIgnore" argument by calling "==" operator
 	//
+	// NB: Sequences of excluded elements of contiguous Parent Range
+	// ("std::vector" or pointers) of arithmetic values, enums or pointers
+	// are skipped using SIMD instructions if "ElementToIgnore" has same
+	// type as elements. When such Range of trivially copyable elements is
+	// copied to collection (see "AddAllFromRange()"), passed elements are
+	// packed by blocks, as for "FilteredRange()"
+	//
 	// ~~~~ Examples ~~~~
 	//
 	//  //.[Common example types & variables]
@@ -6,4 +6,5 @@
 
 #include "UnrealRanges_Unreal_Ranges.h"
 #include "UnrealRanges_Unreal_Algorithm.h"
+#include "UnrealRanges_Unreal_Spatial.h"
 #include "UnrealRanges_Unreal_Utils.h"
@@ -11,12 +11,15 @@ namespace UnrealRanges{ namespace Algorithm{
 
 
 	// ****************** !!! NB !!! ******************
-	// Current Range implementation does not support iteration
-	// over mutable values. Changing of elements got during
-	// iterations from Ranges may cause Undefined Behaviour
-	// 
-	// Mutating of Range elements will be supported in next
-	// Range implementation version
+	// Ranges that don't transform elements (filtered, reversed,
+	// stepped into, conditional and set operation ranges) give
+	// access to elements by reference to the source collection
+	// elements, without copying.
+	// 
+	// Elements may be mutated during iteration only if source
+	// collection is passed to the Range as non-const lvalue.
+	// Collections passed as rvalues are owned by Range and
+	// their elements are accessed as const
 	// ****************** !!! NB !!! ******************
 
 
@@ -44,15 +47,27 @@ namespace UnrealRanges{ namespace Algorithm{
 	// ****************** !!! NB !!! ******************
 
 
-	// --------- Exclude<...>(ArrayToExcludeFrom, RangeToExclude) --------
+	// --------- Exclude<Algorithm, ...>(ArrayToExcludeFrom, RangeToExclude) & --------
+	//    ExcludeSwap<Algorithm, ...>(ArrayToExcludeFrom, RangeToExclude)
 	//
 	// IN:
+	//    <1> Algorithm (optional)
+	//       Way to check if element should be excluded: "Scan", "Hashed" or "Sorted".
+	//       If not passed - "Hashed" for hashable elements, "Scan" otherwise (see
+	//       "Exclude<...>(VectorToExcludeFrom, RangeToExclude)" for details)
+	//
 	//    (1) ArrayToExcludeFrom
 	//       "TArray" from which values of "RangeToExclude" should be
 	//       excluded
 	// 
 	//    (2) RangeToExclude
 	//       Range with elements that should be excluded from "ArrayToExcludeFrom"
+	//
+	// "TArray" analogue of "Exclude<...>(VectorToExcludeFrom, RangeToExclude)": all
+	// elements equal to some element of "RangeToExclude" are removed in single
+	// compaction pass (instead of "TArray::Remove()" call for each excluded element)...
+	// ...for [Function #1] - order of kept elements is not changed
+	// ...for [Function #2] - excluded elements are replaced by the last kept ones
 	// 
 	// ~~~~ Examples ~~~~
 	// // Method that using excluding teammates from the array
@@ -89,9 +104,22 @@ namespace UnrealRanges{ namespace Algorithm{
 	//     // ...
 	// };
 	//
+	// [Function #1]
+	template <Utils::SetOperation::EAlgorithm Algorithm,
+		typename ValueType, typename AllocatorType, typename RangeToExcludeType>
+	void Exclude(TArray<ValueType, AllocatorType>& ArrayToExcludeFrom, const RangeToExcludeType& RangeToExclude);
+
 	template <typename ValueType, typename AllocatorType, typename RangeToExcludeType>
 	void Exclude(TArray<ValueType, AllocatorType>& ArrayToExcludeFrom, const RangeToExcludeType& RangeToExclude);
 
+	// [Function #2]
+	template <Utils::SetOperation::EAlgorithm Algorithm,
+		typename ValueType, typename AllocatorType, typename RangeToExcludeType>
+	void ExcludeSwap(TArray<ValueType, AllocatorType>& ArrayToExcludeFrom, const RangeToExcludeType& RangeToExclude);
+
+	template <typename ValueType, typename AllocatorType, typename RangeToExcludeType>
+	void ExcludeSwap(TArray<ValueType, AllocatorType>& ArrayToExcludeFrom, const RangeToExcludeType& RangeToExclude);
+
 	// ------ ClosestActorWithDistance<...>(Point, Range) &     -------
 	//    ClosestActorWithDistance<...>(Point, RadiusLimit, Range)
 	//
@@ -114,6 +142,9 @@ namespace UnrealRanges{ namespace Algorithm{
 	//         then "RadiusLimit" or Range is empty -
 	//         returned optional will be not set
 	//
+	// If "Range" is spatial grid (see "TActorsSpatialGrid<>"), only cells
+	// around "Point" are checked, from closer cells to more far ones
+	//
 	// !NB: Function is not testing Elements validity of Range. You
 	//  should validate input range by yourself - for example, using
 	//  "... | ValidRange()" for range that should be passed to Functions
@@ -237,16 +268,161 @@ namespace UnrealRanges{ namespace Algorithm{
 	template<typename RangeType>
 	auto ClosestActor(const FVector& Point, const float RadiusLimit, RangeType&& Range);
 
+	// ------ ClosestActorsWithDistance<...>(Point, Num, Range) &     -------
+	//    ClosestActorsWithDistance<...>(Point, Num, RadiusLimit, Range)
+	//
+	// IN:
+	//    (1) Point
+	//       Point to compute distances to Range Actors from
+	//
+	//    (2) Num
+	//       Maximum number of Actors to find
+	//
+	//    (3) RadiusLimit
+	//       Radius in witch Actors should be found
+	//
+	//    (4) Range
+	//       Range of Actors from witch distances to Point should be computed
+	//
+	// OUT:
+	//    {ret}
+	//         "TArray< TPair<Distance, Actor*> >" with up to "Num" nearest
+	//         Actors and distances to them, sorted from the nearest one
+	//
+	// Generalization of "ClosestActorWithDistance<...>()" for several Actors. Squared
+	// distances of found Actors are kept in heap of "Num" size (see "MinElementsBy()"),
+	// so Range is not copied and sorted. Square root is computed only for found Actors.
+	// For any other projection than Actor location use "MinElementsBy()" directly
+	//
+	// If "Range" is spatial grid (see "TActorsSpatialGrid<>"), cells around "Point" are
+	// checked from closer cells to more far ones until found Actors are closer than
+	// Actors of unchecked cells may be
+	//
+	// !NB: Function is not testing Elements validity of Range (see "ClosestActorWithDistance<...>()")
+	//
+	// [Overloading #1]
+	template<typename RangeType>
+	auto ClosestActorsWithDistance(const FVector& Point, const int32 Num, RangeType&& Range);
+
+	// [Overloading #2]
+	template<typename RangeType>
+	auto ClosestActorsWithDistance(const FVector& Point, const int32 Num, const float RadiusLimit, RangeType&& Range);
+
+	// ------ ClosestActors<...>(Point, Num, Range) & ClosestActors<...>(Point, Num, RadiusLimit, Range) &  -------
+	//    ClosestActors<Num, ...>(Point, Range) & ClosestActors<Num, ...>(Point, RadiusLimit, Range)
+	//
+	// IN:
+	//    <1> Num (for [Overloading #3] and [Overloading #4])
+	//       Maximum number of Actors to find, known at compile time
+	//
+	//    (1) Point
+	//       Point to compute distances to Range Actors from
+	//
+	//    (2) Num (for [Overloading #1] and [Overloading #2])
+	//       Maximum number of Actors to find
+	//
+	//    (3) RadiusLimit
+	//       Radius in witch Actors should be found
+	//
+	//    (4) Range
+	//       Range of Actors from witch distances to Point should be computed
+	//
+	// OUT:
+	//    {ret}
+	//         "TArray<Actor*>" with up to "Num" nearest Actors sorted from the
+	//         nearest one. For [Overloading #3] and [Overloading #4] array uses
+	//         "TInlineAllocator<Num>", so result is not allocated on heap
+	//
+	// Same as "ClosestActorsWithDistance<...>()", but without distances
+	//
+	// ~~~~ Example ~~~~
+	//
+	//  // Turret shoots three closest enemies in its range
+	//  for (AGameUnit* Target : ClosestActors<3>(Turret->GetActorLocation(), Turret->Range, EnemiesRange))
+	//  {
+	//      Turret->Shoot(Target);
+	//  }
+	//
+	// [Overloading #1]
+	template<typename RangeType>
+	auto ClosestActors(const FVector& Point, const int32 Num, RangeType&& Range);
+
+	// [Overloading #2]
+	template<typename RangeType>
+	auto ClosestActors(const FVector& Point, const int32 Num, const float RadiusLimit, RangeType&& Range);
+
+	// [Overloading #3]
+	template<int32 Num, typename RangeType>
+	auto ClosestActors(const FVector& Point, RangeType&& Range);
+
+	// [Overloading #4]
+	template<int32 Num, typename RangeType>
+	auto ClosestActors(const FVector& Point, const float RadiusLimit, RangeType&& Range);
+
+	// ------ ActorsFilterByDistanceToArray<DistanceQueryPredicate, ...>(Point, Distance, Range) &  -------
+	//    ActorsWithDistanceFilterByDistanceToArray<DistanceQueryPredicate, ...>(Point, Distance, Range)
+	//
+	// IN:
+	//    <1> DistanceQueryPredicate
+	//       Enum that setup query condition, type "Logic::EDistanceQueryPredicate":
+	//       If equals to "Logic::Close" then collects Actors closer then "Distance"
+	//       If equals to "Logic::Far" then collects Actors more far then "Distance"
+	// 
+	//    (1) Point
+	//       Point to compute distances to Range Actors from
+	// 
+	//    (2) Distance
+	//       Distance to Actors
+	// 
+	//    (3) Range
+	//       Range of Actors to check
+	// 
+	// OUT:
+	//    {ret}
+	//         "TArray<Actor*>" for [Function #1] or "TArray<TPair<Distance {float}, Actor*>>"
+	//         for [Function #2] with passed Actors in Range order
+	//
+	// Batched versions of "Range | ActorsFilterByDistance<...>(Point, Distance)" and
+	// "Range | ActorsWithDistanceFilterByDistance<...>(Point, Distance)" collected to array.
+	// Actor locations are gathered by blocks and squared distances are compared by SIMD
+	// instructions (see "ForEachByDistance<...>(...)"). Square root is computed only for
+	// passed Actors in [Function #2]
+	//
+	// !NB: Function is not testing Elements validity of Range. You
+	//  should validate input range by yourself - for example, using
+	//  "... | ValidRange()" for range that should be passed to Functions
+	//  and may contain invalid elements
+	// 
+	// ~~~~ Example ~~~~
+	//
+	//  const float BuffApplyRadius = 1000.f;
+	//  const FVector BuffApplyPoint{ 500.f, 500.f, 500.f };
+	// 
+	//  TArray<AGameUnit*> UnitsToBuff =
+	//      ActorsFilterByDistanceToArray(BuffApplyPoint, BuffApplyRadius, ActorsRange<AGameUnit>(World));
+	// 
+	// [Function #1]
+	template<Utils::Logic::EDistanceQueryPredicate DistanceQueryPredicate = Utils::Logic::Close, typename RangeType>
+	auto ActorsFilterByDistanceToArray(const FVector& Point, const float Distance, const RangeType& Range);
+
+	// [Function #2]
+	template<Utils::Logic::EDistanceQueryPredicate DistanceQueryPredicate = Utils::Logic::Close, typename RangeType>
+	auto ActorsWithDistanceFilterByDistanceToArray(const FVector& Point, const float Distance, const RangeType& Range);
+
 	// ------ Shuffle<...>(RangeToShuffle, ElementsNumToShuffle) -------
 	//
 	// IN/OUT:
 	//    (1) RangeToShuffle
-	//       Range to shuffle. Currently only generalized "TArray" is supported
+	//       Array to shuffle
 	// 
 	// IN
 	//    (1) ElementsNumToShuffle
 	//       Num of elements from range to Shuffle
 	//
+	// "TArray" overloading of "Shuffle<...>(Range, Num)" (see "UnrealRanges_Common_Algorithm.h"):
+	// first "ElementsNumToShuffle" elements become random elements of whole array, only
+	// "ElementsNumToShuffle" swaps are performed
+	//
 	// ~~~~ Example ~~~~
 	// 
 	// // Shuffling the Deck of cards
@@ -273,45 +449,6 @@ namespace UnrealRanges{ namespace Algorithm{
 	template <typename ElementType, typename Allocator>
 	void Shuffle(TArray<ElementType, Allocator>& ArrayToShuffle, const TOptional<int32>& ElementsNumToShuffle = {});
 
-	// ----------------- AddAllFromRange<...>(Collection, SourceRange) --------------
-	//
-	// IN/OUT:
-	//    (1) Collection
-	//       Collection to fill from Range elements
-	//
-	// IN
-	//    (1) SourceRange
-	//       Range to fill "Collection" from
-	//
-	// Fills "Collection" by calling "Collection.Add({RangeElement})". Useful for
-	// using Ranges with old-style copy-to-collections programming
-	//  
-	// ~~~~ Example ~~~~
-	//
-	//  // Copying Range elements to set for passing to existing API function
-	// 
-	//  // Some existing API from other Module that cannot be changed
-	//  extern void SetupActorsFromDLCSettings(const TSet<AActor*>& Actors);
-	//  
-	//  auto NeedDLCSetup = [](AGameUnit* GameUnit)
-	//	{
-	//      return GameUnit->IsNeedDLCSetup();
-	//	};
-	// 
-	//  // Read about "ActorsRange<...>(...)" below, in "Unreal specific ranges" section
-	//  auto UnitsRangeForSetup = ActorsRange<AGameUnit>(World) | FilteredRange(&NeedDLCSetup);
-	//
-	//  // This call is correct: it's possible to call "SetForCall.Add({AGameUnit*})"
-	//  // because upcasting "AGameUnit -> AActor" may be performed
-	//  TSet<AActor*> SetForCall;
-	//  AddAllFromRange(SetForCall, UnitsRangeForSetup);
-	// 
-	//  // Pass collection "TSet<AActor*>" expected by external API
-	//  SetupActorsFromDLCSettings(SetForCall);
-	//
-	template<typename CollectionToFill, typename SourceRangeType>
-	void AddAllFromRange(CollectionToFill& Collection, const SourceRangeType& SourceRange);
-
 	// ----------------- RangeToArray<...>(Range) &   ----------------------
 	//     RangeToArray<ArrayAllocatorType, ...>(Range)
 	//
@@ -328,7 +465,16 @@ namespace UnrealRanges{ namespace Algorithm{
 	//         Resulting "TArray<...>" with elements added from the Range
 	//
 	// Constructing and return "TArray<...>" with elements added from range
-	// passed as "Range" argument
+	// passed as "Range" argument (see "RangeToCollection<...>(Range)", that
+	// also may be used for "TSet<>" and "TMap<>")
+	//
+	// Memory for elements is reserved once if size or upper bound of size of
+	// the "Range" is known (see "UnrealRanges::Utils::RangeMaxSize()"). For
+	// filtered ranges this may reserve more memory than actually used
+	//
+	// NB: Elements are added by "AddAllFromRange<...>(Collection, SourceRange)", so
+	// filtered contiguous collections are compacted by SIMD instructions and
+	// temporary elements of the Range are moved
 	//  
 	// ~~~~ Examples ~~~~
 	//
@@ -405,6 +551,29 @@ namespace UnrealRanges{ namespace Algorithm{
 	template<typename ArrayAllocatorType, typename RangeType>
 	auto RangeToArray(const RangeType& Range);
 
+	// --------- RangeToArray<Policy, ...>(Range) & -----------
+	//     RangeToArray<Policy, ArrayAllocatorType, ...>(Range)
+	//
+	// Overloadings of "RangeToArray<...>(Range)" with execution policy: elements
+	// are collected in parallel (see "Parallel execution" section in
+	// "UnrealRanges_Common_Algorithm.h")
+	//
+	// ~~~~ Example ~~~~
+	//
+	//  using namespace Execution;
+	//
+	//  TArray<FVector> DangerousPoints = RangeToArray<Parallel>(Projectiles |
+	//      FilteredRange(&FProjectile::IsExplosive) |
+	//      TransformedRange(&FProjectile::GetImpactPoint));
+	//
+	//[Overloading #3]
+	template<Utils::Execution::EPolicy Policy, typename RangeType>
+	auto RangeToArray(const RangeType& Range);
+
+	//[Overloading #4]
+	template<Utils::Execution::EPolicy Policy, typename ArrayAllocatorType, typename RangeType>
+	auto RangeToArray(const RangeType& Range);
+
 	// ====================================================================
 	// ====================== Common overloadings =========================
 	// ====================================================================
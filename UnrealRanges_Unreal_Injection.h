@@ -3,9 +3,14 @@
 #ifndef UnrealRanges_Injection
 
 #include "Misc/Optional.h"
+#include "Containers/Set.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"//for "FTaskGraphInterface"
 #include "Templates/UnrealTemplate.h"//for Forward<>()
 #include "Misc/AssertionMacros.h"//for check()
 
+#include <utility>//for "std::declval<>()"
+
 namespace UnrealRanges{ namespace Injection{ namespace Unreal{
 
 	// ======================= Optional ============================
@@ -33,6 +38,55 @@ namespace UnrealRanges{ namespace Injection{ namespace Unreal{
 		return InOptional.GetValue();
 	}
 
+	// ======================= HashSet ============================
+
+	template<typename KeyType>
+	using TUnrealRanges_HashSet = TSet<KeyType>;
+
+	template<typename KeyType>
+	void HashSetReserve(TUnrealRanges_HashSet<KeyType>& InSet, int InNum)
+	{
+		InSet.Reserve(InNum);
+	}
+
+	template<typename KeyType>
+	void HashSetAdd(TUnrealRanges_HashSet<KeyType>& InSet, const KeyType& InKey)
+	{
+		InSet.Add(InKey);
+	}
+
+	template<typename KeyType>
+	bool HashSetContains(const TUnrealRanges_HashSet<KeyType>& InSet, const KeyType& InKey)
+	{
+		return InSet.Contains(InKey);
+	}
+
+	template<typename KeyType>
+	constexpr auto IsHashSetKey(int)->decltype(GetTypeHash(std::declval<const KeyType&>()), bool())
+	{
+		return true;
+	}
+
+	template<typename KeyType>
+	constexpr bool IsHashSetKey(...)
+	{
+		return false;
+	}
+
+	// ======================= Parallel ============================
+
+	template<typename FunctionType>
+	void ParallelFor(int InNum, const FunctionType& InBody)
+	{
+		::ParallelFor(InNum, [&InBody](int32 Index) { InBody(static_cast<int>(Index)); });
+	}
+
+	inline int ParallelWorkersNum()
+	{
+		//NB: Calling thread takes part in "ParallelFor()" too
+		return FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+	}
+
 	// =================== Random =====================
 
 	inline int Rand(int Start, int End)
@@ -46,6 +100,12 @@ namespace UnrealRanges{ namespace Injection{ namespace Unreal{
 		);
 	}
 
+	inline float RandFraction()
+	{
+		//NB: Clamped - "FMath::FRand()" may return "1.f" in some engine versions
+		return FMath::Min(FMath::FRand(), 0.99999994f);
+	}
+
 	// =================== Check ======================
 
 #	define UNREAL_RANGES__DEBUG DO_CHECK //setup from Unreal
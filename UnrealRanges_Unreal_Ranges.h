@@ -1,5 +1,7 @@
 #pragma once
 
+#include "UnrealRanges_Utils_Types.h"//for "Logic::EDistanceQueryPredicate"
+
 //Unreal
 #include "Engine/World.h"// for ActorsRange<>()
 #include "Math/UnrealMathUtility.h"//for FVector usages
@@ -8,12 +10,15 @@ namespace UnrealRanges{
 
 
 	// ****************** !!! NB !!! ******************
-	// Current Range implementation does not support iteration
-	// over mutable values. Changing of elements got during
-	// iterations from Ranges may cause Undefined Behaviour
-	// 
-	// Mutating of Range elements will be supported in next
-	// Range implementation version
+	// Ranges that don't transform elements (filtered, reversed,
+	// stepped into, conditional and set operation ranges) give
+	// access to elements by reference to the source collection
+	// elements, without copying.
+	// 
+	// Elements may be mutated during iteration only if source
+	// collection is passed to the Range as non-const lvalue.
+	// Collections passed as rvalues are owned by Range and
+	// their elements are accessed as const
 	// ****************** !!! NB !!! ******************
 
 
@@ -477,17 +482,12 @@ namespace UnrealRanges{
 	//  }
 	// 
 	// [Type #1]
-	
-	namespace Utils{ namespace Logic{
-
-		enum EDistanceQueryPredicate
-		{
-			Close,
-			Far
-		};
-
-	}} //namespace ::Utils::Logic
-
+	// "Utils::Logic::EDistanceQueryPredicate" is declared in "UnrealRanges_Utils_Types.h"
+	//
+	// NB: Distances are compared squared, square root is computed only for Actors
+	// that passed the filter in [Function #2]. For big Ranges collected to arrays
+	// see batched "ActorsFilterByDistanceToArray<...>(Point, Distance, Range)"
+	//
 	// [Function #1]
 	template<Utils::Logic::EDistanceQueryPredicate DistanceQueryPredicate = Utils::Logic::Close>
 	auto ActorsFilterByDistance(const FVector& Point, const float Distance);
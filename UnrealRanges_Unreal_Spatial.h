@@ -0,0 +1,153 @@
+#pragma once
+
+#include "UnrealRanges_Utils.h"
+
+//Unreal
+#include "GameFramework/Actor.h"
+#include "Math/Box.h"
+#include "Math/Vector.h"
+
+namespace UnrealRanges{ namespace Utils{
+
+	// ****************** !!! NB !!! ******************
+	// Spatial grid stores Actors in cells of uniform grid by
+	// their locations, so spatial queries check only Actors of
+	// cells near to query shape instead of iterating over all
+	// Actors of the World (as "ActorsRange<>() | ..." does).
+	//
+	// Grid stores locations of Actors got on adding/updating:
+	// Actors that are moved should be updated explicitly (see
+	// "Update()" and "UpdateAll()"), destroyed Actors should be
+	// removed (see "Remove()" and "RemoveInvalid()")
+	// ****************** !!! NB !!! ******************
+
+	// --------- TActorsSpatialGrid<ActorType> ---------
+	//
+	// IN:
+	//    <ActorType> = AActor
+	//       Type of stored Actors
+	//
+	// Hash grid of Actors. Only occupied cells are stored. Cell size should
+	// be about typical query radius: smaller cells make queries check less
+	// Actors, but more cells
+	//
+	// API:
+	//  - "TActorsSpatialGrid(float CellSize = 1000.f)"
+	//  - "void Add(ActorType*)", "void AddAll(Range)" - adds Actors with their current
+	//     locations (or updates locations of already added Actors)
+	//  - "bool Update(ActorType*)" - updates location of Actor, moves it to other cell
+	//     only if cell is changed. Returns "false" if Actor is not added
+	//  - "void UpdateAll()" - updates locations of all moved Actors
+	//  - "bool Remove(ActorType*)", "void RemoveInvalid()", "void Reset()"
+	//  - "int32 Num() const"
+	//
+	// Queries (Ranges of "ActorType*" that may be used with "|" as other Ranges):
+	//  - "SphereRange(Center, Radius)" - Actors closer than "Radius" to "Center"
+	//  - "BoxRange(Box)" - Actors inside "FBox" (borders are included)
+	//  - "ConeRange(Apex, Direction, HalfAngleRadians, Length)" - Actors closer than
+	//     "Length" to "Apex" with angle between "Direction" and direction to Actor not
+	//     bigger than "HalfAngleRadians"
+	//
+	// Order of Actors in query Ranges is not specified. Grid should not be changed
+	// while its query Ranges are used
+	//
+	// Grid may be passed as Range to "ClosestActor<...>()", "ClosestActors<...>()",
+	// "ClosestActorWithDistance<...>()" and "ClosestActorsWithDistance<...>()": in such
+	// case closest Actors are searched in cells around the Point, from closer cells to
+	// more far ones
+	//
+	// ~~~~ Example ~~~~
+	//
+	//  // Member of some server subsystem, filled once and updated each tick
+	//  TActorsSpatialGrid<AGameUnit> UnitsGrid{ 2000.f };
+	//
+	//  void UUnitsSubsystem::Initialize()
+	//  {
+	//      UnitsGrid.AddAll(ActorsRange<AGameUnit>(GetWorld()));
+	//  }
+	//
+	//  void UUnitsSubsystem::Tick(float DeltaTime)
+	//  {
+	//      UnitsGrid.RemoveInvalid();
+	//      UnitsGrid.UpdateAll();
+	//
+	//      for (AGameUnit* Unit : UnitsGrid.SphereRange(ExplosionPoint, 500.f) | ValidRange())
+	//      {
+	//          Unit->ApplyDamage(100.f);
+	//      }
+	//
+	//      AGameUnit* ClosestUnit = ClosestActor(PlayerLocation, 3000.f, UnitsGrid);
+	//  }
+	//
+	template<typename ActorType = AActor>
+	class TActorsSpatialGrid;
+
+	// --------- TClosestActorQuery<ActorType> ---------
+	//
+	// IN:
+	//    <ActorType> = AActor
+	//       Type of found Actors
+	//
+	// Cache for "ClosestActor<...>(Point, RadiusLimit, Range)" repeated for same querier
+	// (for example, each tick): querier moves a little between queries, so closest Actor
+	// is rarely changed. Previous Actor is re-validated directly (it should be valid and
+	// inside "RadiusLimit" at its current location) and distance to it is used as upper
+	// bound of next query. Result is same as for not cached query
+	//
+	// Bound is used for pruning only for Ranges that check less Actors for smaller radius
+	// (like "TActorsSpatialGrid<>", that checks less cells): query is performed in the bound
+	// first, and query in "RadiusLimit" is performed only if bounded query found nothing
+	// (previous Actor is destroyed, left the Range or moved out of "RadiusLimit"). Other
+	// Ranges are queried once in "RadiusLimit" (distances to all Actors are computed
+	// anyway), for them the bound is used only for statistics
+	//
+	// API:
+	//  - "ActorType* Find(Point, Range)", "ActorType* Find(Point, RadiusLimit, Range)"
+	//  - "ActorType* GetPrevious() const" - result of the last query
+	//  - "void Reset()" - forgets previous result, so next query will be full
+	//  - "const FClosestActorQueryStats& GetStats() const", "void ResetStats()"
+	//
+	// ~~~~ Example ~~~~
+	//
+	//  // Member of AI controller
+	//  TClosestActorQuery<AGameUnit> TargetQuery;
+	//
+	//  void AUnitAIController::Tick(float DeltaTime)
+	//  {
+	//      AGameUnit* Target = TargetQuery.Find(GetPawn()->GetActorLocation(), AttackRadius, EnemiesGrid);
+	//      ...
+	//  }
+	//
+	//  // Later, for tuning:
+	//  UE_LOG(LogAI, Log, TEXT("Target query hit rate: %f"), TargetQuery.GetStats().GetHitRate());
+	//
+	template<typename ActorType = AActor>
+	class TClosestActorQuery;
+
+	// Statistics of "TClosestActorQuery<>" queries
+	struct FClosestActorQueryStats
+	{
+		// All queries
+		int32 QueriesNum = 0;
+
+		// Queries which result was found inside the bound got from previous Actor
+		int32 BoundedQueriesNum = 0;
+
+		// Queries with same result as previous query
+		int32 SameResultsNum = 0;
+
+		// Queries which result was not found inside the bound (including queries without
+		// previous result). For Ranges with radius pruning such queries needed second query
+		// in "RadiusLimit"
+		int32 FullQueriesNum = 0;
+
+		// Part of queries which result was found inside the bound
+		float GetHitRate() const
+		{
+			return QueriesNum > 0 ? static_cast<float>(BoundedQueriesNum) / QueriesNum : 0.f;
+		}
+	};
+
+}} //namespace UnrealRanges::Utils
+
+#include "Private/UnrealRanges_Impl_Unreal_Spatial.inl"
@@ -1,9 +1,11 @@
 #pragma once
 
 #include "UnrealRanges_Utils_Injected.h"
+#include "UnrealRanges_Utils_Types.h"//before details: for "TRangePart<>"
+
 #include "Private/UnrealRanges_Utils_Details.h"
 
-#include "UnrealRanges_Utils_Types.h"
+#include <cstdint>//for "FRandomEngine" results
 
 namespace std
 {
@@ -15,12 +17,15 @@ namespace UnrealRanges{ namespace Utils{
 
 
 	// ****************** !!! NB !!! ******************
-	// Current Range implementation does not support iteration
-	// over mutable values. Changing of elements got during
-	// iterations from Ranges may cause Undefined Behaviour
-	// 
-	// Mutating of Range elements will be supported in next
-	// Range implementation version
+	// Ranges that don't transform elements (filtered, reversed,
+	// stepped into, conditional and set operation ranges) give
+	// access to elements by reference to the source collection
+	// elements, without copying.
+	// 
+	// Elements may be mutated during iteration only if source
+	// collection is passed to the Range as non-const lvalue.
+	// Collections passed as rvalues are owned by Range and
+	// their elements are accessed as const
 	// ****************** !!! NB !!! ******************
 
 
@@ -165,6 +170,8 @@ namespace UnrealRanges{ namespace Utils{
 	// - Collections that has both "begin/end()" method and
 	//   "begin/end(collection)" free functions (like "std::vector")
 	//   prefering method variant over function variant
+	// Constness of passed range is kept: for non-const ranges
+	// mutable iterators are returned
 	// 
 	// ~~~~ Example ~~~~ 
 	// 
@@ -196,11 +203,233 @@ namespace UnrealRanges{ namespace Utils{
 	// 
 	// [Function #1]
 	template<typename RangeType>
-	auto RangeBegin(const RangeType& Range)->decltype(TemplateDetails::RangeBegin::_(Range, 0));
+	auto RangeBegin(RangeType&& Range)->decltype(TemplateDetails::RangeBegin::_(Range, 0));
 
 	// [Function #2]
 	template<typename RangeType>
-	auto RangeEnd(const RangeType& Range)->decltype(TemplateDetails::RangeEnd::_(Range, 0));
+	auto RangeEnd(RangeType&& Range)->decltype(TemplateDetails::RangeEnd::_(Range, 0));
+
+	// =============================================================
+	// ===================== Universal Size ========================
+	// =============================================================
+
+	// --------- RangeSize<>(Range) and IsSizedRange<RangeType>() ---------
+	//
+	// IN:
+	//    <1> RangeType
+	//       Type of range to check
+	//
+	//    (1) Range
+	//       Range to get number of elements of
+	//
+	// OUT:
+	//    {ret}
+	//         For [Funcion #1] - Number of elements of passed range
+	//         For [Funcion #2] - "true" if "RangeSize()" may be called
+	//          for range of "RangeType" type
+	//
+	// Universal function for getting number of range elements in
+	// constant time, without iterating over the range. Supported:
+	// - C++ arrays
+	// - Collections with "size()" method (like "std::vector")
+	// - Collections with "Num()" method (like "TArray")
+	// - Ranges of this library that know their size by construction
+	//   (see "Size()" methods of ranges in "UnrealRanges_Basics.h")
+	//
+	// Call is not compiled for ranges that cannot get their size
+	// without iteration, so it may be used for SFINAE checks
+	//
+	// ~~~~ Example ~~~~
+	//
+	//  std::vector<int> Numbers{ 1, 2, 3, 4 };
+	//
+	//  auto Squares = Numbers | TransformedRange([](int Value) { return Value * Value; });
+	//  auto Evens = Numbers | FilteredRange([](int Value) { return Value % 2 == 0; });
+	//
+	//  const int SquaresNum = RangeSize(Squares);
+	//  // "SquaresNum" is equals to "4", without calls of transform lambda
+	//
+	//  // RangeSize(Evens);
+	//  // Line above will not compile: number of filtered elements is unknown
+	//  // "IsSizedRange<decltype(Evens)>()" is "false"
+	//
+	// [Function #1]
+	template<typename RangeType>
+	auto RangeSize(const RangeType& Range)->decltype(TemplateDetails::RangeSize::_(Range, 0));
+
+	// [Function #2]
+	template<typename RangeType>
+	constexpr bool IsSizedRange();
+
+	// --------- RangeMaxSize<>(Range) and IsMaxSizedRange<RangeType>() ---------
+	//
+	// Same as "RangeSize<>(Range)" and "IsSizedRange<RangeType>()", but provides
+	// upper bound of number of range elements. It is available for all sized
+	// ranges (returns exact size) and for ranges with "MaxSize()" method (like
+	// filtered ranges over sized ranges)
+	//
+	// Useful as reservation hint for collecting range elements
+	//
+	// [Function #1]
+	template<typename RangeType>
+	auto RangeMaxSize(const RangeType& Range)->decltype(TemplateDetails::RangeMaxSize::_(Range, 0));
+
+	// [Function #2]
+	template<typename RangeType>
+	constexpr bool IsMaxSizedRange();
+
+	// =============================================================
+	// ==================== Universal Split ========================
+	// =============================================================
+
+	// --------- RangeSplit<>(Range, PartsNum), IsSplittableRange<RangeType>() and IsOrderedSplitRange<RangeType>() ---------
+	//
+	// IN:
+	//    <1> RangeType
+	//       Type of range to check
+	//
+	//    (1) Range
+	//       Range to split
+	//
+	//    (2) PartsNum
+	//       Desired number of parts
+	//
+	// OUT:
+	//    {ret}
+	//         For [Funcion #1] - "std::vector" of non-overlapping Ranges that
+	//          together contain all elements of passed range. Number of parts
+	//          is not more than "PartsNum" (may be less for small ranges), parts
+	//          may be empty
+	//         For [Funcion #2] - "true" if "RangeSplit()" may be called
+	//          for range of "RangeType" type
+	//         For [Funcion #3] - "true" if range of "RangeType" type is
+	//          splittable and its parts follow each other in Range order
+	//
+	// Universal function for splitting of range to parts that may be iterated
+	// independently (for example, on different threads). Splitting doesn't
+	// iterate elements. Supported:
+	// - Sized ranges with random access iterators (like "std::vector",
+	//   "TArray", or "TransformedRange()" of them). Parts are "TRangePart<>"
+	//   with equal numbers of elements
+	// - Hash containers with buckets interface (like "std::unordered_map").
+	//   Parts are "TRangePart<>" over groups of buckets. Order of buckets
+	//   differs from iteration order of container, so parts don't follow
+	//   each other in Range order (and Ranges built on top of such parts too)
+	// - Ranges with "Split(int PartsNum) const" method that returns
+	//   "std::vector" of parts. Ranges of this library built on top of
+	//   splittable ranges split their parent range and apply themselves to
+	//   each of parent range parts (see "Split()" methods of ranges in
+	//   "UnrealRanges_Basics.h"). So filtered range of "std::vector" or range
+	//   that steps into elements of "std::unordered_map" are splittable
+	//
+	// Call is not compiled for ranges that cannot be split, so it may be used
+	// for SFINAE checks
+	//
+	// ~~~~ Example ~~~~
+	//
+	//  std::unordered_map<int, FUnitData> Units = GetAllUnits();
+	//
+	//  auto Alive = Units | FilteredRange([](const auto& Pair) { return Pair.second.Health > 0; });
+	//
+	//  for (const auto& AlivePart : RangeSplit(Alive, 4))
+	//  {
+	//      // Each "AlivePart" is filtered range of some buckets of "Units"
+	//  }
+	//
+	// [Function #1]
+	template<typename RangeType>
+	auto RangeSplit(const RangeType& Range, int PartsNum)->decltype(TemplateDetails::RangeSplit::_(Range, PartsNum, 0, 0));
+
+	// [Function #2]
+	template<typename RangeType>
+	constexpr bool IsSplittableRange();
+
+	// [Function #3]
+	template<typename RangeType>
+	constexpr bool IsOrderedSplitRange();
+
+	// =============================================================
+	// ==================== Universal Visit ========================
+	// =============================================================
+
+	// --------- RangeVisit<>(Range, Func) ---------
+	//
+	// IN:
+	//    (1) Range
+	//       Range to visit
+	//
+	//    (2) Func
+	//       Callable that accepts Range (or one of Ranges used by it)
+	//
+	// OUT:
+	//    {ret}
+	//         Result of "Func" call
+	//
+	// Calls "Func({Range})". For ranges that choose used range in runtime (ranges
+	// with "Visit(Func)" method, like "ConditionalRange()") choice is performed
+	// once and "Func" is called for chosen range directly, so loop inside "Func"
+	// doesn't check the choice on each step. "Func" should return same type for
+	// all ranges it may be called for
+	//
+	// Algorithms of this library iterate ranges through this function
+	//
+	// ~~~~ Example ~~~~
+	//
+	//  auto WayPointsRange = WayPoints | ConditionalRange(ReverseRange(), bBackward);
+	//
+	//  RangeVisit(WayPointsRange, [](const auto& UsedRange)
+	//  {
+	//      // "UsedRange" is "WayPoints" or "WayPoints | ReverseRange()"
+	//      for (const std::string& Point : UsedRange)
+	//      {
+	//          TracePoint(Point);
+	//      }
+	//  });
+	//
+	template<typename RangeType, typename FuncType>
+	decltype(auto) RangeVisit(RangeType&& Range, FuncType&& Func);
+
+	// =============================================================
+	// ================ Universal internal iteration ===============
+	// =============================================================
+
+	// --------- RangeForEachWhile<>(Range, Func) ---------
+	//
+	// IN:
+	//    (1) Range
+	//       Range to iterate
+	//
+	//    (2) Func
+	//       Callable that accepts Range element and returns "bool": "true"
+	//        to continue iterating, "false" to stop
+	//
+	// OUT:
+	//    {ret}
+	//         "false" if iterating was stopped by "Func", "true" otherwise
+	//
+	// Calls "Func({Element})" for Range elements in Range order until "Func"
+	// returns "false". Ranges with "ForEachWhile(Func) const" method push
+	// elements into "Func" themselves: Ranges of this library built on top of
+	// other Ranges (like "FilteredRange()" or "TransformedRange()") process
+	// elements of Parent Range and pass results to "Func" directly, without
+	// iterators of each stage. So chain of such Ranges is iterated by single
+	// loop over the root Range. Other Ranges are iterated by iterators
+	//
+	// Algorithms of this library iterate ranges through this function
+	//
+	// ~~~~ Example ~~~~
+	//
+	//  std::vector<int> Values = GetValues();
+	//
+	//  RangeForEachWhile(Values | FilteredRange(IsOdd) | TransformedRange(Square),
+	//      [](int Squared)
+	//      {
+	//          Print(Squared);
+	//          return Squared < 100; // Stops after first square not less than 100
+	//      });
+	//
+	template<typename RangeType, typename FuncType>
+	bool RangeForEachWhile(const RangeType& Range, FuncType&& Func);
 
 	// =============================================================
 	// ================= Universal dereference =====================
@@ -263,6 +492,33 @@ namespace UnrealRanges{ namespace Utils{
 	template<typename EnumType>
 	EnumType PreviousEnum(const EnumType Enum);
 
+	// --------- EnumValuesNum<...>(StartEnum, EndEnum) ---------
+	//
+	// IN:
+	//    (1) StartEnum
+	//       First enum value
+	//
+	//    (2) EndEnum
+	//       Enum value next to last
+	//
+	// OUT:
+	//    {ret}
+	//         Number of enum values iterated by "NextEnum(...)"
+	//         from "StartEnum" until "EndEnum" (not included)
+	//
+	// Default implemetnation of Enum values counting, consistent
+	// with default "NextEnum(...)" implementation. Used to get size
+	// of "EnumValuesRange(...)" without iteration
+	//
+	// ! NB: If you write specific "NextEnum(...)" logic for your
+	// enum - write overloading of this function too:
+	//
+	//  template<>
+	//  int EnumValuesNum<YourEnumType>(const YourEnumType StartEnum, const YourEnumType EndEnum);
+	//
+	template<typename EnumType>
+	int EnumValuesNum(const EnumType StartEnum, const EnumType EndEnum);
+
 	// ==========================================================
 	// =================== Flexible C++ =========================
 	// ==========================================================
@@ -473,6 +729,26 @@ namespace UnrealRanges{ namespace Utils{
 	template<typename Type>
 	const Type& ConstDummy();
 
+	// --------- FRandomEngine ---------
+	//
+	// Fast pseudo-random generator ("xoshiro256**") used by random algorithms (like
+	// "Shuffle()"). "Engine()" call returns 64 random bits
+	//
+	// Default constructed engine is seeded by injected "Rand()" (see "Random"
+	// injection in "UnrealRanges_Common_Injection.h"), so seeding of project random
+	// (like "FMath::RandInit()") makes results reproducible. Engine constructed with
+	// explicit seed gives same sequence for same seed
+	//
+	// Random algorithms accept any other engine - callable that returns "std::uint64_t"
+	// with 64 random bits (for example, lambda over "std::mt19937_64")
+	//
+	// ~~~~ Example ~~~~
+	//
+	//  FRandomEngine Engine{ ReplaySeed };
+	//  Shuffle(Deck, Deck.Num(), Engine);
+	//
+	class FRandomEngine;
+
 	// =============================================================================
 	//TODO: Create documentation for this methods
 
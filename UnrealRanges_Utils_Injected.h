@@ -4,6 +4,10 @@
 
 namespace UnrealRanges{ namespace Utils{
 
+	//NB: Wrappers call Injection functions directly, so all parts of the Injection
+	// are required even if some wrappers are not used (see "Contract" section of
+	// "UnrealRanges_Common_Injection.h")
+
 	// ========================== Optional ============================
 
 	//TODO: Add documentation!
@@ -29,10 +33,38 @@ namespace UnrealRanges{ namespace Utils{
 	template<typename ValueType>
 	const ValueType& GetOptionalValueChecked(const TUnrealRanges_Optional<ValueType>& InOptional);
 
+	// ========================== HashSet ============================
+
+	template<typename KeyType>
+	using TUnrealRanges_HashSet = UnrealRanges_Injection::TUnrealRanges_HashSet<KeyType>;
+
+	template<typename KeyType>
+	void HashSetReserve(TUnrealRanges_HashSet<KeyType>& InSet, int InNum);
+
+	template<typename KeyType>
+	void HashSetAdd(TUnrealRanges_HashSet<KeyType>& InSet, const KeyType& InKey);
+
+	template<typename KeyType>
+	bool HashSetContains(const TUnrealRanges_HashSet<KeyType>& InSet, const KeyType& InKey);
+
+	// "true" if keys of "KeyType" may be stored in "TUnrealRanges_HashSet<>" (are hashable)
+	template<typename KeyType>
+	constexpr bool IsHashSetKey();
+
+	// ========================== Parallel ============================
+
+	template<typename FunctionType>
+	void ParallelFor(int InNum, const FunctionType& InBody);
+
+	int ParallelWorkersNum();
+
 	// ========================== Random ============================
 
 	int Rand(int Start, int End);
 
+	// Random value in [0, 1) range
+	float RandFraction();
+
 	// ========================== Random ============================
 
 	void Check(const bool bCondition);
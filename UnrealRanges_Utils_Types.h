@@ -1,5 +1,7 @@
 #pragma once
 
+#include <utility>//for "std::move()"
+
 namespace UnrealRanges{ namespace Utils{
 
 	// =============================================================
@@ -42,6 +44,19 @@ namespace UnrealRanges{ namespace Utils{
 			NotInverted,
 			Not
 		};
+
+		// ------------ Logic::EDistanceQueryPredicate -----------
+		//
+		// Enum for setting up distance queries condition (see
+		// "ActorsFilterByDistance<>()" and "ForEachByDistance<>()"):
+		//  - "Close": elements closer than distance are passed
+		//  - "Far": elements more far than distance are passed
+		//
+		enum EDistanceQueryPredicate
+		{
+			Close,
+			Far
+		};
 	}
 
 	// =============================================================
@@ -57,8 +72,84 @@ namespace UnrealRanges{ namespace Utils{
 			AnB = 0x1 << 2
 		};
 
+		// Algorithm used by "SetOperationRange<>()" for checking if element
+		// of one Range is presented in other Range:
+		//  - "Scan": other Range is iterated for each checked element, O(N*M),
+		//     no allocations, elements are compared with "=="
+		//  - "Hashed": hash index of other Range is built once on first
+		//     "begin()", O(N+M), elements (or their keys) should be hashable
+		//  - "Sorted": Ranges are merged in one pass, O(N+M), no allocations,
+		//     Ranges should be sorted, elements (or their keys) should support "<"
+		//     (or passed comparator)
+		//
+		enum EAlgorithm
+		{
+			Scan,
+			Hashed,
+			Sorted
+		};
+
 	} //namespace ::Utils::Set
 
+	// =============================================================
+	// ======================== Execution ==========================
+	// =============================================================
+
+	namespace Execution {
+
+		// Execution policy for algorithms that support parallel execution:
+		//  - "Sequenced": algorithm is performed on calling thread, same
+		//     as algorithm called without policy
+		//  - "Parallel": algorithm may be performed on several threads
+		//     (see "Parallel" Injection). Result is same as for sequenced
+		//     execution (for example, first found element is returned).
+		//     Ranges that cannot be split to parts in Range order (like hash
+		//     containers, see "IsOrderedSplitRange<>()") are processed
+		//     sequentially by algorithms which result depends on order
+		//  - "ParallelUnsequenced": same as "Parallel", but order of
+		//     elements is not respected where it allows to finish earlier
+		//     (for example, any found element may be returned)
+		//
+		// Callables passed to algorithms with parallel policies should be
+		// safe for concurrent calls
+		//
+		enum EPolicy
+		{
+			Sequenced,
+			Parallel,
+			ParallelUnsequenced
+		};
+
+	} //namespace ::Utils::Execution
+
+	// =============================================================
+	// ======================== Range part =========================
+	// =============================================================
+
+	// Part of Range produced by "RangeSplit<>(Range, PartsNum)": elements
+	// of Range in "[Begin, End)"
+	template<typename IteratorType>
+	class TRangePart
+	{
+	public:
+		TRangePart(IteratorType&& InBegin, IteratorType&& InEnd)
+			: Begin(std::move(InBegin)), End(std::move(InEnd)) { }
+
+		IteratorType begin() const
+		{
+			return Begin;
+		}
+
+		IteratorType end() const
+		{
+			return End;
+		}
+
+	private:
+		IteratorType Begin;
+		IteratorType End;
+	};
+
 	// =============================================================
 	// ====================== Set operations =======================
 	// =============================================================